@@ -223,7 +223,10 @@ int main(int argc, char* argv[]) {
 	std::unique_ptr<raco::application::RaCoApplication> app;
 
 	try {
-		app = std::make_unique<raco::application::RaCoApplication>(rendererBackend, raco::application::RaCoApplicationLaunchSettings(projectFile, true, parser.isSet(ramsesTraceLogMessageAction), newFileFeatureLevel, initialLoadFeatureLevel, true));
+		raco::application::RaCoApplicationLaunchSettings settings(projectFile, true, parser.isSet(ramsesTraceLogMessageAction), newFileFeatureLevel, initialLoadFeatureLevel, true);
+		// Don't block the UI while large mesh files are parsed.
+		settings.asyncMeshLoading = true;
+		app = std::make_unique<raco::application::RaCoApplication>(rendererBackend, settings);
 	} catch (const raco::application::FutureFileVersion& error) {
 		LOG_ERROR(log_system::COMMON, "File load error: project file was created with newer file version {} but current file version is {}.", error.fileVersion_, serialization::RAMSES_PROJECT_FILE_VERSION);
 		app.reset();
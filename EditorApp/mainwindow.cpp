@@ -84,6 +84,7 @@
 
 #include <DockWidget.h>
 #include <IconProvider.h>
+#include <QCoreApplication>
 #include <QDialog>
 #include <QFileDialog>
 #include <QHeaderView>
@@ -99,6 +100,7 @@
 #include <vector>
 
 static const int timerInterval60Fps = 17;
+static const std::chrono::seconds frameStatisticsLogInterval{60};
 
 using namespace raco;
 using namespace raco::core;
@@ -555,6 +557,9 @@ MainWindow::MainWindow(raco::application::RaCoApplication* racoApplication, rams
 	// Will we support Mac?
 	setUnifiedTitleAndToolBarOnMac(true);
 
+	// Render a frame right away on user interaction instead of waiting for the next idle frame.
+	QCoreApplication::instance()->installEventFilter(this);
+
 	renderTimerId_ = startTimer(timerInterval60Fps);
 }
 
@@ -569,7 +574,40 @@ void MainWindow::saveDockManagerCustomLayouts() {
 	}
 }
 
+bool MainWindow::eventFilter(QObject* watched, QEvent* event) {
+	switch (event->type()) {
+		case QEvent::MouseButtonPress:
+		case QEvent::MouseButtonRelease:
+		case QEvent::MouseButtonDblClick:
+		case QEvent::MouseMove:
+		case QEvent::Wheel:
+		case QEvent::KeyPress:
+		case QEvent::KeyRelease:
+		case QEvent::Resize:
+		case QEvent::Show:
+		case QEvent::WindowActivate:
+			frameScheduler_.requestFrame();
+			break;
+		default:
+			break;
+	}
+	return QMainWindow::eventFilter(watched, event);
+}
+
 void MainWindow::timerEvent(QTimerEvent* event) {
+	frameScheduler_.setIdleFrameInterval(std::chrono::milliseconds(components::RaCoPreferences::instance().idleFrameIntervalMs));
+	bool renderFrame = frameScheduler_.shouldRenderFrame(racoApplication_->hasPendingUpdates());
+
+	auto now = std::chrono::steady_clock::now();
+	if (now - lastFrameStatisticsLog_ >= frameStatisticsLogInterval) {
+		LOG_DEBUG(log_system::PREVIEW_WIDGET, "Frames rendered: {}, skipped: {}", frameScheduler_.renderedFrameCount(), frameScheduler_.skippedFrameCount());
+		lastFrameStatisticsLog_ = now;
+	}
+
+	if (!renderFrame) {
+		return;
+	}
+
 	auto startLoop = std::chrono::high_resolution_clock::now();
 	racoApplication_->doOneLoop();
 
@@ -729,6 +767,7 @@ void MainWindow::openProject(const QString& file, int featureLevel, bool generat
 	}
 
 	renderTimerId_ = startTimer(timerInterval60Fps);
+	frameScheduler_.requestFrame();
 
 	// Recreate our layout with new context
 	dockManager_ = createDockManager();
@@ -844,7 +883,7 @@ bool MainWindow::isUpgradePrevented() {
 		constexpr auto currentFileVersion = serialization::RAMSES_PROJECT_FILE_VERSION;
 		
 		try {
-			auto previousFileVersion = serialization::deserializeFileVersion(application::RaCoProject::loadJsonDocument(filename));
+			auto previousFileVersion = serialization::deserializeFileVersion(application::RaCoProject::loadProjectHeader(filename));
 			if (currentFileVersion > previousFileVersion) {
 				const auto answer = QMessageBox::warning(this, "Save File Warning", fmt::format("The project with the file version {} will be overwritten with the file version {}. Are you sure you want to save it with the new file version", previousFileVersion, currentFileVersion).c_str(), QMessageBox::Save, QMessageBox::Cancel);
 				if (answer == QMessageBox::Cancel) {
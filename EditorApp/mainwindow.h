@@ -10,6 +10,7 @@
 #pragma once
 
 #include "RaCoDockManager.h"
+#include "application/FrameScheduler.h"
 #include "common_widgets/log_model/LogViewModel.h"
 #include "object_tree_view/ObjectTreeDockManager.h"
 #include "object_tree_view_model/ObjectTreeViewDefaultModel.h"
@@ -73,6 +74,7 @@ public Q_SLOTS:
 
 protected:
 	void timerEvent(QTimerEvent* event) override;
+	bool eventFilter(QObject* watched, QEvent* event) override;
 	void closeEvent(QCloseEvent* event) override;
 	void dragEnterEvent(QDragEnterEvent* event) override;
 	void dropEvent(QDropEvent* event) override;
@@ -146,6 +148,8 @@ private:
 	std::map<QString, qint64> pythonScriptArgumentCache_;
 
 	int renderTimerId_ = 0;
+	raco::application::FrameScheduler frameScheduler_;
+	std::chrono::steady_clock::time_point lastFrameStatisticsLog_ = std::chrono::steady_clock::now();
 
 	QFileInfo getDragAndDropFileInfo(const QDropEvent* event);
 };
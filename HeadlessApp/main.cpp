@@ -47,7 +47,12 @@ public Q_SLOTS:
 		std::unique_ptr<raco::application::RaCoApplication> app;
 
 		try {
-			app = std::make_unique<raco::application::RaCoApplication>(backend, raco::application::RaCoApplicationLaunchSettings{projectFile_, false, true, featureLevel_, featureLevel_, false});
+			raco::application::RaCoApplicationLaunchSettings settings{projectFile_, false, true, featureLevel_, featureLevel_, false};
+			// There is no Project Browser showing the external projects in the headless application.
+			settings.partialExternalProjectLoading = true;
+			// Python scripts loading many projects usually share the same external projects.
+			settings.cacheExternalProjects = true;
+			app = std::make_unique<raco::application::RaCoApplication>(backend, settings);
 		} catch (const raco::application::FutureFileVersion& error) {
 			LOG_ERROR(log_system::COMMON, "File load error: project file was created with newer file version {} but current file version is {}.", error.fileVersion_, serialization::RAMSES_PROJECT_FILE_VERSION);
 			app.reset();
@@ -16,10 +16,13 @@
 #include "components/DataChangeDispatcher.h"
 #include "core/ChangeRecorder.h"
 #include "core/Project.h"
+#include <filesystem>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
+#include <vector>
 
 class ObjectTreeViewExternalProjectModelTest;
 
@@ -37,6 +40,34 @@ public:
 
 	bool isCurrent(const std::string& projectPath) const;
 
+	/**
+	 * @brief Enable loading only the part of external projects needed by the external reference update.
+	 *
+	 * Partial loading is used if the LoadContext passed to addExternalProject contains the required objects for the project
+	 * and the project has an up-to-date object index file. Requests without required objects, e.g. from the Python API, load
+	 * the complete project, replacing a partially loaded one.
+	 * This must not be enabled when the external projects are shown in the Project Browser.
+	 */
+	void setPartialLoading(bool enable);
+
+	// @return true if the project at the path is loaded and only partially loaded
+	bool isPartiallyLoaded(const std::string& projectPath) const;
+
+	/**
+	 * @brief Keep the external projects in a cache when the store is cleared and reuse them in later loads.
+	 *
+	 * A cached project is reused if its file content, identified by modification time and content hash, is unchanged,
+	 * it was loaded with the same feature level and all external projects it uses can be reused as well. Cache entries
+	 * are dropped when the file change monitor reports a change of the project file.
+	 * This is meant for batch processing of many projects sharing the same external projects. Projects modified in
+	 * memory are not cached.
+	 */
+	void setProjectCaching(bool enable);
+	void clearProjectCache();
+
+	// @return true if the project at the path is in the cache, i.e. not loaded but available for reuse
+	bool isCached(const std::string& projectPath) const;
+
 	// @return project if loaded successfully
 	core::Project* addExternalProject(const std::string& projectPath, core::LoadContext& loadContext) override;
 	void removeExternalProject(const std::string& projectPath) override;
@@ -61,23 +92,69 @@ private:
 		std::set<std::string> externalProjectPaths;
 	};
 
+	struct ProjectFileVersion {
+		std::filesystem::file_time_type modificationTime;
+		std::string contentHash;
+		int featureLevel;
+
+		bool operator==(const ProjectFileVersion& other) const {
+			return modificationTime == other.modificationTime && contentHash == other.contentHash && featureLevel == other.featureLevel;
+		}
+		bool operator!=(const ProjectFileVersion& other) const {
+			return !(*this == other);
+		}
+	};
+
+	struct CachedProject {
+		std::unique_ptr<RaCoProject> project;
+		// Required object IDs if the project is only partially loaded
+		std::optional<std::set<std::string>> objectIDs;
+		ProjectFileVersion version;
+		// Versions of the external projects used by the project at the time it was cached
+		std::map<std::string, ProjectFileVersion> dependencies;
+	};
+
+	// @return empty optional if the file can't be read
+	static std::optional<ProjectFileVersion> readProjectFileVersion(const std::string& projectPath, int featureLevel);
+
 	std::string activeProjectPath() const;
 
 	void buildProjectGraph(const std::string& absPath, std::vector<ProjectGraphNode>& outProjects);
 	void updateExternalProjectsDependingOn(const std::string& absPath, int featureLevel);
-	bool loadExternalProject(const std::string& projectPath, core::LoadContext& loadContext);
+	bool loadExternalProject(const std::string& projectPath, core::LoadContext& loadContext, const std::set<std::string>* requiredObjectIDs = nullptr);
+	bool needsReload(const std::string& projectPath, const std::set<std::string>* requiredObjectIDs) const;
+	void registerFileChangeListener(const std::string& projectPath, int featureLevel);
+
+	void cacheExternalProjects();
+	bool collectReusableCachedProjects(const std::string& projectPath, const ProjectFileVersion* expectedVersion, const core::LoadContext& loadContext, std::set<std::string>& outPaths);
+	bool restoreCachedProject(const std::string& projectPath, const core::LoadContext& loadContext);
+	void invalidateCachedProject(const std::string& projectPath);
 
 	RaCoProject* activeProject_ = nullptr;
 	RaCoApplication* application_ = nullptr;
 
 	std::map<std::string, std::unique_ptr<RaCoProject>> externalProjects_;
 
+	bool partialLoading_ = false;
+	// Required object IDs of the partially loaded projects in externalProjects_
+	std::map<std::string, std::set<std::string>> partialProjectObjects_;
+	// Projects replaced by a reload with a larger object set. An external reference update may still use objects of
+	// these projects so they are kept alive until the store is cleared.
+	std::vector<std::unique_ptr<RaCoProject>> replacedPartialProjects_;
+
+	bool projectCaching_ = false;
+	// File versions of the projects in externalProjects_; only recorded if caching is enabled.
+	std::map<std::string, ProjectFileVersion> loadedProjectVersions_;
+	std::map<std::string, CachedProject> projectCache_;
+
 	std::function<std::string(const std::string&)> relinkCallback_;
 	std::map<std::string, std::string> relinkPathMapCache_;
 
 	components::ProjectFileChangeMonitor externalProjectFileChangeMonitor_;
 
 	std::unordered_map<std::string, components::ProjectFileChangeMonitor::UniqueListener> externalProjectFileChangeListeners_;
+	// May contain listeners of already invalidated cache entries since listeners can't be removed from their own callback.
+	std::unordered_map<std::string, components::ProjectFileChangeMonitor::UniqueListener> projectCacheListeners_;
 
 	std::unique_ptr<FeatureLevelLoadError> flError_;
 };
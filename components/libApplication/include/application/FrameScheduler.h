@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace raco::application {
+
+/**
+ * @brief Decides for each tick of the render timer whether a frame needs to be rendered.
+ *
+ * A frame is rendered if the application has pending updates or if a frame has been requested, e.g. because
+ * of user interaction. After such a frame the scheduler keeps rendering every tick for the active period
+ * to catch changes which are not announced, e.g. resizing or camera movement in the preview.
+ * Otherwise frames are only rendered once every idle frame interval. An idle frame interval of zero renders every tick.
+ */
+class FrameScheduler {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr std::chrono::milliseconds DEFAULT_IDLE_FRAME_INTERVAL{500};
+	static constexpr std::chrono::milliseconds DEFAULT_ACTIVE_PERIOD{1000};
+
+	FrameScheduler(std::chrono::milliseconds idleFrameInterval = DEFAULT_IDLE_FRAME_INTERVAL, std::chrono::milliseconds activePeriod = DEFAULT_ACTIVE_PERIOD);
+
+	void setIdleFrameInterval(std::chrono::milliseconds interval);
+	std::chrono::milliseconds idleFrameInterval() const;
+
+	// Render the frame at the next tick.
+	void requestFrame();
+
+	/**
+	 * @brief Decide whether the frame of the current tick should be rendered and update the frame counts.
+	 *
+	 * @param hasPendingUpdates True if the application has changes which need to be processed.
+	 * @param now Time of the current tick.
+	 */
+	bool shouldRenderFrame(bool hasPendingUpdates, Clock::time_point now = Clock::now());
+
+	uint64_t renderedFrameCount() const;
+	uint64_t skippedFrameCount() const;
+
+private:
+	std::chrono::milliseconds idleFrameInterval_;
+	std::chrono::milliseconds activePeriod_;
+
+	bool frameRequested_ = true;
+	Clock::time_point activeUntil_{};
+	Clock::time_point lastFrame_{};
+
+	uint64_t renderedFrameCount_ = 0;
+	uint64_t skippedFrameCount_ = 0;
+};
+
+}  // namespace raco::application
@@ -51,6 +51,14 @@ struct RaCoApplicationLaunchSettings {
 	int newFileFeatureLevel;
 	int initialLoadFeatureLevel;
 	bool runningInUI;
+
+	// Only load the part of external projects used by external references, see ExternalProjectsStore::setPartialLoading.
+	// Not used by the editor since its Project Browser shows the complete external projects.
+	bool partialExternalProjectLoading = false;
+	// Reuse unchanged external projects across project loads, see ExternalProjectsStore::setProjectCaching.
+	bool cacheExternalProjects = false;
+	// Load mesh files in the background, see MeshCacheImpl::setAsyncLoading.
+	bool asyncMeshLoading = false;
 };
 
 // Lua script saving mode. Wraps ramses::ELuaSavingMode.
@@ -106,13 +114,18 @@ public:
 		bool warningsAsErrors = false);
 
 	void doOneLoop();
+	// True if the next doOneLoop will change the scene or the data model, i.e. if there are recorded changes,
+	// running timers or trace playback, or mesh files loaded in the background.
+	bool hasPendingUpdates() const;
+	// Wait until all mesh files loaded in the background are loaded and update the scene.
+	void waitForPendingMeshLoads();
 
 	void resetSceneBackend();
 
 	bool canSaveActiveProject() const;
 
 	core::ExternalProjectsStoreInterface* externalProjects();
-	core::MeshCache* meshCache();
+	components::MeshCacheImpl* meshCache();
 
 	const core::SceneBackendInterface* sceneBackend() const;
 
@@ -146,8 +159,11 @@ public:
 	void setRecordingStats(bool enable);
 	void resetStats();
 	const ReportStatistics& getLogicStats() const;
+	const CacheStatistics& getShaderCacheStats() const;
+	const CacheStatistics& getLuaScriptCacheStats() const;
 
 Q_SIGNALS:
+	// Emitted when new logic engine timings have been recorded or the cache statistics have changed.
 	void performanceStatisticsUpdated();
 
 private:
@@ -157,6 +173,10 @@ private:
 	bool exportProjectImpl(const std::string& ramsesExport, bool compress, std::string& outError, bool forceExportWithErrors, ELuaSavingMode luaSavingMode, bool warningsAsErrors) const;
 
 	void setupScene(bool optimizedForExport, bool setupAbstractScene);
+	// TimerNodes with ticker_us set to 0 use the system time and need a logic engine update every frame.
+	bool hasAutoTickingTimers() const;
+	// Read the statistics of the parse caches, returns true if they have changed.
+	bool updateCacheStats();
 
 	ramses_base::BaseEngineBackend* engine_;
 
@@ -185,6 +205,8 @@ private:
 
 	bool recordingStats_ = false;
 	ReportStatistics logicStats_;
+	CacheStatistics shaderCacheStats_;
+	CacheStatistics luaScriptCacheStats_;
 };
 
 }  // namespace raco::application
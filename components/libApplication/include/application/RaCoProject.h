@@ -24,6 +24,7 @@
 #include <exception>
 #include <functional>
 #include <memory>
+#include <set>
 #include <QFileInfo>
 
 namespace raco::components {
@@ -77,18 +78,54 @@ public:
 	 */
 	static QJsonDocument loadJsonDocument(const QString& filename);
 
+	/**
+	 * @brief Loads the top-level data of a project file without the object and link arrays.
+	 * @param filename path to the project file
+	 * @return header JSON content, e.g. for reading the file version or feature level
+	 */
+	static QJsonDocument loadProjectHeader(const QString& filename);
+
+	/**
+	 * @brief Checks and opens a project file for streaming deserialization.
+	 * @param filename path to the project file
+	 * @return stream with the JSON content; zipped files are unpacked in memory
+	 */
+	static std::unique_ptr<std::istream> openProjectFile(const QString& filename);
+
 	/**
 	 * @brief Load scene
 	 * @param featureLevel update scene to given feature level if >0 and use feature level from file if -1
+	 * @param requiredObjectIDs if not null only load the given objects and the objects they depend on.
+	 * This needs an up-to-date object index file next to the project file, see serialization::ProjectObjectIndex.
+	 * Without a usable index the complete project is loaded.
 	 * @exception FutureFileVersion when the loaded file contains a file version which is bigger than the known versions
 	 * @exception ExtrefError
 	 */
-	static std::unique_ptr<RaCoProject> loadFromFile(const QString& filename, RaCoApplication* app, core::LoadContext& loadContext, bool logErrors = true, int featureLevel = -1, bool generateNewObjectIDs = false);
+	static std::unique_ptr<RaCoProject> loadFromFile(const QString& filename, RaCoApplication* app, core::LoadContext& loadContext, bool logErrors = true, int featureLevel = -1, bool generateNewObjectIDs = false, const std::set<std::string>* requiredObjectIDs = nullptr);
 	
 	QString name() const;
 	std::string pythonOnSaveScriptPath();
 
 	bool dirty() const noexcept;
+
+	// True if only part of the project file has been loaded; such projects can't be saved.
+	bool isPartiallyLoaded() const;
+
+	enum class FileFormat {
+		Json,
+		// Binary encoding of the JSON content, see core/BinarySerialization.h
+		Binary
+	};
+
+	/**
+	 * @brief File format used by save and saveAs.
+	 * 
+	 * Projects loaded from a binary file are saved in the binary format again. The ProjectSettings saveAsZip
+	 * option only applies to the JSON format.
+	*/
+	FileFormat fileFormat() const;
+	void setFileFormat(FileFormat format);
+
 	bool save(std::string &outError);
 	bool saveAs(const QString& fileName, std::string& outError, bool setProjectName = false);
 
@@ -105,9 +142,13 @@ public:
 	core::MeshCache* meshCache();
 	components::TracePlayer& tracePlayer();
 
-	QJsonDocument serializeProject(const std::unordered_map<std::string, std::vector<int>>& currentVersions);
+	/**
+	 * @brief Serialize the project for saving.
+	 * @param outIndex if not null receives the object index of the serialized project without the file hash.
+	 */
+	QJsonDocument serializeProject(const std::unordered_map<std::string, std::vector<int>>& currentVersions, serialization::ProjectObjectIndex* outIndex = nullptr);
 
-	void applyPreferences() const;
+	void applyPreferences();
 	void applyDefaultCachedPaths();
 	void setupCachedPathSubscriptions(const components::SDataChangeDispatcher& dataChangeDispatcher);
 		
@@ -121,13 +162,14 @@ private:
 	// @exception ExtrefError
 	RaCoProject(const QString& file, core::Project& p, core::EngineInterface* engineInterface, const core::UndoStack::Callback& callback, core::ExternalProjectsStoreInterface* externalProjectsStore, RaCoApplication* app, core::LoadContext& loadContext, int fileVersion);
 
-	QJsonDocument serializeProjectData(const std::unordered_map<std::string, std::vector<int>>& currentVersions);
+	QJsonDocument serializeProjectData(const std::unordered_map<std::string, std::vector<int>>& currentVersions, serialization::ProjectObjectIndex* outIndex);
 
 
 	void onAfterProjectPathChange(const std::string& oldPath, const std::string& newPath);
 	void generateProjectSubfolder(const std::string& subFolderPath);
 	void generateAllProjectSubfolders();
 	void updateActiveFileListener();
+	void applyUndoStackBudget();
 	
 	core::DataChangeRecorder recorder_;
 	core::Errors errors_;
@@ -142,6 +184,8 @@ private:
 
 	std::shared_ptr<core::BaseContext> context_;
 	bool dirty_{false};
+	bool partiallyLoaded_{false};
+	FileFormat fileFormat_{FileFormat::Json};
 
 	components::ProjectFileChangeMonitor activeProjectFileChangeMonitor_;
 	components::ProjectFileChangeMonitor::UniqueListener activeProjectFileChangeListener_;
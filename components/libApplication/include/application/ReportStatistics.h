@@ -10,6 +10,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <map>
 #include <string>
@@ -49,4 +50,24 @@ private:
 	std::map<NodeDescriptor, TimingSeries> store_;
 };
 
+// Lookup counters of one of the parse caches, e.g. the shader reflection cache.
+struct CacheStatistics {
+	size_t hits = 0;
+	size_t misses = 0;
+	size_t entryCount = 0;
+
+	// Fraction of lookups answered from the cache, 0 if there were no lookups.
+	double hitRate() const {
+		return hits + misses > 0 ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0;
+	}
+
+	bool operator==(const CacheStatistics& other) const {
+		return hits == other.hits && misses == other.misses && entryCount == other.entryCount;
+	}
+
+	bool operator!=(const CacheStatistics& other) const {
+		return !(*this == other);
+	}
+};
+
 }  // namespace raco::application
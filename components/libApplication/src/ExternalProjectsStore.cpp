@@ -10,20 +10,31 @@
 #include "application/ExternalProjectsStore.h"
 
 #include "application/RaCoApplication.h"
+#include "core/ProjectObjectIndex.h"
 
 #include "utils/u8path.h"
 
 #include <QFile>
 #include <QFileInfo>
 
+#include <algorithm>
+#include <fstream>
+#include <optional>
+
 namespace raco::application {
 
 ExternalProjectsStore::ExternalProjectsStore(RaCoApplication* app) : application_(app) {
 }
 
 void ExternalProjectsStore::clear() {
+	if (projectCaching_) {
+		cacheExternalProjects();
+	}
 	activeProject_ = nullptr;
 	externalProjects_.clear();
+	loadedProjectVersions_.clear();
+	partialProjectObjects_.clear();
+	replacedPartialProjects_.clear();
 	externalProjectFileChangeListeners_.clear();
 	clearRelinkCallback();
 	flError_.reset();
@@ -33,6 +44,178 @@ void ExternalProjectsStore::setActiveProject(RaCoProject* activeProject) {
 	activeProject_ = activeProject;
 }
 
+void ExternalProjectsStore::setPartialLoading(bool enable) {
+	partialLoading_ = enable;
+}
+
+bool ExternalProjectsStore::isPartiallyLoaded(const std::string& projectPath) const {
+	return partialProjectObjects_.find(projectPath) != partialProjectObjects_.end();
+}
+
+void ExternalProjectsStore::setProjectCaching(bool enable) {
+	projectCaching_ = enable;
+	if (!enable) {
+		clearProjectCache();
+	}
+}
+
+void ExternalProjectsStore::clearProjectCache() {
+	projectCache_.clear();
+	projectCacheListeners_.clear();
+}
+
+bool ExternalProjectsStore::isCached(const std::string& projectPath) const {
+	return projectCache_.find(projectPath) != projectCache_.end();
+}
+
+std::optional<ExternalProjectsStore::ProjectFileVersion> ExternalProjectsStore::readProjectFileVersion(const std::string& projectPath, int featureLevel) {
+	std::error_code error;
+	auto modificationTime = std::filesystem::last_write_time(utils::u8path(projectPath).internalPath(), error);
+	if (error) {
+		return std::nullopt;
+	}
+	std::ifstream file(utils::u8path(projectPath).internalPath(), std::ios::in | std::ios::binary);
+	if (!file) {
+		return std::nullopt;
+	}
+	return ProjectFileVersion{modificationTime, serialization::ProjectObjectIndex::hashFileContent(file), featureLevel};
+}
+
+void ExternalProjectsStore::cacheExternalProjects() {
+	for (auto& [path, project] : externalProjects_) {
+		auto versionIt = loadedProjectVersions_.find(path);
+		if (!project || versionIt == loadedProjectVersions_.end() || project->dirty() || project->project()->externalReferenceUpdateFailed()) {
+			continue;
+		}
+
+		std::map<std::string, ProjectFileVersion> dependencies;
+		bool dependenciesKnown = true;
+		for (const auto& item : project->project()->externalProjectsMap()) {
+			auto dependencyPath = project->project()->lookupExternalProjectPath(item.first);
+			auto dependencyIt = loadedProjectVersions_.find(dependencyPath);
+			if (dependencyIt == loadedProjectVersions_.end()) {
+				dependenciesKnown = false;
+				break;
+			}
+			dependencies[dependencyPath] = dependencyIt->second;
+		}
+		if (!dependenciesKnown) {
+			continue;
+		}
+
+		std::optional<std::set<std::string>> objectIDs;
+		if (auto it = partialProjectObjects_.find(path); it != partialProjectObjects_.end()) {
+			objectIDs = std::move(it->second);
+		}
+		projectCache_.insert_or_assign(path, CachedProject{std::move(project), std::move(objectIDs), versionIt->second, std::move(dependencies)});
+
+		auto cachedPath = path;
+		projectCacheListeners_[path] = externalProjectFileChangeMonitor_.registerFileChangedHandler(path, [this, cachedPath]() {
+			invalidateCachedProject(cachedPath);
+		});
+	}
+
+	// Remove listeners of cache entries invalidated by the file change monitor.
+	for (auto it = projectCacheListeners_.begin(); it != projectCacheListeners_.end();) {
+		if (projectCache_.find(it->first) == projectCache_.end()) {
+			it = projectCacheListeners_.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+bool ExternalProjectsStore::collectReusableCachedProjects(const std::string& projectPath, const ProjectFileVersion* expectedVersion, const core::LoadContext& loadContext, std::set<std::string>& outPaths) {
+	// Dependencies already loaded in the store need to be the version the cached project was loaded with.
+	if (auto it = externalProjects_.find(projectPath); it != externalProjects_.end()) {
+		auto versionIt = loadedProjectVersions_.find(projectPath);
+		return it->second && expectedVersion && versionIt != loadedProjectVersions_.end() && versionIt->second == *expectedVersion;
+	}
+
+	auto it = projectCache_.find(projectPath);
+	if (it == projectCache_.end()) {
+		return false;
+	}
+	const auto& entry = it->second;
+	if (expectedVersion && entry.version != *expectedVersion) {
+		return false;
+	}
+	if (outPaths.find(projectPath) != outPaths.end()) {
+		return true;
+	}
+
+	if (entry.version.featureLevel != loadContext.featureLevel ||
+		projectPath == activeProjectPath() ||
+		std::find(loadContext.pathStack.begin(), loadContext.pathStack.end(), projectPath) != loadContext.pathStack.end() ||
+		(activeProject_ && entry.project->project()->projectID() == activeProject_->project()->projectID())) {
+		return false;
+	}
+
+	auto currentVersion = readProjectFileVersion(projectPath, loadContext.featureLevel);
+	if (!currentVersion || *currentVersion != entry.version) {
+		// Projects depending on this one are outdated as well but are replaced when they are loaded again.
+		projectCache_.erase(it);
+		return false;
+	}
+
+	outPaths.insert(projectPath);
+	for (const auto& [dependencyPath, dependencyVersion] : entry.dependencies) {
+		if (!collectReusableCachedProjects(dependencyPath, &dependencyVersion, loadContext, outPaths)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ExternalProjectsStore::restoreCachedProject(const std::string& projectPath, const core::LoadContext& loadContext) {
+	std::set<std::string> paths;
+	if (!collectReusableCachedProjects(projectPath, nullptr, loadContext, paths)) {
+		return false;
+	}
+
+	for (const auto& path : paths) {
+		auto node = projectCache_.extract(path);
+		auto& entry = node.mapped();
+		LOG_DEBUG(log_system::COMMON, "Reusing cached external project '{}'", path);
+		if (entry.objectIDs) {
+			partialProjectObjects_[path] = std::move(entry.objectIDs.value());
+		}
+		loadedProjectVersions_[path] = entry.version;
+		externalProjects_[path] = std::move(entry.project);
+		projectCacheListeners_.erase(path);
+		registerFileChangeListener(path, entry.version.featureLevel);
+	}
+	application_->dataChangeDispatcher()->setExternalProjectChanged();
+	return true;
+}
+
+void ExternalProjectsStore::invalidateCachedProject(const std::string& projectPath) {
+	if (projectCache_.erase(projectPath) == 0) {
+		return;
+	}
+
+	std::vector<std::string> dependentPaths;
+	for (const auto& [path, entry] : projectCache_) {
+		if (entry.dependencies.find(projectPath) != entry.dependencies.end()) {
+			dependentPaths.emplace_back(path);
+		}
+	}
+	for (const auto& path : dependentPaths) {
+		invalidateCachedProject(path);
+	}
+}
+
+bool ExternalProjectsStore::needsReload(const std::string& projectPath, const std::set<std::string>* requiredObjectIDs) const {
+	auto it = partialProjectObjects_.find(projectPath);
+	if (it == partialProjectObjects_.end()) {
+		return false;
+	}
+	if (requiredObjectIDs) {
+		return !std::includes(it->second.begin(), it->second.end(), requiredObjectIDs->begin(), requiredObjectIDs->end());
+	}
+	return true;
+}
+
 void ExternalProjectsStore::buildProjectGraph(const std::string& absPath, std::vector<ProjectGraphNode>& outProjects) {
 	if (std::find_if(outProjects.begin(), outProjects.end(), [absPath](const ProjectGraphNode& node) {
 			return absPath == node.path;
@@ -114,10 +297,37 @@ core::Project* ExternalProjectsStore::addExternalProject(const std::string& orig
 		projectPath = relinkPathMapCache_.at(projectPath);
 	}
 
+	// Objects needed by the currently running external reference update.
+	// During the update projects not explicitly required are only needed to look up objects reachable from required objects of
+	// other projects. These are contained in the already loaded partial projects, so only load complete projects if they are
+	// not loaded yet.
+	const std::set<std::string>* requiredObjectIDs = nullptr;
+	bool fullProjectNeeded = true;
+	if (partialLoading_ && loadContext.requiredExternalObjects) {
+		auto requiredIt = loadContext.requiredExternalObjects->find(origProjectPath);
+		if (requiredIt != loadContext.requiredExternalObjects->end()) {
+			requiredObjectIDs = &requiredIt->second;
+		}
+		fullProjectNeeded = false;
+	}
+
+	if (projectCaching_ && externalProjects_.find(projectPath) == externalProjects_.end()) {
+		restoreCachedProject(projectPath, loadContext);
+	}
+
 	auto it = externalProjects_.find(projectPath);
 	if (it != externalProjects_.end()) {
-		if (it->second) {
-			return it->second->project();
+		if (it->second && (requiredObjectIDs || fullProjectNeeded) && needsReload(projectPath, requiredObjectIDs)) {
+			std::set<std::string> objectIDs;
+			if (requiredObjectIDs) {
+				objectIDs = partialProjectObjects_.at(projectPath);
+				objectIDs.insert(requiredObjectIDs->begin(), requiredObjectIDs->end());
+			}
+			replacedPartialProjects_.emplace_back(std::move(it->second));
+			loadExternalProject(projectPath, loadContext, requiredObjectIDs ? &objectIDs : nullptr);
+		}
+		if (auto& project = externalProjects_.at(projectPath)) {
+			return project->project();
 		} else {
 			return nullptr;
 		}
@@ -143,16 +353,9 @@ core::Project* ExternalProjectsStore::addExternalProject(const std::string& orig
 		}
 	}
 
-	bool status = loadExternalProject(projectPath, loadContext);
+	bool status = loadExternalProject(projectPath, loadContext, requiredObjectIDs);
 
-	int featureLevel = loadContext.featureLevel;
-	externalProjectFileChangeListeners_[projectPath] = externalProjectFileChangeMonitor_.registerFileChangedHandler(projectPath,
-		[this, projectPath, featureLevel]() {
-			core::LoadContext loadContext;
-			loadContext.featureLevel = featureLevel;
-			loadExternalProject(projectPath, loadContext);
-			updateExternalProjectsDependingOn(projectPath, featureLevel);
-		});
+	registerFileChangeListener(projectPath, loadContext.featureLevel);
 	application_->dataChangeDispatcher()->setExternalProjectChanged();
 
 	if (status) {
@@ -161,6 +364,20 @@ core::Project* ExternalProjectsStore::addExternalProject(const std::string& orig
 	return nullptr;
 }
 
+void ExternalProjectsStore::registerFileChangeListener(const std::string& projectPath, int featureLevel) {
+	externalProjectFileChangeListeners_[projectPath] = externalProjectFileChangeMonitor_.registerFileChangedHandler(projectPath,
+		[this, projectPath, featureLevel]() {
+			core::LoadContext loadContext;
+			loadContext.featureLevel = featureLevel;
+			std::optional<std::set<std::string>> objectIDs;
+			if (auto it = partialProjectObjects_.find(projectPath); it != partialProjectObjects_.end()) {
+				objectIDs = it->second;
+			}
+			loadExternalProject(projectPath, loadContext, objectIDs ? &objectIDs.value() : nullptr);
+			updateExternalProjectsDependingOn(projectPath, featureLevel);
+		});
+}
+
 std::string ExternalProjectsStore::activeProjectPath() const {
 	if (activeProject_ && !activeProject_->project()->currentFileName().empty()) {
 		return activeProject_->project()->currentPath();
@@ -168,12 +385,24 @@ std::string ExternalProjectsStore::activeProjectPath() const {
 	return std::string();
 }
 
-bool ExternalProjectsStore::loadExternalProject(const std::string& projectPath, core::LoadContext & loadContext) {
+bool ExternalProjectsStore::loadExternalProject(const std::string& projectPath, core::LoadContext & loadContext, const std::set<std::string>* requiredObjectIDs) {
+	// Copy since the LoadContext owning the required objects is modified by the external reference updates during the load.
+	std::optional<std::set<std::string>> objectIDs;
+	if (partialLoading_ && requiredObjectIDs) {
+		objectIDs = *requiredObjectIDs;
+	}
+
 	std::unique_ptr<RaCoProject> project;
 	bool success = false;
+	std::optional<ProjectFileVersion> fileVersion;
 	if (projectPath != activeProjectPath()) {
+		if (projectCaching_) {
+			// Read before loading so that the cache key can't be newer than the loaded content.
+			fileVersion = readProjectFileVersion(projectPath, loadContext.featureLevel);
+			projectCache_.erase(projectPath);
+		}
 		try {
-			project = RaCoProject::loadFromFile(QString::fromStdString(projectPath), application_, loadContext, true, loadContext.featureLevel);
+			project = RaCoProject::loadFromFile(QString::fromStdString(projectPath), application_, loadContext, true, loadContext.featureLevel, false, objectIDs ? &objectIDs.value() : nullptr);
 			success = true;
 		} catch (application::FutureFileVersion& fileVerError) {
 			LOG_ERROR(log_system::OBJECT_TREE_VIEW, "Can not add Project {} to Project Browser - incompatible file version {} of project file", projectPath, fileVerError.fileVersion_);
@@ -192,6 +421,16 @@ bool ExternalProjectsStore::loadExternalProject(const std::string& projectPath,
 		project = nullptr;
 		success = false;
 	}
+	if (project && fileVersion) {
+		loadedProjectVersions_[projectPath] = fileVersion.value();
+	} else {
+		loadedProjectVersions_.erase(projectPath);
+	}
+	if (project && project->isPartiallyLoaded()) {
+		partialProjectObjects_[projectPath] = std::move(objectIDs.value());
+	} else {
+		partialProjectObjects_.erase(projectPath);
+	}
 	externalProjects_.insert_or_assign(projectPath, std::move(project));
 	application_->dataChangeDispatcher()->setExternalProjectChanged();
 	return success;
@@ -207,6 +446,8 @@ bool ExternalProjectsStore::canRemoveExternalProject(const std::string& projectP
 void ExternalProjectsStore::removeExternalProject(const std::string& projectPath) {
 	if (canRemoveExternalProject(projectPath)) {
 		externalProjects_.erase(externalProjects_.find(projectPath));
+		loadedProjectVersions_.erase(projectPath);
+		partialProjectObjects_.erase(projectPath);
 		externalProjectFileChangeListeners_.erase(projectPath);
 
 		application_->dataChangeDispatcher()->setExternalProjectChanged();
@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "application/FrameScheduler.h"
+
+namespace raco::application {
+
+FrameScheduler::FrameScheduler(std::chrono::milliseconds idleFrameInterval, std::chrono::milliseconds activePeriod)
+	: idleFrameInterval_(idleFrameInterval), activePeriod_(activePeriod) {
+}
+
+void FrameScheduler::setIdleFrameInterval(std::chrono::milliseconds interval) {
+	idleFrameInterval_ = interval;
+}
+
+std::chrono::milliseconds FrameScheduler::idleFrameInterval() const {
+	return idleFrameInterval_;
+}
+
+void FrameScheduler::requestFrame() {
+	frameRequested_ = true;
+}
+
+bool FrameScheduler::shouldRenderFrame(bool hasPendingUpdates, Clock::time_point now) {
+	bool active = hasPendingUpdates || frameRequested_;
+	frameRequested_ = false;
+
+	if (active) {
+		activeUntil_ = now + activePeriod_;
+	}
+
+	if (active || idleFrameInterval_.count() <= 0 || now < activeUntil_ || now - lastFrame_ >= idleFrameInterval_) {
+		lastFrame_ = now;
+		++renderedFrameCount_;
+		return true;
+	}
+	++skippedFrameCount_;
+	return false;
+}
+
+uint64_t FrameScheduler::renderedFrameCount() const {
+	return renderedFrameCount_;
+}
+
+uint64_t FrameScheduler::skippedFrameCount() const {
+	return skippedFrameCount_;
+}
+
+}  // namespace raco::application
@@ -23,6 +23,9 @@
 #include "ramses_adaptor/SceneBackend.h"
 #include "ramses_adaptor/AbstractSceneAdaptor.h"
 #include "ramses_base/BaseEngineBackend.h"
+#include "ramses_base/DecodedImageCache.h"
+#include "ramses_base/LuaScriptInterfaceCache.h"
+#include "ramses_base/ShaderReflectionCache.h"
 #include "user_types/Animation.h"
 
 #include "core/Handles.h"
@@ -65,6 +68,9 @@ RaCoApplication::RaCoApplication(ramses_base::BaseEngineBackend& engine, const R
 	components::RaCoPreferences::init();
 
 	runningInUI_ = settings.runningInUI;
+	externalProjectsStore_.setPartialLoading(settings.partialExternalProjectLoading);
+	externalProjectsStore_.setProjectCaching(settings.cacheExternalProjects);
+	meshCache_.setAsyncLoading(settings.asyncMeshLoading);
 
 	switchActiveRaCoProject(settings.initialProject, {}, settings.createDefaultScene, settings.initialLoadFeatureLevel);
 }
@@ -141,6 +147,8 @@ void RaCoApplication::switchActiveRaCoProject(const QString& file, std::function
 	// The module cache should already by empty after removing the local and external projects but explicitly clear it anyway
 	// to avoid potential problems.
 	engine_->coreInterface()->clearModuleCache();
+	// Decoded images are only validated by file modification time and size: don't carry them over to the next project.
+	ramses_base::DecodedImageCache::instance().clear();
 	dataChangeDispatcher_->assertEmpty();
 
 	core::LoadContext loadContext;
@@ -192,6 +200,7 @@ bool RaCoApplication::saveAsWithNewIDs(const QString& newPath, std::string& outE
 }
 
 core::ErrorLevel RaCoApplication::getExportSceneDescriptionAndStatus(std::vector<core::SceneBackendInterface::SceneItemDesc>& outDescription, std::string& outMessage) {
+	meshCache_.waitForPendingLoads();
 	setupScene(true, false);
 	logicEngineNeedsUpdate_ = true;
 	doOneLoop();
@@ -213,6 +222,8 @@ core::ErrorLevel RaCoApplication::getExportSceneDescriptionAndStatus(std::vector
 }
 
 bool RaCoApplication::exportProject(const std::string& ramsesExport, bool compress, std::string& outError, bool forceExportWithErrors, ELuaSavingMode luaSavingMode, bool warningsAsErrors) {
+	// The exported scene needs to contain all meshes.
+	meshCache_.waitForPendingLoads();
 	setupScene(true, false);
 	logicEngineNeedsUpdate_ = true;
 	doOneLoop();
@@ -276,6 +287,11 @@ bool RaCoApplication::exportProjectImpl(const std::string& ramsesExport, bool co
 	return true;
 }
 
+void RaCoApplication::waitForPendingMeshLoads() {
+	meshCache_.waitForPendingLoads();
+	doOneLoop();
+}
+
 void RaCoApplication::doOneLoop() {
 	// write data into engine
 	if (ramses_adaptor::SceneBackend::toSceneId(*activeRaCoProject().project()->settings()->sceneId_) != previewSceneBackend_->currentSceneId()) {
@@ -283,11 +299,8 @@ void RaCoApplication::doOneLoop() {
 		setupScene(false, false);
 	}
 
-	for (const auto& timerNode : previewSceneBackend_->logicEngine()->getCollection<ramses::TimerNode>()) {
-		if (timerNode->getInputs()->getChild("ticker_us")->get<int64_t>() == 0) {
-			logicEngineNeedsUpdate_ = true;
-			break;
-		}
+	if (hasAutoTickingTimers()) {
+		logicEngineNeedsUpdate_ = true;
 	}
 
 	int64_t elapsedMsec;
@@ -300,6 +313,10 @@ void RaCoApplication::doOneLoop() {
 
 	activeProject_->tracePlayer().refresh(elapsedMsec);
 
+	// Updates the Mesh objects whose files have been loaded in the background.
+	meshCache_.processFinishedLoads();
+
+	bool statisticsChanged = false;
 	auto dataChanges = activeProject_->recorder()->release();
 	dataChangeDispatcherPreviewScene_->dispatch(dataChanges);
 	if (logicEngineNeedsUpdate_ || !dataChanges.getAllChangedObjects(true, true, true).empty() || !dataChanges.getDeletedObjects().empty()) {
@@ -316,15 +333,55 @@ void RaCoApplication::doOneLoop() {
 
 		if (recordingStats_) {
 			logicStats_.addSnapshot(previewSceneBackend_->getPerformanceReport());
-			Q_EMIT performanceStatisticsUpdated();
+			statisticsChanged = true;
 		}
 	}
 
 	dataChangeDispatcherAbstractScene_->dispatch(dataChanges);
 
+	if (updateCacheStats()) {
+		statisticsChanged = true;
+	}
+	if (statisticsChanged) {
+		Q_EMIT performanceStatisticsUpdated();
+	}
+
 	dataChangeDispatcher_->dispatch(dataChanges);
 }
 
+bool RaCoApplication::updateCacheStats() {
+	const auto toCacheStatistics = [](const auto& stats) {
+		return CacheStatistics{stats.hits, stats.misses, stats.entryCount};
+	};
+	auto shaderCacheStats = toCacheStatistics(ramses_base::ShaderReflectionCache::instance().statistics());
+	auto luaScriptCacheStats = toCacheStatistics(ramses_base::LuaScriptInterfaceCache::instance().statistics());
+	if (shaderCacheStats == shaderCacheStats_ && luaScriptCacheStats == luaScriptCacheStats_) {
+		return false;
+	}
+	shaderCacheStats_ = shaderCacheStats;
+	luaScriptCacheStats_ = luaScriptCacheStats;
+	return true;
+}
+
+bool RaCoApplication::hasAutoTickingTimers() const {
+	for (const auto& timerNode : previewSceneBackend_->logicEngine()->getCollection<ramses::TimerNode>()) {
+		if (timerNode->getInputs()->getChild("ticker_us")->get<int64_t>() == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool RaCoApplication::hasPendingUpdates() const {
+	return rendererDirty_ ||
+		   logicEngineNeedsUpdate_ ||
+		   !activeProject_->recorder()->empty() ||
+		   ramses_adaptor::SceneBackend::toSceneId(*activeProject_->project()->settings()->sceneId_) != previewSceneBackend_->currentSceneId() ||
+		   activeProject_->tracePlayer().getState() == components::TracePlayer::PlayerState::Playing ||
+		   meshCache_.hasPendingLoads() ||
+		   hasAutoTickingTimers();
+}
+
 bool RaCoApplication::canSaveActiveProject() const {
 	for (auto item : activeProject_->project()->externalProjectsMap()) {
 		auto absPath = activeProject_->project()->lookupExternalProjectPath(item.first);
@@ -421,6 +478,9 @@ void RaCoApplication::setRecordingStats(bool enable) {
 
 void RaCoApplication::resetStats() {
 	logicStats_ = ReportStatistics{};
+	ramses_base::ShaderReflectionCache::instance().resetStatistics();
+	ramses_base::LuaScriptInterfaceCache::instance().resetStatistics();
+	updateCacheStats();
 	Q_EMIT performanceStatisticsUpdated();
 }
 
@@ -428,11 +488,19 @@ const ReportStatistics& RaCoApplication::getLogicStats() const {
 	return logicStats_;
 }
 
+const CacheStatistics& RaCoApplication::getShaderCacheStats() const {
+	return shaderCacheStats_;
+}
+
+const CacheStatistics& RaCoApplication::getLuaScriptCacheStats() const {
+	return luaScriptCacheStats_;
+}
+
 core::ExternalProjectsStoreInterface* RaCoApplication::externalProjects() {
 	return &externalProjectsStore_;
 }
 
-core::MeshCache* RaCoApplication::meshCache() {
+components::MeshCacheImpl* RaCoApplication::meshCache() {
 	return &meshCache_;
 }
 
@@ -9,6 +9,7 @@
  */
 #include "application/RaCoProject.h"
 
+#include "core/BinarySerialization.h"
 #include "core/Consistency.h"
 #include "core/Context.h"
 #include "core/ExtrefOperations.h"
@@ -52,27 +53,70 @@
 #include <QTextStream>
 
 #include <algorithm>
+#include <fstream>
 #include <functional>
+#include <iterator>
+#include <optional>
+#include <sstream>
 
 
 namespace raco::application {
 
 using namespace raco::core;
 
+namespace {
+
+// The object index is an optimization only: failing to write it doesn't fail the save.
+void saveProjectObjectIndex(const std::string& projectPath, const serialization::ProjectObjectIndex& index) {
+	auto indexPath = serialization::ProjectObjectIndex::indexFilePath(projectPath);
+	std::ofstream indexFile(utils::u8path(indexPath).internalPath(), std::ios::out | std::ios::binary | std::ios::trunc);
+	indexFile << index.serialize();
+	if (!indexFile) {
+		LOG_WARNING(log_system::PROJECT, "Could not write object index file {}", indexPath);
+	}
+}
+
+// @return the object index of the project file if it exists and matches the current file content
+std::optional<serialization::ProjectObjectIndex> loadProjectObjectIndex(const std::string& projectPath) {
+	auto indexPath = utils::u8path(serialization::ProjectObjectIndex::indexFilePath(projectPath));
+	if (!indexPath.existsFile()) {
+		return std::nullopt;
+	}
+	std::ifstream indexFile(indexPath.internalPath(), std::ios::in | std::ios::binary);
+	std::string indexData{std::istreambuf_iterator<char>(indexFile), std::istreambuf_iterator<char>()};
+	auto index = serialization::ProjectObjectIndex::deserialize(indexData);
+	if (!index) {
+		LOG_WARNING(log_system::PROJECT, "Ignoring invalid object index file {}", indexPath.string());
+		return std::nullopt;
+	}
+
+	std::ifstream projectFile(utils::u8path(projectPath).internalPath(), std::ios::in | std::ios::binary);
+	if (serialization::ProjectObjectIndex::hashFileContent(projectFile) != index->fileHash) {
+		LOG_INFO(log_system::PROJECT, "Ignoring outdated object index file {}", indexPath.string());
+		return std::nullopt;
+	}
+	return index;
+}
+
+}  // namespace
+
 RaCoProject::RaCoProject(const QString& file, Project& p, EngineInterface* engineInterface, const UndoStack::Callback& callback, ExternalProjectsStoreInterface* externalProjectsStore, RaCoApplication* app, LoadContext& loadContext, int fileVersion)
 	: recorder_{},
 	  errors_{&recorder_},
 	  project_{p},
 	  context_{std::make_shared<BaseContext>(&project_, engineInterface, &user_types::UserObjectFactory::getInstance(), &recorder_, &errors_)},
-	  undoStack_(context_.get(), [this, callback]() {
-		  dirty_ = true;
-		  callback();
-	  }),
+	  undoStack_(
+		  context_.get(), [this, callback]() {
+			  dirty_ = true;
+			  callback();
+		  },
+		  components::RaCoPreferences::instance().undoStackDeltaStorage ? UndoStack::StorageMode::Delta : UndoStack::StorageMode::Snapshot),
 	  commandInterface_(context_.get(), &undoStack_),
 	  meshCache_{app->meshCache()} {
 	context_->setMeshCache(meshCache_);
 	context_->setExternalProjectsStore(externalProjectsStore);
 	context_->setUriValidationCaseSensitive(components::RaCoPreferences::instance().isUriValidationCaseSensitive);
+	applyUndoStackBudget();
 
 	// Abort file loading if we encounter external reference RenderPasses or extref cameras outside a Prefab.
 	// A bug in V0.9.0 allowed to create such projects.
@@ -322,7 +366,9 @@ std::unique_ptr<RaCoProject> RaCoProject::createNew(RaCoApplication* app, bool c
 	return result;
 }
 
-QJsonDocument RaCoProject::loadJsonDocument(const QString& filename) {
+namespace {
+
+QString checkProjectFile(const QString& filename) {
 	QFileInfo path(filename);
 	QString absPath = path.absoluteFilePath();
 	if (path.suffix().compare(names::PROJECT_FILE_EXTENSION, Qt::CaseInsensitive) != 0) {
@@ -336,6 +382,13 @@ QJsonDocument RaCoProject::loadJsonDocument(const QString& filename) {
 	if (!utils::u8path(absPath.toStdString()).userHasReadAccess()) {
 		throw std::runtime_error(fmt::format("Project file could not be read {}", absPath.toLatin1()));
 	}
+	return absPath;
+}
+
+}  // namespace
+
+QJsonDocument RaCoProject::loadJsonDocument(const QString& filename) {
+	QString absPath = checkProjectFile(filename);
 
 	QFile file{absPath};
 	if (!file.open(QIODevice::ReadOnly)) {
@@ -349,6 +402,14 @@ QJsonDocument RaCoProject::loadJsonDocument(const QString& filename) {
 		throw std::runtime_error(fmt::format("File {} has invalid content", absPath.toLatin1()));
 	}
 
+	if (serialization::isBinaryProject({fileContents.constData(), static_cast<size_t>(fileContents.size())})) {
+		try {
+			return serialization::convertBinaryToJson({fileContents.constData(), static_cast<size_t>(fileContents.size())});
+		} catch (const std::runtime_error& e) {
+			throw std::runtime_error(fmt::format("Can't read binary project file {}:\n{}", absPath.toLatin1(), e.what()));
+		}
+	}
+
 	if (utils::zip::isZipFile({fileContents.begin(), fileContents.begin() + 4})) {
 		auto unzippedProj = utils::zip::zipToProject(fileContents, fileContents.size());
 
@@ -367,33 +428,127 @@ QJsonDocument RaCoProject::loadJsonDocument(const QString& filename) {
 	return document;
 }
 
+std::unique_ptr<std::istream> RaCoProject::openProjectFile(const QString& filename) {
+	QString absPath = checkProjectFile(filename);
+
+	auto file = std::make_unique<std::ifstream>(utils::u8path(absPath.toStdString()).internalPath(), std::ios::in | std::ios::binary);
+	if (!file->is_open()) {
+		throw std::runtime_error(fmt::format("Error opening file {}", absPath.toLatin1()));
+	}
+
+	std::string magic(4, '\0');
+	if (!file->read(magic.data(), magic.size())) {
+		throw std::runtime_error(fmt::format("File {} has invalid content", absPath.toLatin1()));
+	}
+
+	if (utils::zip::isZipFile(magic)) {
+		// Zipped projects need to be unpacked in memory
+		file->seekg(0);
+		std::string fileContents{std::istreambuf_iterator<char>(*file), std::istreambuf_iterator<char>()};
+		auto unzippedProj = utils::zip::zipToProject(fileContents.data(), static_cast<int>(fileContents.size()));
+
+		if (unzippedProj.success) {
+			return std::make_unique<std::istringstream>(std::move(unzippedProj.payload));
+		} else {
+			throw std::runtime_error(fmt::format("Can't read zipped file {}:\n{}", absPath.toLatin1(), unzippedProj.payload));
+		}
+	}
+
+	file->seekg(0);
+	return file;
+}
+
+QJsonDocument RaCoProject::loadProjectHeader(const QString& filename) {
+	auto stream = openProjectFile(filename);
+	std::string magic(4, '\0');
+	stream->read(magic.data(), magic.size());
+	stream->clear();
+	stream->seekg(0);
+
+	if (serialization::isBinaryProject(magic)) {
+		std::string fileContents{std::istreambuf_iterator<char>(*stream), std::istreambuf_iterator<char>()};
+		return serialization::decodeBinaryProjectHeader(fileContents);
+	}
+	return serialization::deserializeProjectHeader(*stream).document;
+}
+
 int RaCoProject::preloadFeatureLevel(const QString& filename, int featureLevel) {
 	LOG_INFO(log_system::PROJECT, "Loading project from {}", filename.toLatin1());
 
-	auto document = loadJsonDocument(filename);
+	auto header = loadProjectHeader(filename);
 
-	auto fileFeatureLevel = serialization::deserializeFeatureLevel(document);
+	auto fileFeatureLevel = serialization::deserializeFeatureLevel(header);
 
 	return std::max(static_cast<int>(fileFeatureLevel), featureLevel);
 }
 
-std::unique_ptr<RaCoProject> RaCoProject::loadFromFile(const QString& filename, RaCoApplication* app, LoadContext& loadContext, bool logErrors, int featureLevel, bool generateNewObjectIDs) {
+std::unique_ptr<RaCoProject> RaCoProject::loadFromFile(const QString& filename, RaCoApplication* app, LoadContext& loadContext, bool logErrors, int featureLevel, bool generateNewObjectIDs, const std::set<std::string>* requiredObjectIDs) {
 	LOG_INFO(log_system::PROJECT, "Loading project from {}", filename.toLatin1());
 
 	QFileInfo path(filename);
 	QString absPath = path.absoluteFilePath();
 
-	auto document = loadJsonDocument(filename);
+	auto checkFileVersion = [](const QJsonDocument& header) {
+		auto fileVersion{serialization::deserializeFileVersion(header)};
+		if (fileVersion > serialization::RAMSES_PROJECT_FILE_VERSION) {
+			throw FutureFileVersion{fileVersion};
+		}
+		if (fileVersion == 0) {
+			throw std::runtime_error("File is not a RamsesComposer file.");
+		}
+		return fileVersion;
+	};
 
-	auto fileVersion{serialization::deserializeFileVersion(document)};
-	if (fileVersion > serialization::RAMSES_PROJECT_FILE_VERSION) {
-		throw FutureFileVersion{fileVersion};
-	}
-	if (fileVersion == 0) {
-		throw std::runtime_error("File is not a RamsesComposer file.");
+	std::optional<serialization::ProjectObjectSelection> selection;
+	if (requiredObjectIDs) {
+		if (auto index = loadProjectObjectIndex(absPath.toStdString())) {
+			selection = index->select(*requiredObjectIDs);
+			LOG_INFO(log_system::PROJECT, "Partially loading project: {} of {} objects needed", std::count(selection->instances.begin(), selection->instances.end(), true), selection->instances.size());
+		}
 	}
+	const auto* selectionPtr = selection ? &selection.value() : nullptr;
+
+	auto stream = openProjectFile(filename);
+	std::string magic(4, '\0');
+	stream->read(magic.data(), magic.size());
+	stream->clear();
+	stream->seekg(0);
+
+	int fileVersion;
+	auto fileFormat = FileFormat::Json;
+	serialization::ProjectDeserializationInfo result;
+	if (serialization::isBinaryProject(magic)) {
+		std::string fileContents{std::istreambuf_iterator<char>(*stream), std::istreambuf_iterator<char>()};
+		stream.reset();
+
+		serialization::BinaryProjectContent content;
+		try {
+			content = serialization::decodeBinaryProject(fileContents, selectionPtr);
+		} catch (const std::runtime_error& e) {
+			throw std::runtime_error(fmt::format("Can't read binary project file {}:\n{}", absPath.toLatin1(), e.what()));
+		}
+		fileContents.clear();
 
-	auto result{serialization::deserializeProject(document, absPath.toStdString())};
+		fileVersion = checkFileVersion(content.header);
+		result = serialization::deserializeProject(content.header, content.instances, content.links, absPath.toStdString());
+		fileFormat = FileFormat::Binary;
+	} else {
+		serialization::ProjectFileHeader header;
+		try {
+			header = serialization::deserializeProjectHeader(*stream);
+		} catch (const std::runtime_error&) {
+			throw std::runtime_error("Loading JSON file resulted in a null document object");
+		}
+
+		fileVersion = checkFileVersion(header.document);
+		if (fileVersion < 23) {
+			// Files needing the JSON migration to file version 23 are always loaded completely.
+			selection.reset();
+			selectionPtr = nullptr;
+		}
+		result = serialization::deserializeProject(*stream, header, absPath.toStdString(), selectionPtr);
+		stream.reset();
+	}
 
 	for (const auto& instance : result.objects) {
 		instance->onAfterDeserialization();
@@ -448,6 +603,9 @@ std::unique_ptr<RaCoProject> RaCoProject::loadFromFile(const QString& filename,
 		loadContext,
 		fileVersion};
 
+	newProject->fileFormat_ = fileFormat;
+	newProject->partiallyLoaded_ = selection.has_value();
+
 	for (const auto& [objectID, infoMessage] : result.migrationObjWarnings) {
 		if (const auto migratedObj = newProject->project()->getInstanceByID(objectID)) {
 			newProject->errors()->addError(core::ErrorCategory::MIGRATION, ErrorLevel::WARNING, migratedObj, infoMessage);
@@ -476,7 +634,7 @@ std::string RaCoProject::pythonOnSaveScriptPath() {
 	return project_.settings()->pythonOnSaveScript_.asString();
 }
 
-QJsonDocument RaCoProject::serializeProjectData(const std::unordered_map<std::string, std::vector<int>>& currentVersions) {
+QJsonDocument RaCoProject::serializeProjectData(const std::unordered_map<std::string, std::vector<int>>& currentVersions, serialization::ProjectObjectIndex* outIndex) {
 	// Create instances in serialization order:
 	// - non-resource top-level nodes appear in the order of the instance pool
 	//   this is needed to ensure preservation of the top-level scenegraph order
@@ -501,6 +659,10 @@ QJsonDocument RaCoProject::serializeProjectData(const std::unordered_map<std::st
 		return LinkDescriptor::lessThanByObjectID(left->descriptor(), right->descriptor());
 	});
 
+	if (outIndex) {
+		*outIndex = serialization::ProjectObjectIndex::create(instances, links);
+	}
+
 	std::vector<std::shared_ptr<ReflectionInterface>> instancesInterface{instances.begin(), instances.end()};
 	std::vector<std::shared_ptr<ReflectionInterface>> linksInterface{links.begin(), links.end()};
 
@@ -511,7 +673,7 @@ QJsonDocument RaCoProject::serializeProjectData(const std::unordered_map<std::st
 		project_.externalProjectsMap());
 }
 
-QJsonDocument RaCoProject::serializeProject(const std::unordered_map<std::string, std::vector<int>>& currentVersions) {
+QJsonDocument RaCoProject::serializeProject(const std::unordered_map<std::string, std::vector<int>>& currentVersions, serialization::ProjectObjectIndex* outIndex) {
 	// On discarding objects during save
 	// - we discard all objects which can not be recreated by the external reference and/or prefab update during load.
 	//
@@ -654,7 +816,7 @@ QJsonDocument RaCoProject::serializeProject(const std::unordered_map<std::string
 	}
 
 
-	auto serializedJson = serializeProjectData(currentVersions);
+	auto serializedJson = serializeProjectData(currentVersions, outIndex);
 
 
 	// Check for non-recoverable data loss arising from the object deletions above
@@ -691,7 +853,7 @@ QJsonDocument RaCoProject::serializeProject(const std::unordered_map<std::string
 #ifdef NDEBUG
 	// If optimization leads to data loss, return unoptimized json instead:
 	if (lostData) {
-		serializedJson = serializeProjectData(currentVersions);
+		serializedJson = serializeProjectData(currentVersions, outIndex);
 	}
 #else
 	// In a debug build data loss will abort to allow the unit tests to have a chance at detecting problems.
@@ -704,13 +866,19 @@ QJsonDocument RaCoProject::serializeProject(const std::unordered_map<std::string
 bool RaCoProject::save(std::string& outError) {
 	outError.clear();
 	const auto path(project_.currentPath());
+	if (partiallyLoaded_) {
+		outError = fmt::format("Saving project failed: project {} has only been loaded partially.", path);
+		LOG_ERROR(log_system::PROJECT, outError);
+		return false;
+	}
 	LOG_INFO(log_system::PROJECT, "Saving project to {}", path);
 	QFile file{path.c_str()};
 	auto settings = project_.settings();
-	auto saveAsZip = *settings->saveAsZip_;
-	auto flags = (saveAsZip) ? QIODevice::WriteOnly : QIODevice::WriteOnly | QIODevice::Text;
+	auto saveAsBinary = fileFormat_ == FileFormat::Binary;
+	auto saveAsZip = !saveAsBinary && *settings->saveAsZip_;
+	auto writeObjectIndex = components::RaCoPreferences::instance().writeProjectObjectIndex;
 
-	if (!file.open(flags)) {
+	if (!file.open(QIODevice::WriteOnly)) {
 		std::string msg = fmt::format("Saving project failed: Could not open file for writing: {} FileError {} {}", path, file.error(), file.errorString().toStdString());
 		LOG_ERROR(log_system::PROJECT, msg);
 		outError = msg;
@@ -723,7 +891,22 @@ bool RaCoProject::save(std::string& outError) {
 		{serialization::keys::FILE_VERSION, {serialization::RAMSES_PROJECT_FILE_VERSION}},
 		{serialization::keys::RAMSES_VERSION, {ramsesVersion.major, ramsesVersion.minor, ramsesVersion.patch}},
 		{serialization::keys::RAMSES_COMPOSER_VERSION, {RACO_VERSION_MAJOR, RACO_VERSION_MINOR, RACO_VERSION_PATCH}}};
-	auto projectFileData = serializeProject(currentVersions).toJson();
+	QByteArray projectFileData;
+	serialization::ProjectObjectIndex objectIndex;
+	auto objectIndexPtr = writeObjectIndex ? &objectIndex : nullptr;
+	if (saveAsBinary) {
+		auto binaryData = serialization::convertJsonToBinary(serializeProject(currentVersions, objectIndexPtr));
+		projectFileData = QByteArray(binaryData.data(), static_cast<int>(binaryData.size()));
+	} else {
+		projectFileData = serializeProject(currentVersions, objectIndexPtr).toJson();
+#if defined(_WIN32)
+		// Translate the line endings here instead of opening the file with QIODevice::Text
+		// so that the object index hash is computed over the bytes actually written to disk.
+		if (!saveAsZip) {
+			projectFileData.replace("\n", "\r\n");
+		}
+#endif
+	}
 
 	if (saveAsZip) {
 		auto zippedFile = (utils::zip::projectToZip(projectFileData.constData(), (project_.currentFileName() + ".json").c_str()));
@@ -746,6 +929,11 @@ bool RaCoProject::save(std::string& outError) {
 	}
 	file.close();
 
+	if (writeObjectIndex) {
+		objectIndex.fileHash = serialization::ProjectObjectIndex::hashFileContent({projectFileData.constData(), static_cast<size_t>(projectFileData.size())});
+		saveProjectObjectIndex(path, objectIndex);
+	}
+
 	lastModifiedTime_ = std::filesystem::last_write_time(path);
 
 	generateAllProjectSubfolders();
@@ -794,6 +982,18 @@ bool RaCoProject::dirty() const noexcept {
 	return dirty_;
 }
 
+bool RaCoProject::isPartiallyLoaded() const {
+	return partiallyLoaded_;
+}
+
+RaCoProject::FileFormat RaCoProject::fileFormat() const {
+	return fileFormat_;
+}
+
+void RaCoProject::setFileFormat(FileFormat format) {
+	fileFormat_ = format;
+}
+
 void RaCoProject::updateExternalReferences(core::LoadContext& loadContext) {
 	context_->updateExternalReferences(loadContext);
 }
@@ -834,9 +1034,15 @@ components::TracePlayer& RaCoProject::tracePlayer() {
 	return *tracePlayer_;
 }
 
-void RaCoProject::applyPreferences() const {
+void RaCoProject::applyPreferences() {
 	context_->setUriValidationCaseSensitive(components::RaCoPreferences::instance().isUriValidationCaseSensitive);
 	context_->performExternalFileReload(project_.instances());
+	applyUndoStackBudget();
+}
+
+void RaCoProject::applyUndoStackBudget() {
+	const auto& prefs = components::RaCoPreferences::instance();
+	undoStack_.setMemoryBudget(static_cast<size_t>(prefs.undoStackMaxEntries), static_cast<size_t>(prefs.undoStackMemoryLimitMB) * 1024 * 1024);
 }
 
 }  // namespace raco::application
\ No newline at end of file
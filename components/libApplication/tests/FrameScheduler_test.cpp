@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "application/FrameScheduler.h"
+
+#include <gtest/gtest.h>
+
+using namespace raco::application;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Run the scheduler for the given number of 17 ms ticks and return the number of rendered frames.
+int tick(FrameScheduler& scheduler, FrameScheduler::Clock::time_point& now, int count, bool hasPendingUpdates = false) {
+	int rendered = 0;
+	for (int i = 0; i < count; i++) {
+		now += 17ms;
+		if (scheduler.shouldRenderFrame(hasPendingUpdates, now)) {
+			rendered++;
+		}
+	}
+	return rendered;
+}
+
+}  // namespace
+
+TEST(FrameSchedulerTest, first_frame_is_rendered) {
+	FrameScheduler scheduler{500ms, 100ms};
+	FrameScheduler::Clock::time_point now{};
+	EXPECT_EQ(tick(scheduler, now, 1), 1);
+	EXPECT_EQ(scheduler.renderedFrameCount(), 1);
+	EXPECT_EQ(scheduler.skippedFrameCount(), 0);
+}
+
+TEST(FrameSchedulerTest, idle_renders_at_idle_interval) {
+	FrameScheduler scheduler{500ms, 100ms};
+	FrameScheduler::Clock::time_point now{};
+	tick(scheduler, now, 10);
+
+	// 17 * 30 = 510 ms
+	EXPECT_EQ(tick(scheduler, now, 30), 1);
+	EXPECT_EQ(tick(scheduler, now, 30), 1);
+	EXPECT_EQ(scheduler.renderedFrameCount() + scheduler.skippedFrameCount(), 70);
+}
+
+TEST(FrameSchedulerTest, pending_updates_render_every_tick) {
+	FrameScheduler scheduler{500ms, 100ms};
+	FrameScheduler::Clock::time_point now{};
+	tick(scheduler, now, 10);
+
+	EXPECT_EQ(tick(scheduler, now, 20, true), 20);
+}
+
+TEST(FrameSchedulerTest, requested_frame_keeps_rendering_for_active_period) {
+	FrameScheduler scheduler{500ms, 100ms};
+	FrameScheduler::Clock::time_point now{};
+	tick(scheduler, now, 30);
+
+	scheduler.requestFrame();
+	// Requested frame and the frames within the following 100 ms
+	EXPECT_EQ(tick(scheduler, now, 10), 6);
+}
+
+TEST(FrameSchedulerTest, zero_idle_interval_renders_every_tick) {
+	FrameScheduler scheduler{0ms, 100ms};
+	FrameScheduler::Clock::time_point now{};
+	EXPECT_EQ(tick(scheduler, now, 50), 50);
+	EXPECT_EQ(scheduler.skippedFrameCount(), 0);
+
+	scheduler.setIdleFrameInterval(500ms);
+	EXPECT_EQ(tick(scheduler, now, 50), 1);
+}
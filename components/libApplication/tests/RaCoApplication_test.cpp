@@ -967,3 +967,23 @@ TEST_F(RaCoApplicationFixture, add_external_project_no_such_file) {
 	EXPECT_TRUE(application.externalProjects()->isExternalProject((test_path() / "no-such-file.rca").string()));
 	EXPECT_TRUE(application.externalProjects()->getExternalProject((test_path() / "no-such-file.rca").string()) == nullptr);
 }
+
+TEST_F(RaCoApplicationFixture, cacheStatsAreUpdatedByLoopAndReset) {
+	auto commandInterface = application.activeRaCoProject().commandInterface();
+	application.resetStats();
+
+	for (int i = 0; i < 2; ++i) {
+		auto script = commandInterface->createObject(user_types::LuaScript::typeDescription.typeName);
+		commandInterface->set(core::ValueHandle{script, {"uri"}}, test_path().append("scripts/SimpleScript.lua").string());
+	}
+	application.doOneLoop();
+
+	const auto& luaScriptStats = application.getLuaScriptCacheStats();
+	EXPECT_GE(luaScriptStats.hits, 1);
+	EXPECT_GE(luaScriptStats.hits + luaScriptStats.misses, 2);
+	EXPECT_GE(luaScriptStats.entryCount, 1);
+
+	application.resetStats();
+	EXPECT_EQ(application.getLuaScriptCacheStats().hits, 0);
+	EXPECT_EQ(application.getLuaScriptCacheStats().misses, 0);
+}
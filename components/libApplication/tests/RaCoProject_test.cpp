@@ -13,8 +13,12 @@
 #include "application/RaCoProject.h"
 #include "components/RaCoNameConstants.h"
 #include "components/RaCoPreferences.h"
+#include "core/BinarySerialization.h"
 #include "core/PathManager.h"
+#include "core/ProjectMigration.h"
+#include "core/ProjectObjectIndex.h"
 #include "core/Queries.h"
+#include "core/Serialization.h"
 #include "ramses_adaptor/SceneBackend.h"
 #include "ramses_base/BaseEngineBackend.h"
 #include "spdlog/sinks/base_sink.h"
@@ -781,6 +785,96 @@ TEST_F(RaCoProjectFixture, saveLoadAsZip) {
 	}
 }
 
+TEST_F(RaCoProjectFixture, saveLoadBinaryKeepsLinksAndFormat) {
+	{
+		auto linkedScene = createLinkedScene(*application.activeRaCoProject().commandInterface(), test_path());
+		auto lua = std::get<user_types::SLuaScript>(linkedScene);
+		const auto node{application.activeRaCoProject().commandInterface()->createObject(user_types::Node::typeDescription.typeName, "node")};
+		application.activeRaCoProject().commandInterface()->addLink({lua, {"outputs", "translation"}}, {node, {"translation"}});
+		application.activeRaCoProject().setFileFormat(application::RaCoProject::FileFormat::Binary);
+
+		std::string msg;
+		ASSERT_TRUE(application.activeRaCoProject().saveAs((test_path() / "project.rca").string().c_str(), msg));
+	}
+	ASSERT_TRUE(serialization::isBinaryProject(utils::file::read(test_path() / "project.rca")));
+	{
+		application.switchActiveRaCoProject(QString::fromStdString((test_path() / "project.rca").string()), {});
+		ASSERT_EQ(application.activeRaCoProject().fileFormat(), application::RaCoProject::FileFormat::Binary);
+		ASSERT_EQ(4, application.activeRaCoProject().project()->instances().size());
+		ASSERT_EQ(2, application.activeRaCoProject().project()->links().size());
+
+		auto document = application::RaCoProject::loadJsonDocument(QString::fromStdString((test_path() / "project.rca").string()));
+		ASSERT_EQ(serialization::deserializeFileVersion(document), serialization::RAMSES_PROJECT_FILE_VERSION);
+
+		application.activeRaCoProject().setFileFormat(application::RaCoProject::FileFormat::Json);
+		std::string msg;
+		ASSERT_TRUE(application.activeRaCoProject().saveAs((test_path() / "project.json.rca").string().c_str(), msg));
+		ASSERT_EQ(QJsonDocument::fromJson(QByteArray::fromStdString(utils::file::read(test_path() / "project.json.rca"))), document);
+	}
+}
+
+TEST_F(RaCoProjectFixture, undoStackDeltaStoragePreference) {
+	components::RaCoPreferences::instance().undoStackDeltaStorage = true;
+	application.switchActiveRaCoProject(QString(), {});
+	auto undoStack = application.activeRaCoProject().undoStack();
+	ASSERT_EQ(undoStack->storageMode(), core::UndoStack::StorageMode::Delta);
+
+	auto node = application.activeRaCoProject().commandInterface()->createObject(user_types::Node::typeDescription.typeName, "node");
+	application.activeRaCoProject().commandInterface()->set({node, {"translation", "x"}}, 2.0);
+	undoStack->undo();
+	EXPECT_EQ(core::ValueHandle(node, {"translation", "x"}).asDouble(), 0.0);
+	undoStack->redo();
+	EXPECT_EQ(core::ValueHandle(node, {"translation", "x"}).asDouble(), 2.0);
+
+	components::RaCoPreferences::instance().undoStackDeltaStorage = false;
+	application.switchActiveRaCoProject(QString(), {});
+	EXPECT_EQ(application.activeRaCoProject().undoStack()->storageMode(), core::UndoStack::StorageMode::Snapshot);
+}
+
+TEST_F(RaCoProjectFixture, saveDoesntWriteObjectIndexIfDisabled) {
+	components::RaCoPreferences::instance().writeProjectObjectIndex = false;
+	std::string msg;
+	ASSERT_TRUE(application.activeRaCoProject().saveAs((test_path() / "project.rca").string().c_str(), msg));
+	EXPECT_FALSE(utils::u8path(serialization::ProjectObjectIndex::indexFilePath((test_path() / "project.rca").string())).existsFile());
+	components::RaCoPreferences::instance().writeProjectObjectIndex = true;
+}
+
+TEST_F(RaCoProjectFixture, saveWritesObjectIndexForPartialLoading) {
+	components::RaCoPreferences::instance().writeProjectObjectIndex = true;
+	std::string nodeID;
+	{
+		auto linkedScene = createLinkedScene(*application.activeRaCoProject().commandInterface(), test_path());
+		auto lua = std::get<user_types::SLuaScript>(linkedScene);
+		nodeID = std::get<user_types::SNode>(linkedScene)->objectID();
+		const auto otherNode{application.activeRaCoProject().commandInterface()->createObject(user_types::Node::typeDescription.typeName, "other_node")};
+		application.activeRaCoProject().commandInterface()->addLink({lua, {"outputs", "translation"}}, {otherNode, {"translation"}});
+		application.activeRaCoProject().commandInterface()->createObject(user_types::Node::typeDescription.typeName, "unused_node");
+
+		std::string msg;
+		ASSERT_TRUE(application.activeRaCoProject().saveAs((test_path() / "project.rca").string().c_str(), msg));
+	}
+	auto projectPath = (test_path() / "project.rca").string();
+	auto index = serialization::ProjectObjectIndex::deserialize(utils::file::read(serialization::ProjectObjectIndex::indexFilePath(projectPath)));
+	ASSERT_TRUE(index.has_value());
+	EXPECT_EQ(index->fileHash, serialization::ProjectObjectIndex::hashFileContent(utils::file::read(projectPath)));
+	EXPECT_EQ(index->objects.size(), application.activeRaCoProject().project()->instances().size());
+	EXPECT_EQ(index->links.size(), 2);
+
+	core::LoadContext loadContext;
+	std::set<std::string> requiredObjectIDs{nodeID};
+	auto partialProject = application::RaCoProject::loadFromFile(QString::fromStdString(projectPath), &application, loadContext, false, -1, false, &requiredObjectIDs);
+	ASSERT_TRUE(partialProject->isPartiallyLoaded());
+	// ProjectSettings, the node and the LuaScript linked to it
+	EXPECT_EQ(partialProject->project()->instances().size(), 3);
+	EXPECT_TRUE(core::Queries::findByName(partialProject->project()->instances(), "lua_script") != nullptr);
+	EXPECT_TRUE(core::Queries::findByName(partialProject->project()->instances(), "other_node") == nullptr);
+	EXPECT_EQ(partialProject->project()->links().size(), 1);
+
+	std::string msg;
+	EXPECT_FALSE(partialProject->save(msg));
+	EXPECT_FALSE(msg.empty());
+}
+
 TEST_F(RaCoProjectFixture, saveLoadRotationLinksGetReinstated) {
 	{
 		auto linkedScene = createLinkedScene(*application.activeRaCoProject().commandInterface(), test_path());
@@ -11,8 +11,13 @@
 
 #include "core/Context.h"
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace raco::components {
@@ -58,6 +63,54 @@ private:
 	DeregisterCallback deregisterFunc_;
 };
 
+/**
+ * @brief Weak references to the listeners registered for one notification source.
+ *
+ * Listeners of destroyed subscriptions are not removed immediately: they are skipped by forEach once expired and
+ * removed by compact(). Listeners are only appended while iterating so that the positions stay stable during a dispatch.
+ */
+template <typename Listener>
+class ListenerList {
+public:
+	void add(const std::shared_ptr<Listener>& listener) {
+		listeners_.emplace_back(listener);
+	}
+
+	// Call func for the alive listeners among the first count listeners.
+	// Listeners added by func are only visited if they are within the first count listeners.
+	template <typename Func>
+	void forEach(Func&& func, size_t count = std::numeric_limits<size_t>::max()) const {
+		count = std::min(count, listeners_.size());
+		for (size_t index = 0; index < count; index++) {
+			if (auto listener = listeners_[index].lock()) {
+				func(listener);
+			}
+		}
+	}
+
+	// Remove the expired listeners
+	// @return number of removed listeners
+	size_t compact() {
+		auto it = std::remove_if(listeners_.begin(), listeners_.end(), [](const auto& listener) {
+			return listener.expired();
+		});
+		size_t removed = std::distance(it, listeners_.end());
+		listeners_.erase(it, listeners_.end());
+		return removed;
+	}
+
+	size_t size() const {
+		return listeners_.size();
+	}
+
+	bool empty() const {
+		return listeners_.empty();
+	}
+
+private:
+	std::vector<std::weak_ptr<Listener>> listeners_;
+};
+
 class LinkLifecycleListener;
 class LinkListener;
 class ObjectLifecycleListener;
@@ -132,6 +185,12 @@ public:
 	void addBulkChangeCallback(uint64_t ID, BulkChangeCallback callback);
 	void removeBulkChangeCallback(uint64_t ID);
 
+	/**
+	 * @brief Notify the listeners about the changes recorded in dataChanges.
+	 *
+	 * Listeners registered with registerOn(ValueHandle, Callback) are notified at most once per dispatch. Listeners
+	 * receiving a ValueHandle are notified once for every changed property they are registered for.
+	 */
 	void dispatch(const core::DataChangeRecorder& dataChanges);
 
 	void assertEmpty();
@@ -145,7 +204,25 @@ public:
 	}
 
 private:
-	void emitUpdateFor(const std::map<std::string, std::set<core::ValueHandle>>& valueHandles) const;
+	struct PropertyPathHash {
+		size_t operator()(const std::vector<size_t>& indices) const noexcept;
+	};
+
+	// Listeners indexed by the object and the property indices of the value handle they are registered on.
+	template <typename Listener>
+	using PropertyListenerIndex = std::unordered_map<const core::EditorObject*, std::unordered_map<std::vector<size_t>, ListenerList<Listener>, PropertyPathHash>>;
+
+	template <typename Listener>
+	using ObjectListenerIndex = std::unordered_map<const core::EditorObject*, ListenerList<Listener>>;
+
+	template <typename Listener>
+	using NamedListenerIndex = std::unordered_map<std::string, ListenerList<Listener>>;
+
+	template <typename Listener>
+	Subscription makeSubscription(const std::shared_ptr<Listener>& listener);
+	void compactListeners();
+
+	void emitUpdateFor(const std::map<std::string, std::set<core::ValueHandle>>& valueHandles);
 	void emitErrorChanged(const core::ValueHandle& valueHandle) const;
 	void emitErrorChangedInScene() const;
 	void emitCreated(core::SEditorObject obj) const;
@@ -153,33 +230,42 @@ private:
 	void emitPreviewDirty(core::SEditorObject obj) const;
 	void emitBulkChange(const core::SEditorObjectSet& changedObjects) const;
 	void emitLinksValidityChanged(std::map<std::string, std::set<core::LinkDescriptor>> const& validityChangedLinks) const;
-	void emitLinksAdded(std::map<std::string, std::set<core::LinkDescriptor>> const& addedLinks) const;
 	void emitLinksRemoved(std::map<std::string, std::set<core::LinkDescriptor>> const& removedLinks) const;
+	void emitLinksAdded(std::map<std::string, std::set<core::LinkDescriptor>> const& addedLinks) const;
 
-	std::set<std::weak_ptr<ObjectLifecycleListener>, std::owner_less<std::weak_ptr<ObjectLifecycleListener>>> objectLifecycleListeners_{};
-	std::set<std::weak_ptr<LinkLifecycleListener>, std::owner_less<std::weak_ptr<LinkLifecycleListener>>> linkLifecycleListeners_{};
-	std::map<std::string, std::set<std::weak_ptr<LinkLifecycleListener>, std::owner_less<std::weak_ptr<LinkLifecycleListener>>>> linkLifecycleListenersForEnd_{};
-	std::map<std::string, std::set<std::weak_ptr<LinkLifecycleListener>, std::owner_less<std::weak_ptr<LinkLifecycleListener>>>> linkLifecycleListenersForStart_{};
-	std::set<std::weak_ptr<LinkListener>, std::owner_less<std::weak_ptr<LinkListener>>> linkValidityChangeListeners_{};
-	std::map<std::string, std::set<std::weak_ptr<ValueHandleListener>, std::owner_less<std::weak_ptr<ValueHandleListener>>>> listeners_{};
-	std::map<std::string, std::set<std::weak_ptr<ChildrenListener>, std::owner_less<std::weak_ptr<ChildrenListener>>>> childrenListeners_{};
-	std::set<std::weak_ptr<EditorObjectListener>, std::owner_less<std::weak_ptr<EditorObjectListener>>> previewDirtyListeners_{};
-	std::set<std::weak_ptr<ValueHandleListener>, std::owner_less<std::weak_ptr<ValueHandleListener>>> errorChangedListeners_{};
-	std::set<std::weak_ptr<UndoListener>, std::owner_less<std::weak_ptr<UndoListener>>> errorChangedInSceneListeners_{};
-	std::map<std::string, std::set<std::weak_ptr<PropertyChangeListener>, std::owner_less<std::weak_ptr<PropertyChangeListener>>>> propertyChangeListeners_{};
+	ListenerList<ObjectLifecycleListener> objectLifecycleListeners_{};
+	ListenerList<LinkLifecycleListener> linkLifecycleListeners_{};
+	NamedListenerIndex<LinkLifecycleListener> linkLifecycleListenersForEnd_{};
+	NamedListenerIndex<LinkLifecycleListener> linkLifecycleListenersForStart_{};
+	ListenerList<LinkListener> linkValidityChangeListeners_{};
+	PropertyListenerIndex<ValueHandleListener> listeners_{};
+	PropertyListenerIndex<ChildrenListener> childrenListeners_{};
+	ObjectListenerIndex<EditorObjectListener> previewDirtyListeners_{};
+	PropertyListenerIndex<ValueHandleListener> errorChangedListeners_{};
+	ListenerList<UndoListener> errorChangedInSceneListeners_{};
+	NamedListenerIndex<PropertyChangeListener> propertyChangeListeners_{};
 
 	bool undoChanged_{false};
-	std::set<std::weak_ptr<UndoListener>, std::owner_less<std::weak_ptr<UndoListener>>> undoChangeListeners_{};
+	ListenerList<UndoListener> undoChangeListeners_{};
 
 	bool externalProjectChanged_{false};
-	std::set<std::weak_ptr<UndoListener>, std::owner_less<std::weak_ptr<UndoListener>>> externalProjectChangedListeners_{};
-	std::set<std::weak_ptr<UndoListener>, std::owner_less<std::weak_ptr<UndoListener>>> externalProjectMapChangedListeners_{};
+	ListenerList<UndoListener> externalProjectChangedListeners_{};
+	ListenerList<UndoListener> externalProjectMapChangedListeners_{};
 
-	std::set<std::weak_ptr<UndoListener>, std::owner_less<std::weak_ptr<UndoListener>>> rootOrderChangedListeners_{};
+	ListenerList<UndoListener> rootOrderChangedListeners_{};
 
-	std::set<std::weak_ptr<UndoListener>, std::owner_less<std::weak_ptr<UndoListener>>> onAfterDispatchListeners_{};
+	ListenerList<UndoListener> onAfterDispatchListeners_{};
 
 	std::map<uint64_t, BulkChangeCallback> bulkChangeCallbacks_;
+
+	// Number of listeners in the indices including the expired ones.
+	size_t registeredListeners_{0};
+	// Number of listeners deregistered since the last compaction.
+	size_t deregisteredListeners_{0};
+	// Listeners can only be removed from the indices outside of dispatch().
+	int dispatchDepth_{0};
+	// Used to notify value handle listeners only once per dispatch.
+	uint64_t dispatchCount_{0};
 };
 
 using SDataChangeDispatcher = std::shared_ptr<DataChangeDispatcher>;
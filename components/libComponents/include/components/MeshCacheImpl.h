@@ -12,9 +12,13 @@
 #include "components/FileChangeMonitorImpl.h"
 #include "core/MeshCacheInterface.h"
 
+#include <cstdint>
 #include <functional>
+#include <future>
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_set>
 
 namespace raco::core {
@@ -23,10 +27,56 @@ class BaseContext;
 
 namespace raco::components {
 
+/**
+ * @brief Mesh cache used by the application.
+ *
+ * The parsed files are kept in memory by the cache entries (i.e. the file loaders) to quickly answer
+ * subsequent queries for the same file. The memory used by the loaded files is bounded by a memory budget:
+ * when it is exceeded the least recently used files are discarded and will be loaded again on demand.
+ * Already extracted mesh, skin and animation data are not affected by this.
+ *
+ * In asynchronous loading mode loadMesh doesn't parse files itself: if the file is not loaded yet the parsing
+ * and the mesh construction are started on a worker thread and loadMesh returns nullptr. isLoading reports
+ * the files which are still being loaded. The result is delivered by processFinishedLoads, which needs to be
+ * called regularly from the main loop, by invoking the registered file change callbacks of the file.
+ */
 class MeshCacheImpl : public GenericFileChangeMonitorImpl<core::MeshCache> {
 public:
+	static constexpr size_t DEFAULT_MEMORY_BUDGET = size_t{1024} * 1024 * 1024;
+
+	struct Statistics {
+		size_t memoryBudget = 0;
+		// Approximate memory used by the currently loaded files.
+		size_t memoryUsage = 0;
+		// Number of watched files and number of files currently loaded in memory.
+		size_t entryCount = 0;
+		size_t loadedEntryCount = 0;
+		// Number of times a file was parsed and number of times a loaded file was discarded to meet the memory budget.
+		size_t fileLoadCount = 0;
+		size_t evictionCount = 0;
+		// Number of loadMesh calls served by already existing mesh data.
+		size_t meshDataHitCount = 0;
+		// Number of files currently loaded in the background.
+		size_t pendingLoadCount = 0;
+	};
+
 	MeshCacheImpl() {}
 
+	void setMemoryBudget(size_t memoryBudget);
+	size_t memoryBudget() const;
+	Statistics statistics() const;
+
+	// Switching off asynchronous loading waits for all pending loads.
+	void setAsyncLoading(bool enable);
+	bool asyncLoading() const;
+
+	bool isLoading(const std::string& absPath) override;
+	bool hasPendingLoads() const;
+	// Deliver the results of the finished background loads. Returns true if any load has been finished.
+	bool processFinishedLoads();
+	// Block until all background loads, including the ones started by the delivery of finished loads, are done and delivered.
+	void waitForPendingLoads();
+
 	core::SharedMeshData loadMesh(const core::MeshDescriptor& descriptor) override;
 	const core::MeshScenegraph* getMeshScenegraph(const std::string& absPath) override;
 	std::string getMeshError(const std::string& absPath) override;
@@ -41,10 +91,61 @@ private:
 	virtual void notify(const std::string& absPath) override;
 
 	core::MeshCacheEntry* getLoader(std::string absPath) override;
+	static core::UniqueMeshCacheEntry createLoader(const std::string& absPath);
+
+	void notifyCallbacks(const std::string& absPath);
 
 	void forceReloadCachedMesh(const std::string& absPath);
+	void eraseCachedMeshData(const std::string& absPath);
+
+	// Update the memory usage of the entry after it has been used and discard other entries if the budget is exceeded.
+	void updateMemoryUsage(const std::string& absPath);
+	// Re-read the memory usage of all loaded entries since it changes when meshes referencing file data are released.
+	void refreshMemoryUsage();
+	void evict(const std::string& keepAbsPath);
+
+	struct CacheEntry {
+		core::UniqueMeshCacheEntry loader;
+		// Value of useCounter_ when the entry was last used.
+		uint64_t lastUse = 0;
+		size_t memoryUsage = 0;
+		// Cached to avoid reloading a discarded file just to obtain the mesh count.
+		int totalMeshCount = -1;
+		// The file has been loaded successfully since the last reset: queries don't need to be moved to a background load.
+		bool fileLoaded = false;
+		// The background load of the file failed: the loader keeps the error until the file changes.
+		bool loadFailed = false;
+	};
+
+	struct AsyncLoadResult {
+		core::UniqueMeshCacheEntry loader;
+		core::SharedMeshData meshData;
+	};
+
+	struct PendingLoad {
+		core::MeshDescriptor descriptor;
+		std::future<AsyncLoadResult> result;
+		// The file has changed while it was loaded: the result is discarded.
+		bool stale = false;
+	};
+
+	std::unordered_map<std::string, CacheEntry> meshCacheEntries_;
+	uint64_t useCounter_ = 0;
+	size_t memoryBudget_ = DEFAULT_MEMORY_BUDGET;
+	size_t memoryUsage_ = 0;
+	size_t fileLoadCount_ = 0;
+	size_t evictionCount_ = 0;
+	size_t meshDataHitCount_ = 0;
+
+	// Mesh data handed out by loadMesh, indexed by (absPath, submeshIndex, bakeAllSubmeshes).
+	// Mesh objects with identical descriptors share the same MeshData as long as one of them is still alive.
+	using MeshDataKey = std::tuple<std::string, int, bool>;
+	static MeshDataKey meshDataKey(const core::MeshDescriptor& descriptor);
+	std::map<MeshDataKey, std::weak_ptr<core::MeshData>> meshData_;
 
-	std::unordered_map<std::string, core::UniqueMeshCacheEntry> meshCacheEntries_;
+	bool asyncLoading_ = false;
+	// At most one background load per file.
+	std::map<std::string, PendingLoad> pendingLoads_;
 };
 
 }  // namespace raco::components
\ No newline at end of file
@@ -46,6 +46,19 @@ public:
 	bool isUriValidationCaseSensitive;
 	bool preventAccidentalUpgrade;
 	bool enableProjectPythonScript;
+
+	// Write the object index file next to the project on save which allows partially loading externally referenced projects.
+	// Enabled by default: the index is only useful if it is written by every save of the project.
+	bool writeProjectObjectIndex;
+
+	// Undo stack size limits. A value of 0 disables the corresponding limit.
+	int undoStackMaxEntries;
+	int undoStackMemoryLimitMB;
+	// Store only the differences between undo stack entries instead of project snapshots. Applies to projects opened afterwards.
+	bool undoStackDeltaStorage;
+
+	// Interval in which the preview is rendered while nothing changes. A value of 0 renders continuously.
+	int idleFrameIntervalMs;
 };
 
 }  // namespace raco
@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <QByteArray>
+#include <QFile>
+#include <QJsonParseError>
+#include <QJsonValue>
+
+#include <string>
+#include <vector>
+
+namespace raco::components {
+
+/**
+ * @brief Random access to the frames of a trace file without loading the whole file into memory.
+ *
+ * A trace file consists of a JSON array of frames. open() scans the file once and records the byte range
+ * and first line of every top-level array element. The scan only tracks strings and bracket nesting,
+ * it doesn't build a JSON document. Single frames are then read and parsed on demand.
+ */
+class TraceFileReader {
+public:
+	/**
+	 * @brief Index the frames of the file.
+	 *
+	 * @return false if the file can't be opened or isn't a well-formed JSON array. outError then describes
+	 * the problem, with the offset relative to the start of the file.
+	 */
+	bool open(const std::string& fileName, QJsonParseError& outError);
+	void close();
+
+	bool isOpen() const;
+	// False if open() failed because the root of the file is not a JSON array.
+	bool rootIsArray() const;
+	int frameCount() const;
+	// Line number of the first line of the frame in the file, starting with 1.
+	int frameLine(int frameIndex) const;
+
+	QByteArray readFrameText(int frameIndex);
+	/**
+	 * @brief Read and parse a single frame.
+	 *
+	 * Returns an undefined value if the frame is not valid JSON; outError then contains the offset relative to the
+	 * start of the file.
+	 */
+	QJsonValue readFrame(int frameIndex, QJsonParseError& outError);
+
+private:
+	struct FrameLocation {
+		qint64 offset;
+		qint64 size;
+		int line;
+	};
+
+	QFile file_;
+	std::vector<FrameLocation> frames_;
+	bool rootIsArray_ = true;
+};
+
+}  // namespace raco::components
@@ -38,6 +38,12 @@ class TracePlayer {
 public:
 	using timeInMilliSeconds = int64_t;
 
+	/// Trace files larger than this are streamed from disk instead of being loaded into memory.
+	static constexpr int64_t DEFAULT_STREAMING_THRESHOLD_BYTES = int64_t{64} * 1024 * 1024;
+	/// In streaming mode every n-th frame is kept in memory as a full keyframe; the frames in between are
+	/// rebuilt on demand from the preceding keyframe and the frame deltas in the file.
+	static constexpr int DEFAULT_STREAMING_KEYFRAME_INTERVAL = 60;
+
 	enum class PlayerState {
 		Faulty = -1,
 		Init = 0,
@@ -72,7 +78,19 @@ public:
 	void clearLog();
 	std::unordered_map<std::string, core::ErrorLevel> const& getLog() const;
 
+	/// Streaming configuration, applied on the next loadTrace.
+	void setStreamingThreshold(int64_t bytes);
+	int64_t getStreamingThreshold() const;
+	void setStreamingKeyframeInterval(int interval);
+	int getStreamingKeyframeInterval() const;
+	bool isStreaming() const;
+	/// Number of frames currently held in memory in streaming mode, excluding the keyframes.
+	int getMaterializedFrameCount() const;
+
 	/// player playback controls
+	/// @return the frames of the trace or nullptr if loading failed.
+	/// In streaming mode the frames are not held in memory and the returned array is empty: callers
+	/// must only check the result for nullptr and use getTraceLen() for the number of frames.
 	QJsonArray const* const loadTrace(const std::string& fileName);
 	void play();
 	void pause();
@@ -104,12 +122,17 @@ private:
 	void addError(const std::string& msg, core::ErrorLevel level, bool callLogChange = true);
 	void lockLua();
 	void makeFramesConsistent();
-	QJsonValue deepAddMissingProperties(const QJsonValue& qjPrev, const QJsonValue& qjCurr, std::vector<std::string>& propertyPath, int index);
+	QJsonValue deepAddMissingProperties(const QJsonValue& qjPrev, const QJsonValue& qjCurr, std::vector<std::string>& propertyPath, int index, bool logErrors = true);
 	QJsonValue buildFullFrameFromLua(std::unordered_set<core::SEditorObject> const& sceneLuaList);
 	QJsonValue deepCopyFromLua(core::ValueHandle const& luaValHandle);
 	void rebuildFrameSceneData(int index, const QJsonValue& qjPrev, const QJsonValue& qjCurr);
 	void readLinesForNextFrame();
 	int getPropertyLineNumber(const QString& propertyKey);
+	QJsonArray const* const loadTraceStreaming(const std::string& fileName);
+	void makeStreamedFramesConsistent(std::unordered_set<core::SEditorObject> const& sceneLuaList);
+	QJsonObject readStreamedFrame(int frameIndex);
+	QJsonObject materializeFrame(int frameIndex);
+	void readLinesOfStreamedFrame(int frameIndex);
 
 	class CodeControlledObjectExtension;
 	std::unique_ptr<CodeControlledObjectExtension> racoCoreInterface_;
@@ -132,6 +155,10 @@ private:
 	int keyLineNumber_{0};
 	QTextStream textStream_;
 	std::forward_list<std::pair<int, QString>> traceFileLines_;
+	int64_t streamingThreshold_{DEFAULT_STREAMING_THRESHOLD_BYTES};
+	int streamingKeyframeInterval_{DEFAULT_STREAMING_KEYFRAME_INTERVAL};
+	struct StreamingState;
+	std::unique_ptr<StreamingState> streaming_;
 };
 
 }  // namespace raco::components
@@ -48,6 +48,9 @@ public:
 		return valueHandle_;
 	}
 
+	// Number of the last dispatch notifying the listener
+	uint64_t lastDispatch_{0};
+
 private:
 	ValueHandle valueHandle_;
 	Callback callback_;
@@ -165,7 +168,88 @@ Subscription::~Subscription() {
 
 DataChangeDispatcher::DataChangeDispatcher() {}
 
+size_t DataChangeDispatcher::PropertyPathHash::operator()(const std::vector<size_t>& indices) const noexcept {
+	size_t hash = indices.size();
+	for (auto index : indices) {
+		hash ^= std::hash<size_t>()(index) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	}
+	return hash;
+}
+
+namespace {
+
+// Compact the listener lists of an index and remove the empty lists.
+template <typename Index>
+size_t compactListenerLists(Index& index) {
+	size_t removed = 0;
+	for (auto it = index.begin(); it != index.end();) {
+		removed += it->second.compact();
+		it = it->second.empty() ? index.erase(it) : std::next(it);
+	}
+	return removed;
+}
+
+template <typename PropertyIndex>
+size_t compactPropertyListenerLists(std::unordered_map<const EditorObject*, PropertyIndex>& index) {
+	size_t removed = 0;
+	for (auto it = index.begin(); it != index.end();) {
+		removed += compactListenerLists(it->second);
+		it = it->second.empty() ? index.erase(it) : std::next(it);
+	}
+	return removed;
+}
+
+template <typename Listener, typename PropertyIndex>
+const ListenerList<Listener>* findListeners(const std::unordered_map<const EditorObject*, PropertyIndex>& index, const ValueHandle& valueHandle) {
+	if (auto objectIt = index.find(valueHandle.rootObject().get()); objectIt != index.end()) {
+		if (auto it = objectIt->second.find(valueHandle.indices()); it != objectIt->second.end()) {
+			return &it->second;
+		}
+	}
+	return nullptr;
+}
+
+}  // namespace
+
+template <typename Listener>
+Subscription DataChangeDispatcher::makeSubscription(const std::shared_ptr<Listener>& listener) {
+	if (dispatchDepth_ == 0 && deregisteredListeners_ > registeredListeners_ / 2) {
+		compactListeners();
+	}
+	++registeredListeners_;
+	// The listener is removed from the indices lazily once it has expired, see compactListeners().
+	return Subscription{this, listener, [this]() {
+		++deregisteredListeners_;
+	}};
+}
+
+void DataChangeDispatcher::compactListeners() {
+	assert(dispatchDepth_ == 0);
+	size_t removed = 0;
+	removed += objectLifecycleListeners_.compact();
+	removed += linkLifecycleListeners_.compact();
+	removed += compactListenerLists(linkLifecycleListenersForEnd_);
+	removed += compactListenerLists(linkLifecycleListenersForStart_);
+	removed += linkValidityChangeListeners_.compact();
+	removed += compactPropertyListenerLists(listeners_);
+	removed += compactPropertyListenerLists(childrenListeners_);
+	removed += compactListenerLists(previewDirtyListeners_);
+	removed += compactPropertyListenerLists(errorChangedListeners_);
+	removed += errorChangedInSceneListeners_.compact();
+	removed += compactListenerLists(propertyChangeListeners_);
+	removed += undoChangeListeners_.compact();
+	removed += externalProjectChangedListeners_.compact();
+	removed += externalProjectMapChangedListeners_.compact();
+	removed += rootOrderChangedListeners_.compact();
+	removed += onAfterDispatchListeners_.compact();
+	registeredListeners_ -= removed;
+	deregisteredListeners_ = 0;
+}
+
 void DataChangeDispatcher::dispatch(const DataChangeRecorder& dataChanges) {
+	++dispatchDepth_;
+	++dispatchCount_;
+
 	// Sync with and reset change recorder:
 
 	emitLinksValidityChanged(dataChanges.getValidityChangedLinks());
@@ -207,55 +291,45 @@ void DataChangeDispatcher::dispatch(const DataChangeRecorder& dataChanges) {
 	emitBulkChange(dataChanges.getAllChangedObjects(true));
 
 	if (undoChanged_) {
-		for (auto& undoListener : undoChangeListeners_) {
-			if (!undoListener.expired())
-				undoListener.lock()->call();
-		}
+		undoChangeListeners_.forEach([](const auto& listener) {
+			listener->call();
+		});
 		undoChanged_ = false;
 	}
 
 	if (externalProjectChanged_) {
-		for (auto& listener : externalProjectChangedListeners_) {
-			if (!listener.expired())
-				listener.lock()->call();
-		}
+		externalProjectChangedListeners_.forEach([](const auto& listener) {
+			listener->call();
+		});
 		externalProjectChanged_ = false;
 	}
 
 	if (dataChanges.rootOrderChanged()) {
-		for (auto& listener : rootOrderChangedListeners_) {
-			if (!listener.expired()) {
-				listener.lock()->call();
-			}
-		}
+		rootOrderChangedListeners_.forEach([](const auto& listener) {
+			listener->call();
+		});
 	}
 
 	if (dataChanges.externalProjectMapChanged()) {
-		for (auto& listener : externalProjectMapChangedListeners_) {
-			if (!listener.expired())
-				listener.lock()->call();
-		}
+		externalProjectMapChangedListeners_.forEach([](const auto& listener) {
+			listener->call();
+		});
 	}
 
-	for (auto& listener : onAfterDispatchListeners_) {
-		if (!listener.expired()) {
-			listener.lock()->call();
-		}
+	onAfterDispatchListeners_.forEach([](const auto& listener) {
+		listener->call();
+	});
+
+	if (--dispatchDepth_ == 0 && deregisteredListeners_ > registeredListeners_ / 2) {
+		compactListeners();
 	}
 }
 
 Subscription DataChangeDispatcher::registerOn(ValueHandle valueHandle, Callback callback) noexcept {
 	auto listener{std::make_shared<ValueHandleListener>(std::move(valueHandle), std::move(callback))};
-	listeners_[listener->valueHandle().rootObject()->objectID()].insert(listener);
-	return Subscription{
-		this, listener, [this, listener]() {
-			const auto& objectID = listener->valueHandle().rootObject()->objectID();
-			auto it = listeners_.find(objectID);
-			it->second.erase(listener);
-			if (it->second.empty()) {
-				listeners_.erase(objectID);
-			}
-		}};
+	const auto& handle = listener->valueHandle();
+	listeners_[handle.rootObject().get()][handle.indices()].add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOn(ValueHandles handles, ValueHandleCallback callback) noexcept {
@@ -269,151 +343,98 @@ Subscription DataChangeDispatcher::registerOn(ValueHandles handles, ValueHandleC
 
 Subscription DataChangeDispatcher::registerOnPropertyChange(const std::string& propertyName, ValueHandleCallback callback) noexcept {
 	auto listener{std::make_shared<PropertyChangeListener>(propertyName, callback)};
-	propertyChangeListeners_[propertyName].insert(listener);
-	return Subscription{
-		this, listener, [this, propertyName, listener]() {
-			auto it = propertyChangeListeners_.find(propertyName);
-			it->second.erase(listener);
-			if (it->second.empty()) {
-				propertyChangeListeners_.erase(propertyName);
-			}
-		}};
+	propertyChangeListeners_[propertyName].add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnChildren(ValueHandle valueHandle, ValueHandleCallback callback) noexcept {
 	auto listener{std::make_shared<ChildrenListener>(std::move(valueHandle), std::move(callback))};
-	childrenListeners_[listener->valueHandle().rootObject()->objectID()].insert(listener);
-	return Subscription{
-		this, listener, [this, listener]() {
-			const auto& objectID = listener->valueHandle().rootObject()->objectID();
-			auto it = childrenListeners_.find(objectID);
-			it->second.erase(listener);
-			if (it->second.empty()) {
-				childrenListeners_.erase(objectID);
-			}
-		}};
+	const auto& handle = listener->valueHandle();
+	childrenListeners_[handle.rootObject().get()][handle.indices()].add(listener);
+	return makeSubscription(listener);
 }
 
 
 Subscription DataChangeDispatcher::registerOnObjectsLifeCycle(EditorObjectCallback onCreation, EditorObjectCallback onDeletion) noexcept {
 	auto listener{std::make_shared<ObjectLifecycleListener>(onCreation, onDeletion)};
-	objectLifecycleListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() { 
-		objectLifecycleListeners_.erase(listener); 
-	}};
+	objectLifecycleListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnLinksLifeCycle(LinkCallback onCreation, LinkCallback onDeletion) noexcept {
 	auto listener{std::make_shared<LinkLifecycleListener>(onCreation, onDeletion)};
-	linkLifecycleListeners_.insert(listener);
-	return Subscription{this, listener,
-		[this, listener]() {
-			linkLifecycleListeners_.erase(listener);
-		}};
+	linkLifecycleListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnLinksLifeCycleForEnd(SEditorObject endObject, LinkCallback onCreation, LinkCallback onDeletion) noexcept {
 	assert(endObject != nullptr);
 	auto listener{std::make_shared<LinkLifecycleListener>(onCreation, onDeletion)};
-	std::string endObjectID = endObject->objectID();
-	linkLifecycleListenersForEnd_[endObjectID].insert(listener);
-	return Subscription{
-		this, listener, [this, endObjectID, listener]() {
-			auto it = linkLifecycleListenersForEnd_.find(endObjectID);
-			it->second.erase(listener);
-			if (it->second.empty()) {
-				linkLifecycleListenersForEnd_.erase(endObjectID);
-			}
-		}};
+	linkLifecycleListenersForEnd_[endObject->objectID()].add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnLinksLifeCycleForStart(SEditorObject startObject, LinkCallback onCreation, LinkCallback onDeletion) noexcept {
 	assert(startObject != nullptr);
 	auto listener{std::make_shared<LinkLifecycleListener>(onCreation, onDeletion)};
-	std::string startObjectID = startObject->objectID();
-	linkLifecycleListenersForStart_[startObjectID].insert(listener);
-	return Subscription{
-		this, listener, [this, startObjectID, listener]() {
-			auto it = linkLifecycleListenersForStart_.find(startObjectID);
-			it->second.erase(listener);
-			if (it->second.empty()) {
-				linkLifecycleListenersForStart_.erase(startObjectID);
-			}
-		}};
+	linkLifecycleListenersForStart_[startObject->objectID()].add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnLinkValidityChange(LinkCallback callback) noexcept {
 	auto listener{std::make_shared<LinkListener>(callback)};
-	linkValidityChangeListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() { 
-		linkValidityChangeListeners_.erase(listener); 
-	}};
+	linkValidityChangeListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnErrorChanged(ValueHandle valueHandle, Callback callback) noexcept {
 	auto listener{std::make_shared<ValueHandleListener>(std::move(valueHandle), std::move(callback))};
-	errorChangedListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() { 
-		errorChangedListeners_.erase(listener); 
-	}};
+	const auto& handle = listener->valueHandle();
+	errorChangedListeners_[handle.rootObject().get()][handle.indices()].add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnErrorChangedInScene(Callback callback) noexcept {
 	auto listener{std::make_shared<UndoListener>(std::move(callback))};
-	errorChangedInSceneListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() {
-		errorChangedInSceneListeners_.erase(listener);
-	}};
+	errorChangedInSceneListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnPreviewDirty(SEditorObject obj, Callback callback) noexcept {
 	assert(obj);
 	auto listener{std::make_shared<EditorObjectListener>(obj, std::move(callback))};
-	previewDirtyListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() { 
-		previewDirtyListeners_.erase(listener); 
-	}};
+	previewDirtyListeners_[obj.get()].add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnUndoChanged(Callback callback) noexcept {
 	auto listener{std::make_shared<UndoListener>(std::move(callback))};
-	undoChangeListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() { 
-		undoChangeListeners_.erase(listener); 
-	}};
+	undoChangeListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnExternalProjectChanged(Callback callback) noexcept {
 	auto listener{std::make_shared<UndoListener>(std::move(callback))};
-	externalProjectChangedListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() { 
-		externalProjectChangedListeners_.erase(listener); 
-	}};
+	externalProjectChangedListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnExternalProjectMapChanged(Callback callback) noexcept {
 	auto listener{std::make_shared<UndoListener>(std::move(callback))};
-	externalProjectMapChangedListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() {
-		externalProjectMapChangedListeners_.erase(listener);
-	}};
+	externalProjectMapChangedListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnRootOrderChanged(Callback callback) noexcept {
 	auto listener{std::make_shared<UndoListener>(std::move(callback))};
-	rootOrderChangedListeners_.insert(listener);
-	return Subscription{this, listener,
-		[this, listener]() {
-			rootOrderChangedListeners_.erase(listener);
-		}};
+	rootOrderChangedListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 Subscription DataChangeDispatcher::registerOnAfterDispatch(Callback callback) {
 	auto listener{std::make_shared<UndoListener>(std::move(callback))};
-	onAfterDispatchListeners_.insert(listener);
-	return Subscription{this, listener, [this, listener]() { 
-		onAfterDispatchListeners_.erase(listener); 
-	}};
+	onAfterDispatchListeners_.add(listener);
+	return makeSubscription(listener);
 }
 
 void DataChangeDispatcher::addBulkChangeCallback(uint64_t id, BulkChangeCallback callback) {
@@ -424,102 +445,95 @@ void DataChangeDispatcher::removeBulkChangeCallback(uint64_t id) {
 	bulkChangeCallbacks_.erase(id);
 }
 
-void DataChangeDispatcher::emitUpdateFor(const std::map<std::string, std::set<core::ValueHandle>>& valueHandles) const {
-	decltype(listeners_)::mapped_type dirtyListeners;
+void DataChangeDispatcher::emitUpdateFor(const std::map<std::string, std::set<core::ValueHandle>>& valueHandles) {
+	std::vector<std::weak_ptr<ValueHandleListener>> dirtyListeners;
+	std::vector<std::weak_ptr<ChildrenListener>> dirtyChildrenListeners;
+	std::vector<std::weak_ptr<PropertyChangeListener>> dirtyPropertyListeners;
+	std::vector<size_t> containerIndices;
 
 	for (const auto& [objectID, cont] : valueHandles) {
 		for (const auto& valueHandle : cont) {
-			auto listenerIt = listeners_.find(objectID);
-			if (listenerIt != listeners_.end()) {
-				for (const auto& ptr : listenerIt->second) {
-					if (!ptr.expired()) {
-						auto listener{ptr.lock()};
-						if (listener->valueHandle() == valueHandle) {
-							dirtyListeners.insert(ptr);
+			const auto& indices = valueHandle.indices();
+			// Looked up for every handle since the callbacks may register new listeners.
+			auto valueObjectIt = listeners_.find(valueHandle.rootObject().get());
+			auto childrenObjectIt = childrenListeners_.find(valueHandle.rootObject().get());
+
+			if (valueObjectIt != listeners_.end()) {
+				if (auto it = valueObjectIt->second.find(indices); it != valueObjectIt->second.end()) {
+					it->second.forEach([this, &dirtyListeners](const auto& listener) {
+						if (listener->lastDispatch_ != dispatchCount_) {
+							listener->lastDispatch_ = dispatchCount_;
+							dirtyListeners.emplace_back(listener);
 						}
-					}
+					});
 				}
 			}
 
-			decltype(childrenListeners_)::mapped_type dirtyChildrenListeners;
-			auto childListenerIt = childrenListeners_.find(objectID);
-			if (childListenerIt != childrenListeners_.end()) {
-				for (const auto& ptr : childListenerIt->second) {
-					if (!ptr.expired()) {
-						auto listener{ptr.lock()};
-						if (listener->valueHandle() == valueHandle || listener->valueHandle().contains(valueHandle)) {
-							dirtyChildrenListeners.insert(ptr);
-						}
+			if (childrenObjectIt != childrenListeners_.end()) {
+				// Listeners registered on the changed property or any property containing it.
+				const auto& objectListeners = childrenObjectIt->second;
+				dirtyChildrenListeners.clear();
+				for (size_t depth = 0; depth <= indices.size(); depth++) {
+					containerIndices.assign(indices.begin(), indices.begin() + depth);
+					if (auto it = objectListeners.find(containerIndices); it != objectListeners.end()) {
+						it->second.forEach([&dirtyChildrenListeners](const auto& listener) {
+							dirtyChildrenListeners.emplace_back(listener);
+						});
 					}
 				}
-			}
-			for (const auto& ptr : dirtyChildrenListeners) {
-				if (!ptr.expired()) {
-					ptr.lock()->call(valueHandle);
+				for (const auto& ptr : dirtyChildrenListeners) {
+					if (auto listener = ptr.lock()) {
+						listener->call(valueHandle);
+					}
 				}
 			}
 
 			if (valueHandle.depth() > 0) {
-				auto propName = valueHandle.getPropName();
-
-				decltype(propertyChangeListeners_)::mapped_type dirtyPropertyListeners;
-				auto it = propertyChangeListeners_.find(propName);
+				auto it = propertyChangeListeners_.find(valueHandle.getPropName());
 				if (it != propertyChangeListeners_.end()) {
-					for (const auto& ptr : it->second) {
-						if (!ptr.expired()) {
-							dirtyPropertyListeners.insert(ptr);
+					dirtyPropertyListeners.clear();
+					it->second.forEach([&dirtyPropertyListeners](const auto& listener) {
+						dirtyPropertyListeners.emplace_back(listener);
+					});
+					for (const auto& ptr : dirtyPropertyListeners) {
+						if (auto listener = ptr.lock()) {
+							listener->call(valueHandle);
 						}
 					}
 				}
-				for (const auto& ptr : dirtyPropertyListeners) {
-					if (!ptr.expired()) {
-						ptr.lock()->call(valueHandle);
-					}
-				}
 			}
 		}
 	}
 
 	for (const auto& ptr : dirtyListeners) {
-		if (!ptr.expired()) {
-			ptr.lock()->call();
+		if (auto listener = ptr.lock()) {
+			listener->call();
 		}
 	}
 }
 
 void DataChangeDispatcher::emitErrorChanged(const ValueHandle& valueHandle) const {
-	auto copy{errorChangedListeners_};
-	for (const auto& ptr : copy) {
-		if (!ptr.expired()) {
-			auto listener{ptr.lock()};
-			if (listener->valueHandle() == valueHandle) {
-				listener->call();
-			}
-		}
+	if (auto listeners = findListeners<ValueHandleListener>(errorChangedListeners_, valueHandle)) {
+		listeners->forEach([](const auto& listener) {
+			listener->call();
+		});
 	}
 }
 
 void DataChangeDispatcher::emitErrorChangedInScene() const {
-	auto copy{errorChangedInSceneListeners_};
-	for (const auto& ptr : copy) {
-		if (!ptr.expired()) {
-			auto listener{ptr.lock()};
-			listener->call();
-		}
-	}
+	errorChangedInSceneListeners_.forEach([](const auto& listener) {
+		listener->call();
+	});
 }
 
 void DataChangeDispatcher::emitCreated(SEditorObject obj) const {
-	auto copy{objectLifecycleListeners_};
-	for (const auto& ptr : copy) {
-		if (!ptr.expired()) {
-			auto listener{ptr.lock()};
-			listener->onCreation(obj);
-		}
-	}
+	objectLifecycleListeners_.forEach([&obj](const auto& listener) {
+		listener->onCreation(obj);
+	});
 }
 
 void DataChangeDispatcher::assertEmpty() {
+	compactListeners();
 	assert(objectLifecycleListeners_.empty());
 	assert(linkLifecycleListeners_.empty());
 	assert(linkLifecycleListenersForEnd_.empty());
@@ -540,24 +554,16 @@ void DataChangeDispatcher::assertEmpty() {
 }
 
 void DataChangeDispatcher::emitDeleted(SEditorObject obj) const {
-	auto copy{objectLifecycleListeners_};
-	for (const auto& ptr : copy) {
-		if (!ptr.expired()) {
-			auto listener{ptr.lock()};
-			listener->onDeletion(obj);
-		}
-	}
+	objectLifecycleListeners_.forEach([&obj](const auto& listener) {
+		listener->onDeletion(obj);
+	});
 }
 
 void DataChangeDispatcher::emitPreviewDirty(SEditorObject obj) const {
-	auto copy{previewDirtyListeners_};
-	for (const auto& ptr : copy) {
-		if (!ptr.expired()) {
-			auto listener{ptr.lock()};
-			if (listener->editorObject() == obj) {
-				listener->call();
-			}
-		}
+	if (auto it = previewDirtyListeners_.find(obj.get()); it != previewDirtyListeners_.end()) {
+		it->second.forEach([](const auto& listener) {
+			listener->call();
+		});
 	}
 }
 
@@ -570,48 +576,39 @@ void DataChangeDispatcher::emitBulkChange(const SEditorObjectSet& changedObjects
 void DataChangeDispatcher::emitLinksValidityChanged(std::map<std::string, std::set<LinkDescriptor>> const& validityChangedLinks) const {
 	for (auto& [endObjId, links] : validityChangedLinks) {
 		for (auto& link : links) {
-			auto copy{linkValidityChangeListeners_};
-			for (const auto& ptr : copy) {
-				if (!ptr.expired()) {
-					auto listener{ptr.lock()};
-					listener->onLinkChange(link);
-				}
-			}
+			linkValidityChangeListeners_.forEach([&link](const auto& listener) {
+				listener->onLinkChange(link);
+			});
 		}
 	}
 }
 
 void DataChangeDispatcher::emitLinksRemoved(std::map<std::string, std::set<LinkDescriptor>> const& removedLinks) const {
 	if (!removedLinks.empty()) {
-		auto copy{linkLifecycleListeners_};
+		// Listeners registered by the callbacks are not notified in this dispatch.
+		auto count = linkLifecycleListeners_.size();
 		for (auto& [endObjId, links] : removedLinks) {
-			decltype(linkLifecycleListenersForEnd_)::mapped_type copyEnd;
+			const ListenerList<LinkLifecycleListener>* endListeners = nullptr;
+			size_t endCount = 0;
 			if (auto it = linkLifecycleListenersForEnd_.find(endObjId); it != linkLifecycleListenersForEnd_.end()) {
-				std::copy(it->second.begin(), it->second.end(), std::inserter(copyEnd, copyEnd.end()));
+				endListeners = &it->second;
+				endCount = endListeners->size();
 			}
 			for (auto& link : links) {
-				for (const auto& ptr : copy) {
-					if (!ptr.expired()) {
-						auto listener{ptr.lock()};
-						listener->onDeletion_(link);
-					}
-				}
+				linkLifecycleListeners_.forEach([&link](const auto& listener) {
+					listener->onDeletion_(link);
+				}, count);
 
-				for (const auto& ptr : copyEnd) {
-					if (!ptr.expired()) {
-						auto listener{ptr.lock()};
+				if (endListeners) {
+					endListeners->forEach([&link](const auto& listener) {
 						listener->onDeletion_(link);
-					}
+					}, endCount);
 				}
 
 				if (auto it = linkLifecycleListenersForStart_.find(link.start.object()->objectID()); it != linkLifecycleListenersForStart_.end()) {
-					auto copyStart(it->second);
-					for (const auto& ptr : copyStart) {
-						if (!ptr.expired()) {
-							auto listener{ptr.lock()};
-							listener->onDeletion_(link);
-						}
-					}
+					it->second.forEach([&link](const auto& listener) {
+						listener->onDeletion_(link);
+					});
 				}
 			}
 		}
@@ -620,35 +617,30 @@ void DataChangeDispatcher::emitLinksRemoved(std::map<std::string, std::set<LinkD
 
 void DataChangeDispatcher::emitLinksAdded(std::map<std::string, std::set<LinkDescriptor>> const& addedLinks) const {
 	if (!addedLinks.empty()) {
-		auto copy{linkLifecycleListeners_};
+		// Listeners registered by the callbacks are not notified in this dispatch.
+		auto count = linkLifecycleListeners_.size();
 		for (auto& [endObjId, links] : addedLinks) {
-			decltype(linkLifecycleListenersForEnd_)::mapped_type copyEnd;
+			const ListenerList<LinkLifecycleListener>* endListeners = nullptr;
+			size_t endCount = 0;
 			if (auto it = linkLifecycleListenersForEnd_.find(endObjId); it != linkLifecycleListenersForEnd_.end()) {
-				std::copy(it->second.begin(), it->second.end(), std::inserter(copyEnd, copyEnd.end()));
+				endListeners = &it->second;
+				endCount = endListeners->size();
 			}
 			for (auto& link : links) {
-				for (const auto& ptr : copy) {
-					if (!ptr.expired()) {
-						auto listener{ptr.lock()};
-						listener->onCreation_(link);
-					}
-				}
+				linkLifecycleListeners_.forEach([&link](const auto& listener) {
+					listener->onCreation_(link);
+				}, count);
 
-				for (const auto& ptr : copyEnd) {
-					if (!ptr.expired()) {
-						auto listener{ptr.lock()};
+				if (endListeners) {
+					endListeners->forEach([&link](const auto& listener) {
 						listener->onCreation_(link);
-					}
+					}, endCount);
 				}
 
 				if (auto it = linkLifecycleListenersForStart_.find(link.start.object()->objectID()); it != linkLifecycleListenersForStart_.end()) {
-					auto copyStart(it->second);
-					for (const auto& ptr : copyStart) {
-						if (!ptr.expired()) {
-							auto listener{ptr.lock()};
-							listener->onCreation_(link);
-						}
-					}
+					it->second.forEach([&link](const auto& listener) {
+						listener->onCreation_(link);
+					});
 				}
 			}
 		}
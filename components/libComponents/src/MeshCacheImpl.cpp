@@ -12,11 +12,15 @@
 #include "components/FileChangeListenerImpl.h"
 #include "components/FileChangeMonitorImpl.h"
 #include "core/Context.h"
+#include "log_system/log.h"
 
 #include "mesh_loader/CTMFileLoader.h"
 #include "mesh_loader/glTFFileLoader.h"
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <limits>
 #include <memory>
 
 namespace raco::components {
@@ -24,13 +28,20 @@ namespace raco::components {
 void MeshCacheImpl::unregister(std::string absPath, typename core::MeshCache::Callback *listener) {
 	GenericFileChangeMonitorImpl<core::MeshCache>::unregister(absPath, listener);
 	if (callbacks_.find(absPath) == callbacks_.end()) {
-		meshCacheEntries_.erase(absPath);
+		if (auto it = meshCacheEntries_.find(absPath); it != meshCacheEntries_.end()) {
+			memoryUsage_ -= it->second.memoryUsage;
+			meshCacheEntries_.erase(it);
+		}
+		eraseCachedMeshData(absPath);
 	}
 }
 
 void MeshCacheImpl::notify(const std::string& absPath) {
 	forceReloadCachedMesh(absPath);
+	notifyCallbacks(absPath);
+}
 
+void MeshCacheImpl::notifyCallbacks(const std::string &absPath) {
 	auto it = callbacks_.find(absPath);
 	if (it != callbacks_.end()) {
 		// Make a copy of the callbacks and check if each callback is still registered before invoking it
@@ -50,16 +61,61 @@ void MeshCacheImpl::notify(const std::string& absPath) {
 	}
 }
 
+MeshCacheImpl::MeshDataKey MeshCacheImpl::meshDataKey(const core::MeshDescriptor &descriptor) {
+	// Baked meshes contain all submeshes: the submesh index doesn't influence the result.
+	return {descriptor.absPath, descriptor.bakeAllSubmeshes ? 0 : descriptor.submeshIndex, descriptor.bakeAllSubmeshes};
+}
+
 core::SharedMeshData MeshCacheImpl::loadMesh(const core::MeshDescriptor &descriptor) {
+	auto key = meshDataKey(descriptor);
+	auto it = meshData_.find(key);
+	if (it != meshData_.end()) {
+		if (auto meshData = it->second.lock()) {
+			++meshDataHitCount_;
+			return meshData;
+		}
+	}
+
+	if (isLoading(descriptor.absPath)) {
+		return {};
+	}
+
 	auto *loader = getLoader(descriptor.absPath);
 	assert(loader != nullptr);
-	return loader->loadMesh(descriptor);
+
+	const auto &entry = meshCacheEntries_.at(descriptor.absPath);
+	if (entry.loadFailed) {
+		// The error is reported by getMeshError: don't parse the file again.
+		return {};
+	}
+
+	if (asyncLoading_ && !entry.fileLoaded) {
+		LOG_DEBUG(log_system::MESH_LOADER, "Start background loading of mesh file: {}", descriptor.absPath);
+		auto &pending = pendingLoads_[descriptor.absPath];
+		pending.descriptor = descriptor;
+		pending.result = std::async(std::launch::async, [descriptor, asyncLoader = createLoader(descriptor.absPath)]() mutable {
+			auto meshData = asyncLoader->loadMesh(descriptor);
+			return AsyncLoadResult{std::move(asyncLoader), meshData};
+		});
+		return {};
+	}
+
+	auto meshData = loader->loadMesh(descriptor);
+	updateMemoryUsage(descriptor.absPath);
+	if (meshData) {
+		meshData_[key] = meshData;
+	} else if (it != meshData_.end()) {
+		meshData_.erase(it);
+	}
+	return meshData;
 }
 
 const core::MeshScenegraph *components::MeshCacheImpl::getMeshScenegraph(const std::string &absPath) {
 	auto *loader = getLoader(absPath);
 	assert(loader != nullptr);
-	return loader->getScenegraph(absPath);
+	auto scenegraph = loader->getScenegraph(absPath);
+	updateMemoryUsage(absPath);
+	return scenegraph;
 }
 
 std::string components::MeshCacheImpl::getMeshError(const std::string &absPath) {
@@ -71,25 +127,179 @@ std::string components::MeshCacheImpl::getMeshError(const std::string &absPath)
 int components::MeshCacheImpl::getTotalMeshCount(const std::string &absPath) {
 	auto *loader = getLoader(absPath);
 	assert(loader != nullptr);
-	return loader->getTotalMeshCount();
+	auto &entry = meshCacheEntries_.at(absPath);
+	if (entry.totalMeshCount < 0) {
+		entry.totalMeshCount = loader->getTotalMeshCount();
+		updateMemoryUsage(absPath);
+	}
+	return entry.totalMeshCount;
 }
 
 core::SharedAnimationSamplerData MeshCacheImpl::getAnimationSamplerData(const std::string &absPath, int animIndex, int samplerIndex) {
 	auto *loader = getLoader(absPath);
 	assert(loader != nullptr);
-	return loader->getAnimationSamplerData(absPath, animIndex, samplerIndex);
+	auto samplerData = loader->getAnimationSamplerData(absPath, animIndex, samplerIndex);
+	updateMemoryUsage(absPath);
+	return samplerData;
 }
 
 core::SharedSkinData MeshCacheImpl::loadSkin(const std::string &absPath, int skinIndex, std::string &outError) {
 	auto *loader = getLoader(absPath);
 	assert(loader != nullptr);
-	return loader->loadSkin(absPath, skinIndex, outError);
+	auto skinData = loader->loadSkin(absPath, skinIndex, outError);
+	updateMemoryUsage(absPath);
+	return skinData;
 }
 
 void MeshCacheImpl::forceReloadCachedMesh(const std::string &absPath) {
 	auto *loader = getLoader(absPath);
 	if (loader) {
 		loader->reset();
+		auto &entry = meshCacheEntries_.at(absPath);
+		memoryUsage_ -= entry.memoryUsage;
+		entry.memoryUsage = 0;
+		entry.totalMeshCount = -1;
+		entry.fileLoaded = false;
+		entry.loadFailed = false;
+	}
+	if (auto it = pendingLoads_.find(absPath); it != pendingLoads_.end()) {
+		it->second.stale = true;
+	}
+	eraseCachedMeshData(absPath);
+}
+
+void MeshCacheImpl::setAsyncLoading(bool enable) {
+	if (!enable) {
+		waitForPendingLoads();
+	}
+	asyncLoading_ = enable;
+}
+
+bool MeshCacheImpl::asyncLoading() const {
+	return asyncLoading_;
+}
+
+bool MeshCacheImpl::isLoading(const std::string &absPath) {
+	return pendingLoads_.find(absPath) != pendingLoads_.end();
+}
+
+bool MeshCacheImpl::hasPendingLoads() const {
+	return !pendingLoads_.empty();
+}
+
+bool MeshCacheImpl::processFinishedLoads() {
+	std::vector<std::string> finished;
+	for (const auto &[absPath, pending] : pendingLoads_) {
+		if (pending.result.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+			finished.emplace_back(absPath);
+		}
+	}
+
+	for (const auto &absPath : finished) {
+		auto pending = std::move(pendingLoads_.extract(absPath).mapped());
+		auto result = pending.result.get();
+		auto entryIt = meshCacheEntries_.find(absPath);
+		if (!pending.stale && entryIt != meshCacheEntries_.end()) {
+			LOG_DEBUG(log_system::MESH_LOADER, "Finished background loading of mesh file: {}", absPath);
+			// Keep the current loader if the file has been loaded synchronously in the meantime,
+			// e.g. by a glTF import: pointers to its scenegraph may still be in use.
+			if (!entryIt->second.fileLoaded) {
+				entryIt->second.loader = std::move(result.loader);
+				updateMemoryUsage(absPath);
+				entryIt->second.loadFailed = !entryIt->second.fileLoaded;
+			}
+			if (result.meshData) {
+				meshData_[meshDataKey(pending.descriptor)] = result.meshData;
+			}
+		}
+		// The callbacks will obtain the loaded mesh data from loadMesh, or start loading again if the file has changed.
+		notifyCallbacks(absPath);
+	}
+	return !finished.empty();
+}
+
+void MeshCacheImpl::waitForPendingLoads() {
+	while (!pendingLoads_.empty()) {
+		for (const auto &[absPath, pending] : pendingLoads_) {
+			pending.result.wait();
+		}
+		processFinishedLoads();
+	}
+}
+
+void MeshCacheImpl::eraseCachedMeshData(const std::string &absPath) {
+	auto it = meshData_.lower_bound(MeshDataKey{absPath, std::numeric_limits<int>::min(), false});
+	while (it != meshData_.end() && std::get<0>(it->first) == absPath) {
+		it = meshData_.erase(it);
+	}
+}
+
+void MeshCacheImpl::setMemoryBudget(size_t memoryBudget) {
+	memoryBudget_ = memoryBudget;
+	evict({});
+}
+
+size_t MeshCacheImpl::memoryBudget() const {
+	return memoryBudget_;
+}
+
+MeshCacheImpl::Statistics MeshCacheImpl::statistics() const {
+	Statistics stats;
+	stats.memoryBudget = memoryBudget_;
+	stats.memoryUsage = memoryUsage_;
+	stats.entryCount = meshCacheEntries_.size();
+	stats.loadedEntryCount = std::count_if(meshCacheEntries_.begin(), meshCacheEntries_.end(), [](const auto &item) {
+		return item.second.memoryUsage > 0;
+	});
+	stats.fileLoadCount = fileLoadCount_;
+	stats.evictionCount = evictionCount_;
+	stats.meshDataHitCount = meshDataHitCount_;
+	stats.pendingLoadCount = pendingLoads_.size();
+	return stats;
+}
+
+void MeshCacheImpl::updateMemoryUsage(const std::string &absPath) {
+	auto &entry = meshCacheEntries_.at(absPath);
+	auto usage = entry.loader->memoryUsage();
+	if (entry.memoryUsage == 0 && usage > 0) {
+		++fileLoadCount_;
+	}
+	memoryUsage_ = memoryUsage_ - entry.memoryUsage + usage;
+	entry.memoryUsage = usage;
+	// Loaders which failed to parse the file don't use any memory.
+	entry.fileLoaded = usage > 0;
+	evict(absPath);
+}
+
+void MeshCacheImpl::refreshMemoryUsage() {
+	for (auto &[absPath, entry] : meshCacheEntries_) {
+		if (entry.fileLoaded) {
+			auto usage = entry.loader->memoryUsage();
+			memoryUsage_ = memoryUsage_ - entry.memoryUsage + usage;
+			entry.memoryUsage = usage;
+		}
+	}
+}
+
+void MeshCacheImpl::evict(const std::string &keepAbsPath) {
+	refreshMemoryUsage();
+	// The number of files is small: a linear search for the least recently used entry is sufficient.
+	while (memoryUsage_ > memoryBudget_) {
+		auto lruIt = meshCacheEntries_.end();
+		for (auto it = meshCacheEntries_.begin(); it != meshCacheEntries_.end(); ++it) {
+			if (it->second.memoryUsage > 0 && it->first != keepAbsPath && (lruIt == meshCacheEntries_.end() || it->second.lastUse < lruIt->second.lastUse)) {
+				lruIt = it;
+			}
+		}
+		if (lruIt == meshCacheEntries_.end()) {
+			break;
+		}
+		LOG_DEBUG(log_system::MESH_LOADER, "Discard cached file to meet the mesh cache memory budget: {}", lruIt->first);
+		lruIt->second.loader->reset();
+		memoryUsage_ -= lruIt->second.memoryUsage;
+		lruIt->second.memoryUsage = 0;
+		lruIt->second.fileLoaded = false;
+		++evictionCount_;
 	}
 }
 
@@ -110,14 +320,21 @@ core::MeshCacheEntry *MeshCacheImpl::getLoader(std::string absPath) {
 		// will use the loader from the cache which is outdated since it has not been updated due to the lack of 
 		// a file watcher.
 		assert(callbacks_.find(absPath) != callbacks_.end());
-		if (meshCacheEntries_.count(absPath) == 0) {
-			if (isGltfMesh) {
-				meshCacheEntries_[absPath] = std::unique_ptr<core::MeshCacheEntry>(new mesh_loader::glTFFileLoader(absPath));
-			} else if (isCTMMesh) {
-				meshCacheEntries_[absPath] = std::unique_ptr<core::MeshCacheEntry>(new mesh_loader::CTMFileLoader(absPath));
-			}
+		auto &entry = meshCacheEntries_[absPath];
+		if (!entry.loader) {
+			entry.loader = createLoader(absPath);
 		}
-		return meshCacheEntries_[absPath].get();
+		entry.lastUse = ++useCounter_;
+		return entry.loader.get();
+	}
+	return nullptr;
+}
+
+core::UniqueMeshCacheEntry MeshCacheImpl::createLoader(const std::string &absPath) {
+	if (endsWith(absPath, ".gltf") || endsWith(absPath, ".glb")) {
+		return std::unique_ptr<core::MeshCacheEntry>(new mesh_loader::glTFFileLoader(absPath));
+	} else if (endsWith(absPath, ".ctm")) {
+		return std::unique_ptr<core::MeshCacheEntry>(new mesh_loader::CTMFileLoader(absPath));
 	}
 	return nullptr;
 }
@@ -14,6 +14,8 @@
 #include "core/PathManager.h"
 #include <QSettings>
 
+#include <algorithm>
+
 namespace raco::components {
 
 RaCoPreferences::RaCoPreferences() {
@@ -39,6 +41,11 @@ bool RaCoPreferences::save() {
 	settings.setValue("preventAccidentalUpgrade", preventAccidentalUpgrade);
 	settings.setValue("globalPythonOnSaveScript", globalPythonOnSaveScript);
 	settings.setValue("enableProjectPythonScript", enableProjectPythonScript);
+	settings.setValue("writeProjectObjectIndex", writeProjectObjectIndex);
+	settings.setValue("undoStackMaxEntries", undoStackMaxEntries);
+	settings.setValue("undoStackMemoryLimitMB", undoStackMemoryLimitMB);
+	settings.setValue("undoStackDeltaStorage", undoStackDeltaStorage);
+	settings.setValue("idleFrameIntervalMs", idleFrameIntervalMs);
 
 	settings.sync();
 
@@ -67,6 +74,13 @@ void RaCoPreferences::load() {
 
 	globalPythonOnSaveScript = settings.value("globalPythonOnSaveScript", "").toString();
 	enableProjectPythonScript = settings.value("enableProjectPythonScript", "").toBool();
+	writeProjectObjectIndex = settings.value("writeProjectObjectIndex", true).toBool();
+
+	undoStackMaxEntries = std::max(0, settings.value("undoStackMaxEntries", 0).toInt());
+	undoStackMemoryLimitMB = std::max(0, settings.value("undoStackMemoryLimitMB", 0).toInt());
+	undoStackDeltaStorage = settings.value("undoStackDeltaStorage", false).toBool();
+
+	idleFrameIntervalMs = std::max(0, settings.value("idleFrameIntervalMs", 500).toInt());
 }
 
 RaCoPreferences& RaCoPreferences::instance() noexcept {
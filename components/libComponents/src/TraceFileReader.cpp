@@ -0,0 +1,191 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "components/TraceFileReader.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include <algorithm>
+
+namespace raco::components {
+
+namespace {
+constexpr qint64 SCAN_CHUNK_SIZE = 1024 * 1024;
+
+bool isJsonWhitespace(char c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+}  // namespace
+
+bool TraceFileReader::open(const std::string& fileName, QJsonParseError& outError) {
+	close();
+	outError = {};
+	rootIsArray_ = true;
+
+	file_.setFileName(QString::fromStdString(fileName));
+	if (!file_.open(QIODevice::ReadOnly)) {
+		outError.error = QJsonParseError::IllegalValue;
+		return false;
+	}
+
+	auto fail = [this, &outError](QJsonParseError::ParseError error, qint64 offset) {
+		outError.error = error;
+		outError.offset = static_cast<int>(offset);
+		close();
+		return false;
+	};
+
+	// Nesting depth: the root array is depth 1, the frames start at depth 1.
+	int depth = 0;
+	bool rootClosed = false;
+	bool inString = false;
+	bool escaped = false;
+	int line = 1;
+	qint64 frameStart = -1;
+	int frameLine = 0;
+	qint64 lastNonWhitespace = -1;
+
+	auto endFrame = [this, &frameStart, &frameLine, &lastNonWhitespace]() {
+		if (frameStart >= 0) {
+			frames_.emplace_back(FrameLocation{frameStart, lastNonWhitespace + 1 - frameStart, frameLine});
+			frameStart = -1;
+		}
+	};
+
+	qint64 position = 0;
+	while (!file_.atEnd()) {
+		const QByteArray chunk = file_.read(SCAN_CHUNK_SIZE);
+		for (qint64 index = 0; index < chunk.size(); ++index, ++position) {
+			const char c = chunk[static_cast<int>(index)];
+			if (c == '\n') {
+				++line;
+			}
+
+			if (inString) {
+				if (escaped) {
+					escaped = false;
+				} else if (c == '\\') {
+					escaped = true;
+				} else if (c == '"') {
+					inString = false;
+				}
+				lastNonWhitespace = position;
+				continue;
+			}
+
+			if (isJsonWhitespace(c)) {
+				continue;
+			}
+
+			if (rootClosed) {
+				return fail(QJsonParseError::GarbageAtEnd, position);
+			}
+
+			if (depth == 0) {
+				if (c != '[') {
+					rootIsArray_ = false;
+					return fail(QJsonParseError::MissingObject, position);
+				}
+				depth = 1;
+				continue;
+			}
+
+			if (depth == 1 && (c == ',' || c == ']')) {
+				if (c == ',' && frameStart < 0) {
+					return fail(QJsonParseError::IllegalValue, position);
+				}
+				endFrame();
+				if (c == ']') {
+					depth = 0;
+					rootClosed = true;
+				}
+				continue;
+			}
+
+			if (depth == 1 && frameStart < 0) {
+				frameStart = position;
+				frameLine = line;
+			}
+
+			switch (c) {
+				case '"':
+					inString = true;
+					break;
+				case '{':
+				case '[':
+					++depth;
+					break;
+				case '}':
+				case ']':
+					if (depth <= 1) {
+						return fail(QJsonParseError::IllegalValue, position);
+					}
+					--depth;
+					break;
+				default:
+					break;
+			}
+			lastNonWhitespace = position;
+		}
+	}
+
+	if (depth == 0 && !rootClosed) {
+		return fail(QJsonParseError::IllegalValue, position);
+	}
+	if (!rootClosed) {
+		return fail(inString ? QJsonParseError::UnterminatedString : QJsonParseError::UnterminatedArray, position);
+	}
+	return true;
+}
+
+void TraceFileReader::close() {
+	if (file_.isOpen()) {
+		file_.close();
+	}
+	frames_.clear();
+}
+
+bool TraceFileReader::isOpen() const {
+	return file_.isOpen();
+}
+
+bool TraceFileReader::rootIsArray() const {
+	return rootIsArray_;
+}
+
+int TraceFileReader::frameCount() const {
+	return static_cast<int>(frames_.size());
+}
+
+int TraceFileReader::frameLine(int frameIndex) const {
+	return frames_.at(frameIndex).line;
+}
+
+QByteArray TraceFileReader::readFrameText(int frameIndex) {
+	const auto& location = frames_.at(frameIndex);
+	if (!file_.seek(location.offset)) {
+		return {};
+	}
+	return file_.read(location.size);
+}
+
+QJsonValue TraceFileReader::readFrame(int frameIndex, QJsonParseError& outError) {
+	// Wrap the frame in an array: QJsonDocument only accepts objects and arrays at the top level
+	// and frames which are no objects are reported by the player during playback.
+	const QByteArray text = "[" + readFrameText(frameIndex) + "]";
+	const auto document = QJsonDocument::fromJson(text, &outError);
+	if (outError.error != QJsonParseError::NoError) {
+		outError.offset = static_cast<int>(frames_.at(frameIndex).offset + std::max(outError.offset - 1, 0));
+		return QJsonValue::Undefined;
+	}
+	return document.array().at(0);
+}
+
+}  // namespace raco::components
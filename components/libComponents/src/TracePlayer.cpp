@@ -9,6 +9,7 @@
  */
 #include "components/TracePlayer.h"
 
+#include "components/TraceFileReader.h"
 #include "core/CodeControlledPropertyModifier.h"
 #include "core/CoreAnnotations.h"
 #include "core/EditorObject.h"
@@ -22,6 +23,7 @@
 #include "user_types/LuaScript.h"
 
 #include <QFile>
+#include <QFileInfo>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -29,6 +31,7 @@
 #include <QString>
 
 #include <algorithm>
+#include <map>
 #include <utility>
 
 namespace raco::components {
@@ -104,6 +107,19 @@ void TracePlayer::CodeControlledObjectExtension::setCodeControlledValueHandle(co
 	core::CodeControlledPropertyModifier::setPrimitive(handle, value, uiChanges_);
 }
 
+struct TracePlayer::StreamingState {
+	TraceFileReader reader;
+	int keyframeInterval{DEFAULT_STREAMING_KEYFRAME_INTERVAL};
+	/// names of all Lua objects in the SceneData of any frame, in order of first appearance
+	std::vector<std::string> luaNames;
+	/// set once the keyframes are built; from then on frames are rebuilt into full states like in memory mode
+	bool consistent{false};
+	/// full frames at every keyframeInterval-th index
+	std::vector<QJsonObject> keyframes;
+	/// recently materialized frames, bounded to two keyframe intervals
+	std::map<int, QJsonObject> window;
+};
+
 core::DataChangeRecorder& TracePlayer::uiChanges() const {
 	return racoCoreInterface_->uiChanges();
 }
@@ -155,6 +171,11 @@ QJsonArray const* const TracePlayer::loadTrace(const std::string& fileName) {
 		return nullptr;
 	}
 
+	/// stream large trace files from disk instead of loading them into memory
+	if (QFileInfo(QString::fromStdString(fileName)).size() > streamingThreshold_) {
+		return loadTraceStreaming(fileName);
+	}
+
 	/// open trace file and validate its format
 	QFile qTraceFile(QString::fromStdString(fileName));
 	if (!qTraceFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
@@ -193,6 +214,7 @@ QJsonArray const* const TracePlayer::loadTrace(const std::string& fileName) {
 
 	/// parse root JSON array
 	qjRoot_ = std::make_unique<QJsonArray>(qjDocument.array());
+	streaming_.reset();
 
 	/// initialize traceplayer
 	setState(PlayerState::Init);
@@ -208,6 +230,177 @@ QJsonArray const* const TracePlayer::loadTrace(const std::string& fileName) {
 	return qjRoot_.get();
 }
 
+QJsonArray const* const TracePlayer::loadTraceStreaming(const std::string& fileName) {
+	auto streaming{std::make_unique<StreamingState>()};
+	streaming->keyframeInterval = streamingKeyframeInterval_;
+
+	/// index the frames of the trace file
+	QJsonParseError qjParseError{};
+	if (!streaming->reader.open(fileName, qjParseError)) {
+		if (!streaming->reader.rootIsArray()) {
+			addError("Invalid trace file! Root member must be an JSON array representing the list of frames. For more details, refer to Ramses Composer documentation. ( filePath: " + fileName + " )", core::ErrorLevel::ERROR);
+		} else {
+			qjParseErrMsg(qjParseError, fileName);
+		}
+		failSafe();
+		return nullptr;
+	}
+
+	/// validate all frames and collect timestamps and Lua names, keeping only one frame in memory at a time
+	std::vector<int> framesTsList;
+	std::unordered_set<std::string> luaNameSet;
+	for (int frameIndex{0}; frameIndex < streaming->reader.frameCount(); ++frameIndex) {
+		const auto qjFrameVal{streaming->reader.readFrame(frameIndex, qjParseError)};
+		if (qjParseError.error) {
+			qjParseErrMsg(qjParseError, fileName);
+			failSafe();
+			return nullptr;
+		}
+		const auto qjFrame{qjFrameVal.toObject()};
+		const auto qjSceneData{parseSceneData(qjFrame)};
+		for (auto itr{qjSceneData.constBegin()}; itr != qjSceneData.constEnd(); ++itr) {
+			if (auto luaObjName{itr.key().toStdString()}; luaNameSet.insert(luaObjName).second) {
+				streaming->luaNames.emplace_back(luaObjName);
+			}
+		}
+		framesTsList.emplace_back(parseTimestamp(parseTracePlayerData(qjFrame)));
+	}
+
+	/// initialize traceplayer
+	streaming_ = std::move(streaming);
+	qjRoot_ = std::make_unique<QJsonArray>();
+	setState(PlayerState::Init);
+	filePath_ = fileName;
+	speed_ = 1.0;
+	framesTsList_ = std::move(framesTsList);
+	clearLog();
+	stop();
+
+	/// match scene Lua objects and build the keyframes
+	std::unordered_set<core::SEditorObject> sceneLuaList;
+	for (const auto& luaObjName : streaming_->luaNames) {
+		if (const auto lua{findLua(luaObjName, false)}) {
+			sceneLuaList.emplace(lua);
+		}
+	}
+	makeStreamedFramesConsistent(sceneLuaList);
+
+	return qjRoot_.get();
+}
+
+void TracePlayer::makeStreamedFramesConsistent(std::unordered_set<core::SEditorObject> const& sceneLuaList) {
+	if (sceneLuaList.empty()) {
+		return;
+	}
+
+	QJsonValue qjSceneData{buildFullFrameFromLua(sceneLuaList)};
+	for (int frameIndex{0}; frameIndex < getTraceLen(); ++frameIndex) {
+		auto qjFrame{readStreamedFrame(frameIndex)};
+		std::vector<std::string> propertyPath;
+		readLinesOfStreamedFrame(frameIndex);
+		qjSceneData = deepAddMissingProperties(qjSceneData, parseSceneData(qjFrame), propertyPath, frameIndex);
+		if (frameIndex % streaming_->keyframeInterval == 0) {
+			qjFrame["SceneData"] = qjSceneData;
+			streaming_->keyframes.emplace_back(qjFrame);
+		}
+	}
+	streaming_->consistent = true;
+	streaming_->window.clear();
+
+	if (onLogChange_) {
+		onLogChange_(logReport_, highestCriticality_);
+	}
+	traceFileLines_.clear();
+}
+
+QJsonObject TracePlayer::readStreamedFrame(int frameIndex) {
+	QJsonParseError qjParseError{};
+	const auto qjFrameVal{streaming_->reader.readFrame(frameIndex, qjParseError)};
+	if (qjParseError.error) {
+		/// all frames were valid when loading the trace, so the file has been modified since
+		qjParseErrMsg(qjParseError, filePath_);
+		return QJsonObject();
+	}
+	return qjFrameVal.toObject();
+}
+
+QJsonObject TracePlayer::materializeFrame(int frameIndex) {
+	auto& streaming{*streaming_};
+	if (!streaming.consistent) {
+		return readStreamedFrame(frameIndex);
+	}
+
+	if (const auto itr{streaming.window.find(frameIndex)}; itr != streaming.window.end()) {
+		return itr->second;
+	}
+
+	/// start from the preceding keyframe or from a materialized frame between that keyframe and the requested frame
+	const auto keyframeIndex{frameIndex / streaming.keyframeInterval};
+	int baseIndex{keyframeIndex * streaming.keyframeInterval};
+	QJsonObject qjFrame{streaming.keyframes[keyframeIndex]};
+	if (auto itr{streaming.window.lower_bound(frameIndex)}; itr != streaming.window.begin()) {
+		--itr;
+		if (itr->first > baseIndex) {
+			baseIndex = itr->first;
+			qjFrame = itr->second;
+		}
+	}
+
+	/// apply the deltas of the following frames
+	for (int index{baseIndex + 1}; index <= frameIndex; ++index) {
+		auto qjNextFrame{readStreamedFrame(index)};
+		std::vector<std::string> propertyPath;
+		qjNextFrame["SceneData"] = deepAddMissingProperties(qjFrame.value("SceneData"), parseSceneData(qjNextFrame), propertyPath, index, false);
+		qjFrame = qjNextFrame;
+		streaming.window[index] = qjFrame;
+	}
+	streaming.window[frameIndex] = qjFrame;
+
+	/// keep the materialized frames closest to the requested frame
+	const auto maxWindowSize{static_cast<size_t>(2 * streaming.keyframeInterval)};
+	while (streaming.window.size() > maxWindowSize) {
+		if (frameIndex - streaming.window.begin()->first >= streaming.window.rbegin()->first - frameIndex) {
+			streaming.window.erase(streaming.window.begin());
+		} else {
+			streaming.window.erase(std::prev(streaming.window.end()));
+		}
+	}
+
+	return qjFrame;
+}
+
+void TracePlayer::readLinesOfStreamedFrame(int frameIndex) {
+	traceFileLines_.clear();
+	int lineNumber{streaming_->reader.frameLine(frameIndex)};
+	for (const auto& line : QString::fromUtf8(streaming_->reader.readFrameText(frameIndex)).split('\n')) {
+		traceFileLines_.push_front({lineNumber++, line});
+	}
+}
+
+void TracePlayer::setStreamingThreshold(int64_t bytes) {
+	streamingThreshold_ = bytes;
+}
+
+int64_t TracePlayer::getStreamingThreshold() const {
+	return streamingThreshold_;
+}
+
+void TracePlayer::setStreamingKeyframeInterval(int interval) {
+	streamingKeyframeInterval_ = std::max(interval, 1);
+}
+
+int TracePlayer::getStreamingKeyframeInterval() const {
+	return streamingKeyframeInterval_;
+}
+
+bool TracePlayer::isStreaming() const {
+	return streaming_ != nullptr;
+}
+
+int TracePlayer::getMaterializedFrameCount() const {
+	return streaming_ ? static_cast<int>(streaming_->window.size()) : 0;
+}
+
 void TracePlayer::qjParseErrMsg(const QJsonParseError& qjParseError, const std::string& fileName) {
 	std::string errorMsg{"Invalid trace file >> Parsing error! "};
 	switch (qjParseError.error) {
@@ -261,7 +454,7 @@ void TracePlayer::qjParseErrMsg(const QJsonParseError& qjParseError, const std::
 	addError(errorMsg, core::ErrorLevel::ERROR);
 }
 
-QJsonValue TracePlayer::deepAddMissingProperties(const QJsonValue& qjPrev, const QJsonValue& qjCurrent, std::vector<std::string>& propertyPath, int index) {
+QJsonValue TracePlayer::deepAddMissingProperties(const QJsonValue& qjPrev, const QJsonValue& qjCurrent, std::vector<std::string>& propertyPath, int index, bool logErrors) {
 	if (qjCurrent.type() == QJsonValue::Object) {
 		auto qjCurrObj{qjCurrent.toObject()};
 		const auto qjPrevObj{qjPrev.toObject()};
@@ -272,7 +465,7 @@ QJsonValue TracePlayer::deepAddMissingProperties(const QJsonValue& qjPrev, const
 			const auto qjCurrItr{qjCurrObj.find(propName)};
 			propertyPath.push_back(propName.toStdString());
 			if (qjCurrItr != qjCurrObj.end()) {
-				qjCurrObj[qjCurrItr.key()] = deepAddMissingProperties(qjPrevItr.value(), qjCurrItr.value(), propertyPath, index);
+				qjCurrObj[qjCurrItr.key()] = deepAddMissingProperties(qjPrevItr.value(), qjCurrItr.value(), propertyPath, index, logErrors);
 			} else {
 				qjCurrObj.insert(propName, qjPrevItr.value());
 			}
@@ -283,15 +476,17 @@ QJsonValue TracePlayer::deepAddMissingProperties(const QJsonValue& qjPrev, const
 		auto qjCurrItr{qjCurrObj.begin()};
 		while (qjCurrItr != qjCurrObj.end()) {
 			if (qjPrevObj.find(qjCurrItr.key()) == qjPrevObj.constEnd()) {
-				const auto propPathStream{streamKeysChain(propertyPath)};
-				const auto timestamp = parseTimestamp(parseTracePlayerData(parseFrame(index)));
-				const int lineNumber = getPropertyLineNumber(qjCurrItr.key());
-				if (propertyPath.empty()) {
-					addError("Step " + std::to_string(index) + ", Timestamp " + std::to_string(timestamp) + ", Trace line " + std::to_string(lineNumber) + ": Lua is not available in the scene! Lua and its properties are disregarded from trace ( luaObjName: " + propPathStream + qjCurrItr.key().toStdString() + " )", core::ErrorLevel::WARNING, false);
-				} else if (!qjCurrItr->isUndefined() && !qjCurrItr->isNull()) {
-					addError("Step " + std::to_string(index) + ", Timestamp " + std::to_string(timestamp) + ", Trace line " + std::to_string(lineNumber) + ": Lua property was not found in the scene! Property is disregarded from trace ( propName: " + propPathStream + "->" + qjCurrItr.key().toStdString() + " )", core::ErrorLevel::WARNING, false);
-				} else {
-					addError("Step " + std::to_string(index) + ", Timestamp " + std::to_string(timestamp) + ", Trace line " + std::to_string(lineNumber) + ": Unexpected JSON type! ( propName: " + qjCurrItr.key().toStdString() + " )", core::ErrorLevel::ERROR, false);
+				if (logErrors) {
+					const auto propPathStream{streamKeysChain(propertyPath)};
+					const auto timestamp = parseTimestamp(parseTracePlayerData(parseFrame(index)));
+					const int lineNumber = getPropertyLineNumber(qjCurrItr.key());
+					if (propertyPath.empty()) {
+						addError("Step " + std::to_string(index) + ", Timestamp " + std::to_string(timestamp) + ", Trace line " + std::to_string(lineNumber) + ": Lua is not available in the scene! Lua and its properties are disregarded from trace ( luaObjName: " + propPathStream + qjCurrItr.key().toStdString() + " )", core::ErrorLevel::WARNING, false);
+					} else if (!qjCurrItr->isUndefined() && !qjCurrItr->isNull()) {
+						addError("Step " + std::to_string(index) + ", Timestamp " + std::to_string(timestamp) + ", Trace line " + std::to_string(lineNumber) + ": Lua property was not found in the scene! Property is disregarded from trace ( propName: " + propPathStream + "->" + qjCurrItr.key().toStdString() + " )", core::ErrorLevel::WARNING, false);
+					} else {
+						addError("Step " + std::to_string(index) + ", Timestamp " + std::to_string(timestamp) + ", Trace line " + std::to_string(lineNumber) + ": Unexpected JSON type! ( propName: " + qjCurrItr.key().toStdString() + " )", core::ErrorLevel::ERROR, false);
+					}
 				}
 				qjCurrItr = qjCurrObj.erase(qjCurrItr);
 			} else {
@@ -433,6 +628,9 @@ std::string const& TracePlayer::getFilePath() const {
 }
 
 int TracePlayer::getTraceLen() const {
+	if (streaming_) {
+		return streaming_->reader.frameCount();
+	}
 	if (!qjRoot_) {
 		return -1;
 	}
@@ -518,7 +716,7 @@ QJsonObject TracePlayer::parseFrame(int frameIndex) {
 	}
 
 	/// parse and validate current frame
-	const auto qjFrameVal{qjRoot_->at(frameIndex)};
+	const auto qjFrameVal{streaming_ ? QJsonValue(materializeFrame(frameIndex)) : qjRoot_->at(frameIndex)};
 	if (qjFrameVal == QJsonValue::Undefined) {
 		addError("Frame entry was not found! ( frameNr: " + std::to_string(frameIndex) + " )", core::ErrorLevel::ERROR);
 		return QJsonObject();
@@ -858,19 +1056,30 @@ void TracePlayer::refresh(timeInMilliSeconds elapsedTimeSinceStart) {
 
 void TracePlayer::lockLua() {
 	core::SEditorObjectSet luaObjects;
-	for (int frameIndex{0}; frameIndex < getTraceLen(); ++frameIndex) {
-		const auto qjSceneData{parseSceneData(parseFrame(frameIndex))};
-		for (auto itr{qjSceneData.constBegin()}; itr != qjSceneData.constEnd(); ++itr) {
-			if (auto const lua{findLua(itr.key().toStdString())}) {
-				if (!racoCoreInterface_->project().isCodeCtrldObj(lua)) {
-					if (!user_types::Queries::isReadOnly(lua)) {
-						luaObjects.insert(lua);
-					} else {
-						addError("Could not lock Lua >> Object is read-only! ( luaObjName: " + lua->objectName() + " )", core::ErrorLevel::WARNING);
-					}
+	const auto addLua{[this, &luaObjects](const std::string& luaObjName) {
+		if (auto const lua{findLua(luaObjName)}) {
+			if (!racoCoreInterface_->project().isCodeCtrldObj(lua)) {
+				if (!user_types::Queries::isReadOnly(lua)) {
+					luaObjects.insert(lua);
 				} else {
-					addError("Could not lock Lua >> Object is already locked! ( luaObjName: " + lua->objectName() + " )", core::ErrorLevel::WARNING);
+					addError("Could not lock Lua >> Object is read-only! ( luaObjName: " + lua->objectName() + " )", core::ErrorLevel::WARNING);
 				}
+			} else {
+				addError("Could not lock Lua >> Object is already locked! ( luaObjName: " + lua->objectName() + " )", core::ErrorLevel::WARNING);
+			}
+		}
+	}};
+
+	if (streaming_) {
+		/// the Lua names were collected when indexing the trace, no need to materialize every frame
+		for (const auto& luaObjName : streaming_->luaNames) {
+			addLua(luaObjName);
+		}
+	} else {
+		for (int frameIndex{0}; frameIndex < getTraceLen(); ++frameIndex) {
+			const auto qjSceneData{parseSceneData(parseFrame(frameIndex))};
+			for (auto itr{qjSceneData.constBegin()}; itr != qjSceneData.constEnd(); ++itr) {
+				addLua(itr.key().toStdString());
 			}
 		}
 	}
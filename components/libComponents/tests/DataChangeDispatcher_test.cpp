@@ -20,6 +20,7 @@
 #include <components/DataChangeDispatcher.h>
 #include <ramses_base/HeadlessEngineBackend.h>
 
+#include <chrono>
 #include <memory>
 
 using namespace raco::user_types;
@@ -133,6 +134,108 @@ TEST_F(DataChangeDispatcherTest, registerOnChildren_dispatchEmitUpdated) {
 	testing::Mock::VerifyAndClearExpectations(&callback2);
 }
 
+TEST_F(DataChangeDispatcherTest, registerOnChildren_object_dispatchEmitsForNestedProperties) {
+	SEditorObject node = std::make_shared<Node>();
+	ValueHandle translationX{node, {"translation", "x"}};
+	ValueHandle scalingY{node, {"scaling", "y"}};
+
+	testing::MockFunction<void(ValueHandle)> callback{};
+	EXPECT_CALL(callback, Call(translationX)).Times(1);
+	EXPECT_CALL(callback, Call(scalingY)).Times(1);
+
+	auto subscription = underTest.registerOnChildren(ValueHandle{node}, callback.AsStdFunction());
+
+	context.set(translationX, 1.0);
+	context.set(scalingY, 2.0);
+	underTest.dispatch(recorder.release());
+
+	testing::Mock::VerifyAndClearExpectations(&callback);
+}
+
+TEST_F(DataChangeDispatcherTest, dispatchDoesntEmitForSubscriptionDestroyedDuringDispatch) {
+	SEditorObject node = std::make_shared<Node>();
+	ValueHandle translation{node, {"translation"}};
+	ValueHandle x{translation.get("x")};
+
+	Subscription subscription2;
+	testing::MockFunction<void(ValueHandle)> callback2{};
+	EXPECT_CALL(callback2, Call(x)).Times(0);
+
+	auto subscription1 = underTest.registerOnChildren(translation, [&subscription2](ValueHandle) {
+		subscription2 = Subscription{};
+	});
+	subscription2 = underTest.registerOnChildren(translation, callback2.AsStdFunction());
+
+	context.set(x, 1.0);
+	underTest.dispatch(recorder.release());
+
+	testing::Mock::VerifyAndClearExpectations(&callback2);
+}
+
+TEST_F(DataChangeDispatcherTest, dispatchEmitsForSubscriptionsCreatedAfterManyDestroyed) {
+	SEditorObject node = std::make_shared<Node>();
+	ValueHandle valueHandle{node, {"translation", "x"}};
+
+	for (int i = 0; i < 100; i++) {
+		auto subscription = underTest.registerOn(valueHandle, []() {});
+	}
+
+	testing::MockFunction<void()> callback{};
+	EXPECT_CALL(callback, Call()).Times(1);
+	auto subscription = underTest.registerOn(valueHandle, callback.AsStdFunction());
+
+	context.set(valueHandle, 1.0);
+	underTest.dispatch(recorder.release());
+
+	testing::Mock::VerifyAndClearExpectations(&callback);
+}
+
+#ifdef NDEBUG
+TEST_F(DataChangeDispatcherTest, benchmark_dispatch_listener_and_change_count) {
+	// Roughly the subscriptions of the property browser for a Node: the object, the vector properties and their components.
+	const std::vector<std::string> vectorProperties{"translation", "rotation", "scaling"};
+	const std::vector<std::string> components{"x", "y", "z"};
+	constexpr int listenersPerNode = 13;
+	constexpr int numChanges = 100;
+	constexpr int repetitions = 10;
+
+	// Dispatch the same number of changes with a growing number of listeners on other objects.
+	auto timeDispatch = [&](int numListeners) {
+		std::vector<SEditorObject> nodes;
+		std::vector<Subscription> subscriptions;
+		for (int index = 0; index < numListeners / listenersPerNode; index++) {
+			auto node = nodes.emplace_back(std::make_shared<Node>());
+			subscriptions.emplace_back(underTest.registerOnChildren(ValueHandle{node}, [](ValueHandle) {}));
+			for (const auto& property : vectorProperties) {
+				subscriptions.emplace_back(underTest.registerOnChildren(ValueHandle{node, {property}}, [](ValueHandle) {}));
+				for (const auto& component : components) {
+					subscriptions.emplace_back(underTest.registerOn(ValueHandle{node, {property, component}}, []() {}));
+				}
+			}
+		}
+
+		std::chrono::steady_clock::duration elapsed{0};
+		for (int repetition = 0; repetition < repetitions; repetition++) {
+			for (int change = 0; change < numChanges; change++) {
+				context.set(ValueHandle{nodes[change], {"translation", "x"}}, static_cast<double>(repetition + 1));
+			}
+			auto changes = recorder.release();
+			auto start = std::chrono::steady_clock::now();
+			underTest.dispatch(changes);
+			elapsed += std::chrono::steady_clock::now() - start;
+		}
+		return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / repetitions;
+	};
+
+	auto fewListenersUs = timeDispatch(2000);
+	auto manyListenersUs = timeDispatch(100000);
+
+	// The listeners are looked up by the changed objects: 50 times as many listeners must not make the dispatch
+	// noticeably slower. The constant allows for timer resolution and noise.
+	EXPECT_LE(manyListenersUs, 3 * fewListenersUs + 1000);
+}
+#endif
+
 class LifeCycleListenertest : public DataChangeDispatcherTest {
 public:
 	LifeCycleListenertest() {
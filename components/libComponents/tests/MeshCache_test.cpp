@@ -0,0 +1,182 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "gtest/gtest.h"
+
+#include "components/MeshCacheImpl.h"
+#include "testing/TestEnvironmentCore.h"
+
+using namespace raco::core;
+
+class MeshCacheTest : public TestEnvironmentCore {
+protected:
+	MeshDescriptor descriptor(const std::string& relPath, bool bake = true) {
+		auto absPath = (test_path() / relPath).string();
+		if (listeners_.find(absPath) == listeners_.end()) {
+			listeners_[absPath] = meshCache.registerFileChangedHandler(absPath, {nullptr, nullptr});
+		}
+		return MeshDescriptor{absPath, 0, bake};
+	}
+
+	std::map<std::string, FileChangeMonitor::UniqueListener> listeners_;
+};
+
+TEST_F(MeshCacheTest, load_mesh_shares_mesh_data) {
+	auto duck = meshCache.loadMesh(descriptor("meshes/Duck.glb"));
+	auto duckAgain = meshCache.loadMesh(descriptor("meshes/Duck.glb"));
+	auto duckUnbaked = meshCache.loadMesh(descriptor("meshes/Duck.glb", false));
+
+	ASSERT_TRUE(duck != nullptr);
+	EXPECT_EQ(duck, duckAgain);
+	EXPECT_NE(duck, duckUnbaked);
+
+	auto stats = meshCache.statistics();
+	EXPECT_EQ(stats.meshDataHitCount, 1);
+	EXPECT_EQ(stats.fileLoadCount, 1);
+	EXPECT_EQ(stats.entryCount, 1);
+	EXPECT_EQ(stats.loadedEntryCount, 1);
+	EXPECT_GT(stats.memoryUsage, 0);
+}
+
+TEST_F(MeshCacheTest, memory_budget_discards_least_recently_used_files) {
+	meshCache.setMemoryBudget(0);
+
+	auto duck = meshCache.loadMesh(descriptor("meshes/Duck.glb", false));
+	auto duckMeshCount = meshCache.getTotalMeshCount(descriptor("meshes/Duck.glb").absPath);
+	EXPECT_EQ(meshCache.statistics().loadedEntryCount, 1);
+
+	auto car = meshCache.loadMesh(descriptor("meshes/ToyCar/ToyCar.gltf", false));
+	ASSERT_TRUE(car != nullptr);
+	auto stats = meshCache.statistics();
+	EXPECT_EQ(stats.entryCount, 2);
+	EXPECT_EQ(stats.loadedEntryCount, 1);
+	EXPECT_EQ(stats.fileLoadCount, 2);
+	EXPECT_EQ(stats.evictionCount, 1);
+
+	// Extracted data stays valid after the file has been discarded
+	ASSERT_TRUE(duck != nullptr);
+	auto position = duck->attribIndex(MeshData::ATTRIBUTE_POSITION);
+	ASSERT_GE(position, 0);
+	EXPECT_EQ(duck->attribElementCount(position), duck->numVertices());
+	EXPECT_NE(duck->attribBuffer(position), nullptr);
+
+	// The mesh count is remembered and doesn't cause a reload
+	EXPECT_EQ(meshCache.getTotalMeshCount(descriptor("meshes/Duck.glb").absPath), duckMeshCount);
+	EXPECT_EQ(meshCache.statistics().fileLoadCount, 2);
+
+	// Discarded files are loaded again on demand
+	auto duckBaked = meshCache.loadMesh(descriptor("meshes/Duck.glb"));
+	ASSERT_TRUE(duckBaked != nullptr);
+	stats = meshCache.statistics();
+	EXPECT_EQ(stats.fileLoadCount, 3);
+	EXPECT_EQ(stats.evictionCount, 2);
+	EXPECT_EQ(stats.loadedEntryCount, 1);
+}
+
+TEST_F(MeshCacheTest, set_memory_budget_discards_files) {
+	meshCache.loadMesh(descriptor("meshes/Duck.glb"));
+	meshCache.loadMesh(descriptor("meshes/ToyCar/ToyCar.gltf"));
+	EXPECT_EQ(meshCache.statistics().loadedEntryCount, 2);
+
+	meshCache.setMemoryBudget(0);
+	auto stats = meshCache.statistics();
+	EXPECT_EQ(stats.memoryBudget, 0);
+	EXPECT_EQ(stats.memoryUsage, 0);
+	EXPECT_EQ(stats.loadedEntryCount, 0);
+	EXPECT_EQ(stats.evictionCount, 2);
+}
+
+TEST_F(MeshCacheTest, memory_usage_excludes_buffers_referenced_by_meshes) {
+	auto baked = meshCache.loadMesh(descriptor("meshes/Duck.glb"));
+	ASSERT_TRUE(baked != nullptr);
+	auto usage = meshCache.statistics().memoryUsage;
+
+	// Discarding the file would not release the buffers referenced by the unbaked mesh.
+	auto unbaked = meshCache.loadMesh(descriptor("meshes/Duck.glb", false));
+	ASSERT_TRUE(unbaked != nullptr);
+	EXPECT_LT(meshCache.statistics().memoryUsage, usage);
+
+	unbaked.reset();
+	meshCache.setMemoryBudget(meshCache.memoryBudget());
+	EXPECT_EQ(meshCache.statistics().memoryUsage, usage);
+}
+
+TEST_F(MeshCacheTest, unregister_releases_memory) {
+	meshCache.loadMesh(descriptor("meshes/Duck.glb"));
+	EXPECT_GT(meshCache.statistics().memoryUsage, 0);
+
+	listeners_.clear();
+	auto stats = meshCache.statistics();
+	EXPECT_EQ(stats.entryCount, 0);
+	EXPECT_EQ(stats.memoryUsage, 0);
+}
+
+TEST_F(MeshCacheTest, async_load_mesh) {
+	meshCache.setAsyncLoading(true);
+	auto desc = descriptor("meshes/Duck.glb");
+
+	EXPECT_EQ(meshCache.loadMesh(desc), nullptr);
+	EXPECT_TRUE(meshCache.isLoading(desc.absPath));
+	EXPECT_EQ(meshCache.statistics().pendingLoadCount, 1);
+	// Further requests don't start another load
+	EXPECT_EQ(meshCache.loadMesh(descriptor("meshes/Duck.glb", false)), nullptr);
+	EXPECT_EQ(meshCache.statistics().pendingLoadCount, 1);
+
+	meshCache.waitForPendingLoads();
+	EXPECT_FALSE(meshCache.isLoading(desc.absPath));
+
+	// The file loaded in the background is used for further requests without loading it again
+	ASSERT_TRUE(meshCache.loadMesh(desc) != nullptr);
+	ASSERT_TRUE(meshCache.loadMesh(descriptor("meshes/Duck.glb", false)) != nullptr);
+	auto stats = meshCache.statistics();
+	EXPECT_EQ(stats.pendingLoadCount, 0);
+	EXPECT_EQ(stats.fileLoadCount, 1);
+	EXPECT_EQ(stats.loadedEntryCount, 1);
+}
+
+TEST_F(MeshCacheTest, async_load_updates_mesh_object) {
+	meshCache.setAsyncLoading(true);
+	auto mesh = create<user_types::Mesh>("mesh");
+	commandInterface.set({mesh, &user_types::Mesh::uri_}, (test_path() / "meshes/Duck.glb").string());
+
+	EXPECT_EQ(mesh->meshData(), nullptr);
+	EXPECT_TRUE(meshCache.isLoading((test_path() / "meshes/Duck.glb").string()));
+	ASSERT_TRUE(errors.hasError({mesh}));
+	EXPECT_EQ(errors.getError({mesh}).level(), ErrorLevel::INFORMATION);
+
+	recorder.reset();
+	meshCache.waitForPendingLoads();
+
+	ASSERT_TRUE(mesh->meshData() != nullptr);
+	EXPECT_GT(mesh->meshData()->numVertices(), 0);
+	EXPECT_TRUE(recorder.getPreviewDirtyObjects().count(mesh) > 0);
+	EXPECT_NE(errors.getError({mesh}).message().find("Mesh information"), std::string::npos);
+}
+
+TEST_F(MeshCacheTest, async_failed_load_keeps_error_without_reloading) {
+	meshCache.setAsyncLoading(true);
+	TextFile meshFile = makeFile("invalid.gltf", "not a glTF file");
+	auto mesh = create<user_types::Mesh>("mesh");
+	commandInterface.set({mesh, &user_types::Mesh::uri_}, meshFile.path.string());
+	EXPECT_TRUE(meshCache.isLoading(meshFile.path.string()));
+
+	meshCache.waitForPendingLoads();
+
+	EXPECT_EQ(mesh->meshData(), nullptr);
+	ASSERT_TRUE(errors.hasError({mesh}));
+	EXPECT_EQ(errors.getError({mesh}).level(), ErrorLevel::ERROR);
+	EXPECT_FALSE(meshCache.getMeshError(meshFile.path.string()).empty());
+
+	// Further requests report the error of the background load without starting another load
+	EXPECT_EQ(meshCache.loadMesh(MeshDescriptor{meshFile.path.string(), 0, true}), nullptr);
+	auto stats = meshCache.statistics();
+	EXPECT_EQ(stats.pendingLoadCount, 0);
+	EXPECT_EQ(stats.loadedEntryCount, 0);
+	EXPECT_FALSE(meshCache.getMeshError(meshFile.path.string()).empty());
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include "components/TraceFileReader.h"
+#include "testing/RacoBaseTest.h"
+
+#include <QJsonArray>
+#include <QJsonObject>
+
+using raco::components::TraceFileReader;
+
+class TraceFileReaderTest : public RacoBaseTest<> {
+protected:
+	TraceFileReader reader_;
+	QJsonParseError error_{};
+};
+
+TEST_F(TraceFileReaderTest, open_indexes_frames) {
+	auto file = makeFile("trace.rctrace", R"([
+	{
+		"SceneData" : { "lua" : { "text" : "a ] } , [ \" {" } },
+		"TracePlayerData" : { "timestamp(ms)" : 1 }
+	},
+	{
+		"SceneData" : { "lua" : { "array" : [1, 2, [3]] } },
+		"TracePlayerData" : { "timestamp(ms)" : 2 }
+	}
+]
+)");
+
+	ASSERT_TRUE(reader_.open(file, error_));
+	ASSERT_EQ(reader_.frameCount(), 2);
+	EXPECT_EQ(reader_.frameLine(0), 2);
+	EXPECT_EQ(reader_.frameLine(1), 6);
+
+	auto first = reader_.readFrame(0, error_).toObject();
+	EXPECT_EQ(error_.error, QJsonParseError::NoError);
+	EXPECT_EQ(first["SceneData"].toObject()["lua"].toObject()["text"].toString(), "a ] } , [ \" {");
+	EXPECT_EQ(first["TracePlayerData"].toObject()["timestamp(ms)"].toInt(), 1);
+
+	auto second = reader_.readFrame(1, error_).toObject();
+	EXPECT_EQ(second["SceneData"].toObject()["lua"].toObject()["array"].toArray().size(), 3);
+	EXPECT_EQ(second["TracePlayerData"].toObject()["timestamp(ms)"].toInt(), 2);
+}
+
+TEST_F(TraceFileReaderTest, open_accepts_empty_array) {
+	auto file = makeFile("trace.rctrace", "[ ]");
+
+	ASSERT_TRUE(reader_.open(file, error_));
+	EXPECT_EQ(reader_.frameCount(), 0);
+}
+
+TEST_F(TraceFileReaderTest, open_fails_for_wrong_root_type) {
+	auto file = makeFile("trace.rctrace", R"({ "SceneData" : {} })");
+
+	EXPECT_FALSE(reader_.open(file, error_));
+	EXPECT_FALSE(reader_.rootIsArray());
+	EXPECT_FALSE(reader_.isOpen());
+}
+
+TEST_F(TraceFileReaderTest, open_fails_for_unterminated_array) {
+	auto file = makeFile("trace.rctrace", R"([ { "SceneData" : {} }, )");
+
+	EXPECT_FALSE(reader_.open(file, error_));
+	EXPECT_TRUE(reader_.rootIsArray());
+	EXPECT_EQ(error_.error, QJsonParseError::UnterminatedArray);
+	EXPECT_EQ(reader_.frameCount(), 0);
+}
+
+TEST_F(TraceFileReaderTest, open_fails_for_garbage_at_end) {
+	auto file = makeFile("trace.rctrace", R"([ { "SceneData" : {} } ] x)");
+
+	EXPECT_FALSE(reader_.open(file, error_));
+	EXPECT_EQ(error_.error, QJsonParseError::GarbageAtEnd);
+	EXPECT_EQ(error_.offset, 25);
+}
+
+TEST_F(TraceFileReaderTest, readFrame_reports_invalid_frame_with_file_offset) {
+	auto file = makeFile("trace.rctrace", R"([ { "SceneData" : {} }, { "SceneData" : x } ])");
+
+	ASSERT_TRUE(reader_.open(file, error_));
+	ASSERT_EQ(reader_.frameCount(), 2);
+
+	EXPECT_TRUE(reader_.readFrame(1, error_).isUndefined());
+	EXPECT_NE(error_.error, QJsonParseError::NoError);
+	EXPECT_GE(error_.offset, 24);
+}
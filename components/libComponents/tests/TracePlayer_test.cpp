@@ -68,6 +68,7 @@ protected:
 	core::SEditorObject createLua(std::string const& luaName, const LuaType type, bool sceneScript = true, core::SEditorObject parent = nullptr);
 	std::unordered_map<std::string, data_storage::Table> const* const backupSceneLuaObjs(QJsonArray const* const);
 	void deleteLuaObj(core::SEditorObject lua);
+	core::SEditorObject createSceneControlsLua();
 	void playOneFrame();
 	void increaseTimeAndDoOneLoop();
 	void setMinMaxFrameTime(long minFrameTime, long maxFrameTime);
@@ -142,6 +143,16 @@ void TracePlayerTest::deleteLuaObj(core::SEditorObject lua) {
 	EXPECT_EQ(lastRemoved, luaObjs_.end());
 }
 
+/// replaces the saInfo Lua node by the SceneControls Lua node using the anim_utils module
+core::SEditorObject TracePlayerTest::createSceneControlsLua() {
+	deleteLuaObj(findLua("saInfo"));
+	const auto luaSceneControls{createLua("SceneControls", LuaType::LuaScript)};
+	const auto luaModule{cmd_->createObject(user_types::LuaScriptModule::typeDescription.typeName, "m")};
+	cmd_->set({luaModule, &user_types::LuaScriptModule::uri_}, test_path().append("lua_scripts/modules/anim_utils.lua").string());
+	cmd_->set({luaSceneControls, {"luaModules", "anim_utils"}}, luaModule);
+	return luaSceneControls;
+}
+
 QJsonArray const* const TracePlayerTest::loadTrace(std::string const& fileName) {
 	return player_->loadTrace((test_path() / fileName).string());
 }
@@ -1217,4 +1228,73 @@ TEST_F(TracePlayerTest, TF107_ReloadResets) {
 		EXPECT_EQ(0.0, C3.asVec3f().y.asDouble());
 		EXPECT_EQ(0.0, C3.asVec3f().z.asDouble());
 	}
-}
\ No newline at end of file
+}
+
+TEST_F(TracePlayerTest, TF108_Streaming_MatchesInMemory) {
+	const auto luaSceneControls{createSceneControlsLua()};
+
+	const auto recordFrames{[this, &luaSceneControls]() {
+		std::vector<data_storage::Table> frames;
+		for (auto frameIndex : {8, 3, 15, 0, player_->getTraceLen() - 1, 14}) {
+			player_->jumpTo(frameIndex);
+			increaseTimeAndDoOneLoop();
+			EXPECT_EQ(frameIndex, player_->getIndex());
+			frames.emplace_back(luaSceneControls->get("inputs")->asTable());
+		}
+		player_->stop();
+		return frames;
+	}};
+
+	EXPECT_NE(nullptr, loadTrace("raco_traces/g05_demo.rctrace"));
+	EXPECT_FALSE(player_->isStreaming());
+	const auto inMemoryFrames{recordFrames()};
+
+	player_->setStreamingThreshold(0);
+	player_->setStreamingKeyframeInterval(4);
+	EXPECT_NE(nullptr, loadTrace("raco_traces/g05_demo.rctrace"));
+	EXPECT_TRUE(player_->isStreaming());
+	isStopped();
+	const auto streamedFrames{recordFrames()};
+
+	EXPECT_EQ(inMemoryFrames, streamedFrames);
+	EXPECT_LE(player_->getMaterializedFrameCount(), 2 * player_->getStreamingKeyframeInterval());
+}
+
+TEST_F(TracePlayerTest, TF109_Streaming_Playing) {
+	const auto luaSceneControls{createSceneControlsLua()};
+
+	player_->setStreamingThreshold(0);
+	player_->setStreamingKeyframeInterval(4);
+	const auto qjTrace{loadTrace("raco_traces/g05_demo.rctrace")};
+	ASSERT_NE(nullptr, qjTrace);
+	EXPECT_TRUE(qjTrace->isEmpty());
+	EXPECT_GT(player_->getTraceLen(), 15);
+	EXPECT_TRUE(player_->isStreaming());
+	isStopped();
+
+	player_->play();
+	/// resume playback till Tailgate_isOpen is true, which occurs at frame index 15
+	while (!luaSceneControls->get("inputs")->asTable().get("Tailgate_isOpen")->asBool()) {
+		isPlaying();
+		increaseTimeAndDoOneLoop();
+	}
+	EXPECT_EQ(15, player_->getIndex());
+
+	/// run playback to end
+	while (player_->getState() == TracePlayer::PlayerState::Playing) {
+		increaseTimeAndDoOneLoop();
+	}
+	ASSERT_EQ(player_->getIndex(), player_->getTraceLen() - 1);
+	isPaused();
+	EXPECT_LE(player_->getMaterializedFrameCount(), 2 * player_->getStreamingKeyframeInterval());
+}
+
+TEST_F(TracePlayerTest, TF110_Streaming_InvalidTrace) {
+	player_->setStreamingThreshold(0);
+
+	EXPECT_EQ(nullptr, loadTrace("raco_traces/invalid_wrongRootType.rctrace"));
+	isFaulty();
+
+	EXPECT_EQ(nullptr, loadTrace("raco_traces/invalid_wrongFormat.rctrace"));
+	isFaulty();
+}
@@ -23,6 +23,7 @@ public:
 	core::SharedMeshData loadMesh(const core::MeshDescriptor& descriptor) override;
 	std::string getError() override;
 	void reset() override;
+	size_t memoryUsage() override;
 	const core::MeshScenegraph* getScenegraph(const std::string& absPath) override;
 	int getTotalMeshCount() override;
 	core::SharedAnimationSamplerData getAnimationSamplerData(const std::string& absPath, int animIndex, int samplerIndex) override;
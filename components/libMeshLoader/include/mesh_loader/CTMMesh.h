@@ -11,6 +11,7 @@
 
 #include "core/MeshCacheInterface.h"
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -57,7 +58,9 @@ private:
 	std::vector<Attribute> attributes_;
 	std::vector<IndexBufferRangeInfo> submeshIndexBufferRanges_;
 
-	std::vector<glm::vec3> triangleBuffer_;
+	// Built on first use since it is only needed for picking.
+	mutable std::once_flag triangleBufferFlag_;
+	mutable std::vector<glm::vec3> triangleBuffer_;
 };
 
 }  // namespace raco::mesh_loader
\ No newline at end of file
@@ -10,17 +10,29 @@
 #pragma once
 
 #include <log_system/log.h>
+#include <cstdint>
+#include <memory>
 #include <set>
 #include <tiny_gltf.h>
+#include <vector>
 
 namespace raco::mesh_loader {
 
+/**
+ * @brief Data of a glTF buffer.
+ *
+ * The glTFFileLoader moves the buffer data out of the tinygltf model after loading, so that meshes
+ * referencing buffer data only keep the buffers they use alive instead of the complete model.
+ */
+using SharedglTFBuffer = std::shared_ptr<const std::vector<unsigned char>>;
+
 struct glTFBufferData {
-	glTFBufferData(const tinygltf::Model &scene, int accessorIndex, const std::set<int> &allowedComponentTypes, const std::set<int> &allowedTypes)
+	glTFBufferData(const tinygltf::Model &scene, const std::vector<SharedglTFBuffer> &buffers, int accessorIndex, const std::set<int> &allowedComponentTypes, const std::set<int> &allowedTypes)
 		: scene_(scene),
 		  accessor_(scene_.accessors[accessorIndex]),
 		  view_(scene_.bufferViews[accessor_.bufferView]),
-		  bufferBytes(scene_.buffers[view_.buffer].data) {
+		  buffer_(buffers[view_.buffer]),
+		  bufferBytes(*buffer_) {
 		if (!allowedComponentTypes.empty() && allowedComponentTypes.find(accessor_.componentType) == allowedComponentTypes.end()) {
 			LOG_ERROR(raco::log_system::MESH_LOADER, "glTF buffer accessor '{}' has invalid component type '{}'", accessor_.name, accessor_.componentType);
 		}
@@ -45,6 +57,30 @@ struct glTFBufferData {
 		return accessor_.type;
 	}
 
+	/**
+	 * @brief Pointer to the accessor data if it consists of tightly packed and aligned float elements.
+	 *
+	 * @return nullptr if the data needs to be converted before it can be used as float vertex data.
+	 */
+	const float *packedFloatData() const {
+		if (accessor_.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT || accessor_.sparse.isSparse) {
+			return nullptr;
+		}
+		auto elementSize = numComponents() * sizeof(float);
+		if (accessor_.ByteStride(view_) != static_cast<int>(elementSize)) {
+			return nullptr;
+		}
+		auto offset = accessor_.byteOffset + view_.byteOffset;
+		if (offset + accessor_.count * elementSize > bufferBytes.size()) {
+			return nullptr;
+		}
+		auto data = bufferBytes.data() + offset;
+		if (reinterpret_cast<std::uintptr_t>(data) % alignof(float) != 0) {
+			return nullptr;
+		}
+		return reinterpret_cast<const float *>(data);
+	}
+
 	template <typename T, typename U = T>
 	T getDataArray(size_t index, bool useComponentSize = true) const {
 		auto componentSize = (useComponentSize) ? accessor_.ByteStride(view_) / sizeof(typename T::value_type) : 1;
@@ -156,6 +192,7 @@ struct glTFBufferData {
 	const tinygltf::Model &scene_;
 	const tinygltf::Accessor &accessor_;
 	const tinygltf::BufferView &view_;
+	const SharedglTFBuffer &buffer_;
 	const std::vector<unsigned char> &bufferBytes;
 };
 
@@ -11,6 +11,9 @@
 
 #include "core/MeshCacheInterface.h"
 
+#include <memory>
+#include <vector>
+
 namespace tinygltf {
 class TinyGLTF;
 class Model;
@@ -30,6 +33,7 @@ public:
 	core::SharedAnimationSamplerData getAnimationSamplerData(const std::string& absPath, int animIndex, int samplerIndex) override;
 	std::string getError() override;
 	void reset() override;
+	size_t memoryUsage() override;
 	
 	core::SharedSkinData loadSkin(const std::string& absPath, int skinIndex, std::string& outError) override;
 
@@ -37,6 +41,8 @@ private:
 	std::string path_;
 
 	std::unique_ptr<tinygltf::Model> scene_;
+	// Data of the model buffers, moved out of the model after loading. Shared with meshes referencing the data.
+	std::vector<std::shared_ptr<const std::vector<unsigned char>>> buffers_;
 	std::unique_ptr<tinygltf::TinyGLTF> importer_;
 	std::unique_ptr<core::MeshScenegraph> sceneGraph_;
 	std::string error_;
@@ -10,8 +10,11 @@
 #pragma once
 
 #include "core/MeshCacheInterface.h"
+#include "mesh_loader/glTFBufferData.h"
 
 #include <glm/mat4x4.hpp>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -26,7 +29,13 @@ namespace raco::mesh_loader {
 
 class glTFMesh : public core::MeshData {
 public:
-	glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sceneGraph, const core::MeshDescriptor &descriptor);
+	/**
+	 * @brief Extract the mesh data from a glTF model.
+	 *
+	 * Attribute data which can be used as is will not be copied but reference the glTF buffers instead.
+	 * The mesh keeps the referenced buffers alive in that case.
+	 */
+	glTFMesh(const tinygltf::Model &scene, const std::vector<SharedglTFBuffer> &buffers, const core::MeshScenegraph &sceneGraph, const core::MeshDescriptor &descriptor);
 
 	uint32_t numSubmeshes() const override;
 	uint32_t numTriangles() const override;
@@ -49,24 +58,53 @@ public:
 
 	const std::vector<glm::vec3>& triangleBuffer() const override;
 
+	/**
+	 * @brief Float data of a vertex attribute.
+	 *
+	 * The data is either owned by the buffer or references tightly packed float data inside a glTF buffer.
+	 */
+	struct AttributeBuffer {
+		std::vector<float> data;
+		// Keeps the referenced glTF buffer alive.
+		SharedglTFBuffer sceneBuffer;
+		const float* sceneData = nullptr;
+		size_t sceneDataSize = 0;
+
+		const float* buffer() const {
+			return sceneData ? sceneData : data.data();
+		}
+
+		size_t size() const {
+			return sceneData ? sceneDataSize : data.size();
+		}
+
+		bool empty() const {
+			return size() == 0;
+		}
+
+		// Owned data to append converted data to. Referenced scene data is copied first.
+		std::vector<float>& convertedData();
+	};
+
 private:
 	struct Attribute {
 		std::string name;
 		VertexAttribDataType type;
-		std::vector<float> data;
+		AttributeBuffer data;
 	};
 
-	void loadPrimitiveData(const tinygltf::Primitive& primitive, const tinygltf::Model& scene,
-		std::vector<float>& vertexBuffer,
-		std::vector<std::vector<float>>& morphVertexBuffers,
-		std::vector<float>& normalBuffer,
-		std::vector<std::vector<float>>& morphNormalBuffers,
+	void loadPrimitiveData(const tinygltf::Primitive& primitive, const tinygltf::Model& scene, const std::vector<SharedglTFBuffer>& buffers,
+		AttributeBuffer& vertexBuffer,
+		std::vector<AttributeBuffer>& morphVertexBuffers,
+		AttributeBuffer& normalBuffer,
+		std::vector<AttributeBuffer>& morphNormalBuffers,
 		std::vector<float>& tangentBuffer,
 		std::vector<float>& bitangentBuffer,
-		std::vector<std::vector<float>>& uvBuffers,
-		std::vector<std::vector<float>>& colorBuffers,
-		std::vector<std::vector<float>>& weightBuffers,
-		std::vector<std::vector<float>>& jointBuffers,
+		std::vector<AttributeBuffer>& uvBuffers,
+		std::vector<AttributeBuffer>& colorBuffers,
+		std::vector<AttributeBuffer>& weightBuffers,
+		std::vector<AttributeBuffer>& jointBuffers,
+		bool referenceSceneData,
 		glm::dmat4* globalModelMatrix = nullptr,
 		glm::dmat4* globalNormalMatrix = nullptr);
 
@@ -81,7 +119,9 @@ private:
 
 	std::map<std::string, std::string> metadata_;
 
-	std::vector<glm::vec3> triangleBuffer_;
+	// Built on first use since it is only needed for picking.
+	mutable std::once_flag triangleBufferFlag_;
+	mutable std::vector<glm::vec3> triangleBuffer_;
 };
 
 }  // namespace raco::mesh_loader
\ No newline at end of file
@@ -59,6 +59,20 @@ void CTMFileLoader::reset() {
 	valid_ = false;
 }
 
+size_t CTMFileLoader::memoryUsage() {
+	if (!importer_ || !valid_) {
+		return 0;
+	}
+	size_t numVertices = importer_->GetInteger(CTM_VERTEX_COUNT);
+	size_t numFloats = 3 * numVertices;
+	if (importer_->GetInteger(CTM_HAS_NORMALS) == CTM_TRUE) {
+		numFloats += 3 * numVertices;
+	}
+	numFloats += 2 * numVertices * importer_->GetInteger(CTM_UV_MAP_COUNT);
+	numFloats += 4 * numVertices * importer_->GetInteger(CTM_ATTRIB_MAP_COUNT);
+	return sizeof(CTMimporter) + numFloats * sizeof(float) + 3 * importer_->GetInteger(CTM_TRIANGLE_COUNT) * sizeof(uint32_t);
+}
+
 const core::MeshScenegraph* CTMFileLoader::getScenegraph(const std::string& absPath) {
 	// Scenegraph import for CTM is unsupported as CTM does not contain any scenegraph.
 	return nullptr;
@@ -55,10 +55,6 @@ CTMMesh::CTMMesh(CTMimporter& importer) {
 	}
 
 	submeshIndexBufferRanges_ = {{0, 3 * numTriangles_}};
-
-	// Build non-indexed triangle buffer to be used for picking in ramses
-	auto vertexData = reinterpret_cast<const glm::vec3*>(attribBuffer(attribIndex(MeshData::ATTRIBUTE_POSITION)));
-	triangleBuffer_ = core::MeshData::buildTriangleBuffer(vertexData, indexBuffer_);
 }
 
 uint32_t CTMMesh::numSubmeshes() const {
@@ -124,6 +120,11 @@ const char* CTMMesh::attribBuffer(int attribIndex) const {
 }
 
 const std::vector<glm::vec3>& CTMMesh::triangleBuffer() const {
+	std::call_once(triangleBufferFlag_, [this]() {
+		// Build non-indexed triangle buffer to be used for picking in ramses
+		auto vertexData = reinterpret_cast<const glm::vec3*>(attribBuffer(attribIndex(MeshData::ATTRIBUTE_POSITION)));
+		triangleBuffer_ = core::MeshData::buildTriangleBuffer(vertexData, indexBuffer_);
+	});
 	return triangleBuffer_;
 }
 
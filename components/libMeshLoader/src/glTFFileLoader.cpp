@@ -156,7 +156,7 @@ namespace raco::mesh_loader {
 
 glTFFileLoader::glTFFileLoader(std::string absPath)
 	: path_(absPath),
-	  scene_(new tinygltf::Model),
+	  scene_(std::make_unique<tinygltf::Model>()),
 	  importer_(nullptr) {
 }
 
@@ -168,7 +168,26 @@ void glTFFileLoader::reset() {
 	error_.clear();
 	sceneGraph_.reset();
 	importer_.reset();
-	scene_.reset(new tinygltf::Model);
+	scene_ = std::make_unique<tinygltf::Model>();
+	// Meshes referencing buffer data keep the buffers alive.
+	buffers_.clear();
+}
+
+size_t glTFFileLoader::memoryUsage() {
+	if (!importer_) {
+		return 0;
+	}
+	size_t usage = sizeof(tinygltf::Model);
+	// Buffers referenced by meshes are not released by reset().
+	for (const auto& buffer : buffers_) {
+		if (buffer.use_count() == 1) {
+			usage += buffer->size();
+		}
+	}
+	for (const auto& image : scene_->images) {
+		usage += image.image.size();
+	}
+	return usage;
 }
 
 bool glTFFileLoader::buildglTFScenegraph() {
@@ -277,6 +296,11 @@ bool glTFFileLoader::importglTFScene(const std::string& absPath) {
 			return false;
 		}
 
+		buffers_.clear();
+		for (auto& buffer : scene_->buffers) {
+			buffers_.emplace_back(std::make_shared<const std::vector<unsigned char>>(std::move(buffer.data)));
+		}
+
 		if (!buildglTFScenegraph()) {
 			LOG_ERROR(log_system::MESH_LOADER, "Encountered an error while loading glTF mesh {}\n\tError: {}", absPath, error_);
 			importer_.reset();
@@ -340,6 +364,10 @@ const core::MeshScenegraph* glTFFileLoader::getScenegraph(const std::string& abs
 }
 
 int glTFFileLoader::getTotalMeshCount() {
+	// The file may have been discarded by the mesh cache to save memory.
+	if (!importglTFScene(path_)) {
+		return 0;
+	}
 	auto primitiveCount = 0;
 	for (const auto& mesh : scene_->meshes) {
 		primitiveCount += mesh.primitives.size();
@@ -385,13 +413,13 @@ core::SharedAnimationSamplerData glTFFileLoader::getAnimationSamplerData(const s
 		LOG_ERROR(log_system::MESH_LOADER, "animation sampler at index {}.{} has no valid interpolation type. Using linear interpolation as a fallback.", animIndex, samplerIndex);
 	}
 
-	auto inputData = glTFBufferData(*scene_, sampler.input, {TINYGLTF_COMPONENT_TYPE_FLOAT}, {TINYGLTF_TYPE_SCALAR});
+	auto inputData = glTFBufferData(*scene_, buffers_, sampler.input, {TINYGLTF_COMPONENT_TYPE_FLOAT}, {TINYGLTF_TYPE_SCALAR});
 	std::vector<float> input;
 	for (auto count = 0; count < inputData.accessor_.count; ++count) {
 		input.emplace_back(inputData.getDataAt<float>(count).front());
 	}
 
-	auto outputData = glTFBufferData(*scene_, sampler.output, {TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_COMPONENT_TYPE_BYTE, TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_COMPONENT_TYPE_SHORT, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT}, {TINYGLTF_TYPE_SCALAR, TINYGLTF_TYPE_VEC3, TINYGLTF_TYPE_VEC4});
+	auto outputData = glTFBufferData(*scene_, buffers_, sampler.output, {TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_COMPONENT_TYPE_BYTE, TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_COMPONENT_TYPE_SHORT, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT}, {TINYGLTF_TYPE_SCALAR, TINYGLTF_TYPE_VEC3, TINYGLTF_TYPE_VEC4});
 	std::vector<std::vector<float>> output;
 	for (auto count = 0; count < outputData.accessor_.count; ++count) {
 		output.emplace_back(outputData.getNormalizedData(count));
@@ -457,7 +485,7 @@ core::SharedMeshData glTFFileLoader::loadMesh(const core::MeshDescriptor& descri
 		return core::SharedMeshData();
 	}
 
-	return std::make_shared<glTFMesh>(*scene_, *sceneGraph_, descriptor);
+	return std::make_shared<glTFMesh>(*scene_, buffers_, *sceneGraph_, descriptor);
 }
 
 core::SharedSkinData glTFFileLoader::loadSkin(const std::string& absPath, int skinIndex, std::string& outError) {
@@ -477,7 +505,7 @@ core::SharedSkinData glTFFileLoader::loadSkin(const std::string& absPath, int sk
 	}
 
 	auto& skin = scene_->skins[skinIndex];
-	auto matrixData = glTFBufferData(*scene_, skin.inverseBindMatrices, {TINYGLTF_COMPONENT_TYPE_FLOAT}, {TINYGLTF_TYPE_MAT4});
+	auto matrixData = glTFBufferData(*scene_, buffers_, skin.inverseBindMatrices, {TINYGLTF_COMPONENT_TYPE_FLOAT}, {TINYGLTF_TYPE_MAT4});
 
 	std::vector<glm::mat4x4> matrixBuffer;
 
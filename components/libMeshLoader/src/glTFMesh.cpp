@@ -15,6 +15,7 @@
 #include <glm/gtx/transform.hpp>
 #include <glm/vec3.hpp>
 #include <log_system/log.h>
+#include <algorithm>
 #include <optional>
 #include <stdexcept>
 #include <vector>
@@ -23,35 +24,45 @@ namespace raco::mesh_loader {
 
 using namespace raco::core;
 
-glTFMesh::glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sceneGraph, const core::MeshDescriptor &descriptor) : numTriangles_(0), numVertices_(0) {
+std::vector<float> &glTFMesh::AttributeBuffer::convertedData() {
+	if (sceneData) {
+		data.assign(sceneData, sceneData + sceneDataSize);
+		sceneBuffer.reset();
+		sceneData = nullptr;
+		sceneDataSize = 0;
+	}
+	return data;
+}
+
+glTFMesh::glTFMesh(const tinygltf::Model &scene, const std::vector<SharedglTFBuffer> &buffers, const core::MeshScenegraph &sceneGraph, const core::MeshDescriptor &descriptor) : numTriangles_(0), numVertices_(0) {
 	// Not included: Bones, textures, materials, node structure, etc.
 
 	// set up buffers we are going to fill in the loop
-	std::vector<float> vertexBuffer{};
-	std::vector<float> normalBuffer{};
+	AttributeBuffer vertexBuffer{};
+	AttributeBuffer normalBuffer{};
 	std::vector<float> tangentBuffer{};
 	std::vector<float> bitangentBuffer{};
-	std::vector<std::vector<float>> uvBuffers;
-	std::vector<std::vector<float>> colorBuffers;
-	std::vector<std::vector<float>> weightBuffers;
-	std::vector<std::vector<float>> jointBuffers;
+	std::vector<AttributeBuffer> uvBuffers;
+	std::vector<AttributeBuffer> colorBuffers;
+	std::vector<AttributeBuffer> weightBuffers;
+	std::vector<AttributeBuffer> jointBuffers;
 
-	std::vector<std::vector<float>> morphVertexBuffers;
-	std::vector<std::vector<float>> morphNormalBuffers;
+	std::vector<AttributeBuffer> morphVertexBuffers;
+	std::vector<AttributeBuffer> morphNormalBuffers;
 
-	std::vector<std::pair<tinygltf::Primitive, int>> flattenedPrimitiveList;
+	std::vector<std::pair<const tinygltf::Primitive *, int>> flattenedPrimitiveList;
 
 	for (int meshIndex = 0; meshIndex < scene.meshes.size(); ++meshIndex) {
 		const auto &mesh = scene.meshes[meshIndex];
 		for (const auto &prim : mesh.primitives) {
-			flattenedPrimitiveList.emplace_back(prim, meshIndex);
+			flattenedPrimitiveList.emplace_back(&prim, meshIndex);
 		}
 	}
 
 	// Collect all meshes or selected mesh.
 	if (!descriptor.bakeAllSubmeshes) {
 		for (auto primitiveIndex = descriptor.submeshIndex; primitiveIndex < descriptor.submeshIndex + 1; ++primitiveIndex) {
-			auto primitiveEntry = flattenedPrimitiveList[primitiveIndex];
+			const auto &primitiveEntry = flattenedPrimitiveList[primitiveIndex];
 			const auto &originMesh = scene.meshes[primitiveEntry.second];
 
 			const auto &extras = originMesh.extras;
@@ -67,7 +78,8 @@ glTFMesh::glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sce
 			// TODO enable this again once we have meshnode submesh support:
 			// materials_.emplace_back(scene.materials[primitive.material].name);
 
-			loadPrimitiveData(primitiveEntry.first, scene, vertexBuffer, morphVertexBuffers, normalBuffer, morphNormalBuffers, tangentBuffer, bitangentBuffer, uvBuffers, colorBuffers, weightBuffers, jointBuffers);
+			// A single untransformed primitive can use the glTF buffer data directly where the layout matches.
+			loadPrimitiveData(*primitiveEntry.first, scene, buffers, vertexBuffer, morphVertexBuffers, normalBuffer, morphNormalBuffers, tangentBuffer, bitangentBuffer, uvBuffers, colorBuffers, weightBuffers, jointBuffers, true);
 		}
 	} else {
 		// calculate local node transformations to later transfer them to the node's vertex positions
@@ -110,8 +122,8 @@ glTFMesh::glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sce
 			auto globalNormalMatrix = glm::dmat4x4(glm::transpose(glm::inverse(glm::dmat3x3(globalModelMatrix))));
 
 			for (const auto &primitiveIndex : sceneGraph.nodes[nodeIndex]->subMeshIndices) {
-				auto primitive = flattenedPrimitiveList[*primitiveIndex];
-				loadPrimitiveData(primitive.first, scene, vertexBuffer, morphVertexBuffers, normalBuffer, morphNormalBuffers, tangentBuffer, bitangentBuffer, uvBuffers, colorBuffers, weightBuffers, jointBuffers, &globalModelMatrix, &globalNormalMatrix);
+				const auto &primitive = flattenedPrimitiveList[*primitiveIndex];
+				loadPrimitiveData(*primitive.first, scene, buffers, vertexBuffer, morphVertexBuffers, normalBuffer, morphNormalBuffers, tangentBuffer, bitangentBuffer, uvBuffers, colorBuffers, weightBuffers, jointBuffers, false, &globalModelMatrix, &globalNormalMatrix);
 			}
 		}
 	}
@@ -121,21 +133,17 @@ glTFMesh::glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sce
 	materials_ = {"material"};
 
 	// Add the vertices
-	const auto& posAttribute = attributes_.emplace_back(Attribute{
+	attributes_.emplace_back(Attribute{
 		ATTRIBUTE_POSITION,
 		VertexAttribDataType::VAT_Float3,
-		vertexBuffer});
-
-	// Build non-indexed triangle buffer to be used for picking in ramses
-	auto vertexData = reinterpret_cast<const glm::vec3 *>(posAttribute.data.data());
-	triangleBuffer_ = core::MeshData::buildTriangleBuffer(vertexData, indexBuffer_);
+		std::move(vertexBuffer)});
 
 	for (size_t index = 0; index < morphVertexBuffers.size(); index++) {
 		if (!morphVertexBuffers[index].empty()) {
 			attributes_.emplace_back(Attribute{
 				fmt::format("{}_Morph_{}", ATTRIBUTE_POSITION, index),
 				VertexAttribDataType::VAT_Float3,
-				morphVertexBuffers[index]});
+				std::move(morphVertexBuffers[index])});
 		}
 	}
 
@@ -144,7 +152,7 @@ glTFMesh::glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sce
 		attributes_.emplace_back(Attribute{
 			ATTRIBUTE_NORMAL,
 			VertexAttribDataType::VAT_Float3,
-			normalBuffer});
+			std::move(normalBuffer)});
 	}
 
 	for (size_t index = 0; index < morphNormalBuffers.size(); index++) {
@@ -152,13 +160,13 @@ glTFMesh::glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sce
 			attributes_.emplace_back(Attribute{
 				fmt::format("{}_Morph_{}", ATTRIBUTE_NORMAL, index),
 				VertexAttribDataType::VAT_Float3,
-				morphNormalBuffers[index]});
+				std::move(morphNormalBuffers[index])});
 		}
 	}
 
-	if (!tangentBuffer.empty() && tangentBuffer.size() == bitangentBuffer.size() && tangentBuffer.size() == vertexBuffer.size()) {
-		attributes_.emplace_back(Attribute{ATTRIBUTE_TANGENT, VertexAttribDataType::VAT_Float3, tangentBuffer});
-		attributes_.emplace_back(Attribute{ATTRIBUTE_BITANGENT, VertexAttribDataType::VAT_Float3, bitangentBuffer});
+	if (!tangentBuffer.empty() && tangentBuffer.size() == bitangentBuffer.size() && tangentBuffer.size() == 3 * numVertices_) {
+		attributes_.emplace_back(Attribute{ATTRIBUTE_TANGENT, VertexAttribDataType::VAT_Float3, {std::move(tangentBuffer)}});
+		attributes_.emplace_back(Attribute{ATTRIBUTE_BITANGENT, VertexAttribDataType::VAT_Float3, {std::move(bitangentBuffer)}});
 	}
 
 	// Add the UV maps
@@ -166,11 +174,11 @@ glTFMesh::glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sce
 		const std::string indexCharacter = (bufferIndex == 0) ? "" : std::to_string(bufferIndex);
 
 		// Check that uv buffer uses the same number of vertices as the vertex buffers;
-		if (vertexBuffer.size() / 3 == uvBuffers[bufferIndex].size() / 2) {
+		if (numVertices_ == uvBuffers[bufferIndex].size() / 2) {
 			attributes_.emplace_back(Attribute{
 				std::string{ATTRIBUTE_UVMAP} + indexCharacter,
 				VertexAttribDataType::VAT_Float2,
-				uvBuffers[bufferIndex]});
+				std::move(uvBuffers[bufferIndex])});
 		}
 	}
 
@@ -179,23 +187,23 @@ glTFMesh::glTFMesh(const tinygltf::Model &scene, const core::MeshScenegraph &sce
 
 		// Check that color buffer uses the same number of vertices as the vertex buffers;
 		// TODO This implicitly only support VEC4 color buffers even if loadPrimitiveData allows for VEC3. Why?
-		if (vertexBuffer.size() / 3 == colorBuffers[colorChannelIndex].size() / 4) {
+		if (numVertices_ == colorBuffers[colorChannelIndex].size() / 4) {
 			attributes_.emplace_back(Attribute{
 				std::string(ATTRIBUTE_COLOR) + indexCharacter,
 				VertexAttribDataType::VAT_Float4,
-				colorBuffers[colorChannelIndex]});
+				std::move(colorBuffers[colorChannelIndex])});
 		}
 	}
 
 	for (size_t index = 0; index < weightBuffers.size(); ++index) {
-		if (vertexBuffer.size() / 3 == weightBuffers[index].size() / 4) {
-			attributes_.emplace_back(Attribute{std::string(ATTRIBUTE_WEIGHTS) + std::to_string(index), VertexAttribDataType::VAT_Float4, weightBuffers[index]});
+		if (numVertices_ == weightBuffers[index].size() / 4) {
+			attributes_.emplace_back(Attribute{std::string(ATTRIBUTE_WEIGHTS) + std::to_string(index), VertexAttribDataType::VAT_Float4, std::move(weightBuffers[index])});
 		}
 	}
 
 	for (size_t index = 0; index < jointBuffers.size(); ++index) {
-		if (vertexBuffer.size() / 3 == jointBuffers[index].size() / 4) {
-			attributes_.emplace_back(Attribute{std::string(ATTRIBUTE_JOINTS) + std::to_string(index), VertexAttribDataType::VAT_Float4, jointBuffers[index]});
+		if (numVertices_ == jointBuffers[index].size() / 4) {
+			attributes_.emplace_back(Attribute{std::string(ATTRIBUTE_JOINTS) + std::to_string(index), VertexAttribDataType::VAT_Float4, std::move(jointBuffers[index])});
 		}
 	}
 }
@@ -260,14 +268,33 @@ MeshData::VertexAttribDataType glTFMesh::attribDataType(int attribute_index) con
 }
 
 const char *glTFMesh::attribBuffer(int attribute_index) const {
-	return reinterpret_cast<const char *>(attributes_.at(attribute_index).data.data());
+	return reinterpret_cast<const char *>(attributes_.at(attribute_index).data.buffer());
 }
 
 const std::vector<glm::vec3>& glTFMesh::triangleBuffer() const {
+	std::call_once(triangleBufferFlag_, [this]() {
+		// Build non-indexed triangle buffer to be used for picking in ramses
+		auto vertexData = reinterpret_cast<const glm::vec3 *>(attributes_.front().data.buffer());
+		triangleBuffer_ = core::MeshData::buildTriangleBuffer(vertexData, indexBuffer_);
+	});
 	return triangleBuffer_;
 }
 
-void convertVectorWithTransformation(std::vector<float> vector, std::vector<float> &buffer, glm::dmat4 *trafoMatrix, double component_4) {
+// Let the attribute buffer reference the accessor data if allowed and possible.
+// @return false if the data still needs to be converted into the buffer.
+bool referenceAttributeData(const glTFBufferData &data, glTFMesh::AttributeBuffer &buffer, int type, bool referenceSceneData) {
+	if (referenceSceneData && buffer.empty() && data.type() == type) {
+		if (auto sceneData = data.packedFloatData()) {
+			buffer.sceneBuffer = data.buffer_;
+			buffer.sceneData = sceneData;
+			buffer.sceneDataSize = data.accessor_.count * data.numComponents();
+			return true;
+		}
+	}
+	return false;
+}
+
+void convertVectorWithTransformation(const std::vector<float> &vector, std::vector<float> &buffer, glm::dmat4 *trafoMatrix, double component_4) {
 	if (trafoMatrix) {
 		auto transformed = *trafoMatrix * glm::dvec4(vector[0], vector[1], vector[2], component_4);
 		buffer.insert(buffer.end(), {static_cast<float>(transformed.x), static_cast<float>(transformed.y), static_cast<float>(transformed.z)});
@@ -276,21 +303,30 @@ void convertVectorWithTransformation(std::vector<float> vector, std::vector<floa
 	}
 }
 
-void convertPositionData(const glTFBufferData &data, std::vector<float> &buffer, glm::dmat4 *rootTrafoMatrix = nullptr) {
+void convertPositionData(const glTFBufferData &data, glTFMesh::AttributeBuffer &attributeBuffer, bool referenceSceneData, glm::dmat4 *rootTrafoMatrix = nullptr) {
+	if (!rootTrafoMatrix && referenceAttributeData(data, attributeBuffer, TINYGLTF_TYPE_VEC3, referenceSceneData)) {
+		return;
+	}
+	auto &buffer = attributeBuffer.convertedData();
 	for (size_t vertexIndex = 0; vertexIndex < data.accessor_.count; vertexIndex++) {
 		convertVectorWithTransformation(data.getDataAt<float>(vertexIndex), buffer, rootTrafoMatrix, 1.0);
 	}
 }
 
-void convertAttributeSet(const tinygltf::Primitive &primitive, const tinygltf::Model &scene, std::vector<std::vector<float>> &buffers, const std::string &attributeBaseName, const std::set<int> &allowedComponentTypes, const std::set<int> &allowedTypes, bool normalize, int numVertices, bool padVec3Types = false) {
+void convertAttributeSet(const tinygltf::Primitive &primitive, const tinygltf::Model &scene, const std::vector<SharedglTFBuffer> &sceneBuffers, std::vector<glTFMesh::AttributeBuffer> &buffers, const std::string &attributeBaseName, const std::set<int> &allowedComponentTypes, const std::set<int> &allowedTypes, bool normalize, int numVertices, bool referenceSceneData, bool padVec3Types = false) {
 	for (auto channel = 0; channel < std::numeric_limits<int>::max(); ++channel) {
 		auto attribName = fmt::format("{}_{}", attributeBaseName, channel);
 		if (primitive.attributes.find(attribName) != primitive.attributes.end()) {
-			glTFBufferData bufferData(scene, primitive.attributes.at(attribName), allowedComponentTypes, allowedTypes);
+			glTFBufferData bufferData(scene, sceneBuffers, primitive.attributes.at(attribName), allowedComponentTypes, allowedTypes);
 
 			if (bufferData.accessor_.count == numVertices) {
 				buffers.resize(channel + 1);
-				std::vector<float> &buffer{buffers[channel]};
+				// Padded VEC3 data can't be referenced since it needs to be converted to VEC4.
+				if (allowedTypes.find(bufferData.type()) != allowedTypes.end() && !(padVec3Types && bufferData.type() == TINYGLTF_TYPE_VEC3) &&
+					referenceAttributeData(bufferData, buffers[channel], bufferData.type(), referenceSceneData)) {
+					continue;
+				}
+				std::vector<float> &buffer{buffers[channel].convertedData()};
 				for (size_t vertexIndex = 0; vertexIndex < bufferData.accessor_.count; vertexIndex++) {
 					auto elementData = normalize ? bufferData.getNormalizedData(vertexIndex) : bufferData.getConvertedData<float>(vertexIndex);
 					buffer.insert(buffer.end(), elementData.begin(), elementData.end());
@@ -308,17 +344,18 @@ void convertAttributeSet(const tinygltf::Primitive &primitive, const tinygltf::M
 	}
 }
 
-void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tinygltf::Model &scene,
-	std::vector<float> &vertexBuffer,
-	std::vector<std::vector<float>> &morphVertexBuffers,
-	std::vector<float> &normalBuffer,
-	std::vector<std::vector<float>> &morphNormalBuffers,
+void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tinygltf::Model &scene, const std::vector<SharedglTFBuffer> &buffers,
+	AttributeBuffer &vertexBuffer,
+	std::vector<AttributeBuffer> &morphVertexBuffers,
+	AttributeBuffer &normalBuffer,
+	std::vector<AttributeBuffer> &morphNormalBuffers,
 	std::vector<float> &tangentBuffer,
 	std::vector<float> &bitangentBuffer,
-	std::vector<std::vector<float>> &uvBuffers,
-	std::vector<std::vector<float>> &colorBuffers,
-	std::vector<std::vector<float>> &weightBuffers,
-	std::vector<std::vector<float>> &jointBuffers,
+	std::vector<AttributeBuffer> &uvBuffers,
+	std::vector<AttributeBuffer> &colorBuffers,
+	std::vector<AttributeBuffer> &weightBuffers,
+	std::vector<AttributeBuffer> &jointBuffers,
+	bool referenceSceneData,
 	glm::dmat4 *globalModelMatrix,
 	glm::dmat4 *globalNormalMatrix) {
 	if (primitive.attributes.find("POSITION") == primitive.attributes.end()) {
@@ -326,17 +363,17 @@ void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tin
 		return;
 	}
 
-	glTFBufferData posData(scene, primitive.attributes.at("POSITION"), std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC3});
-	convertPositionData(posData, vertexBuffer, globalModelMatrix);
+	glTFBufferData posData(scene, buffers, primitive.attributes.at("POSITION"), std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC3});
+	convertPositionData(posData, vertexBuffer, referenceSceneData, globalModelMatrix);
 	auto numVertices = posData.accessor_.count;
 
 	morphVertexBuffers.resize(primitive.targets.size());
 	for (size_t index = 0; index < primitive.targets.size(); index++) {
 		auto it = primitive.targets[index].find("POSITION");
 		if (it != primitive.targets[index].end()) {
-			glTFBufferData data(scene, it->second, std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC3});
+			glTFBufferData data(scene, buffers, it->second, std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC3});
 			if (data.accessor_.count == numVertices) {
-				convertPositionData(data, morphVertexBuffers[index], globalModelMatrix);
+				convertPositionData(data, morphVertexBuffers[index], referenceSceneData, globalModelMatrix);
 			} else {
 				LOG_WARNING(log_system::MESH_LOADER, "Morph position attribute has different size than vertex buffer, ignoring it.");
 			}
@@ -347,10 +384,10 @@ void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tin
 	std::optional<glTFBufferData> tangentData;
 
 	if (primitive.attributes.find("NORMAL") != primitive.attributes.end()) {
-		normalData.emplace(scene, primitive.attributes.at("NORMAL"), std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC3});
+		normalData.emplace(scene, buffers, primitive.attributes.at("NORMAL"), std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC3});
 
 		if (primitive.attributes.find("TANGENT") != primitive.attributes.end()) {
-			tangentData.emplace(scene, primitive.attributes.at("TANGENT"), std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC4});
+			tangentData.emplace(scene, buffers, primitive.attributes.at("TANGENT"), std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC4});
 		}
 	}
 
@@ -366,7 +403,11 @@ void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tin
 
 	if (normalData) {
 		std::vector<float> normalScalingFactors;
-		for (size_t vertexIndex = 0; vertexIndex < normalData->accessor_.count; vertexIndex++) {
+		bool normalsReferenced = !globalNormalMatrix && referenceAttributeData(*normalData, normalBuffer, TINYGLTF_TYPE_VEC3, referenceSceneData);
+		std::vector<float> *normalValues = normalsReferenced ? nullptr : &normalBuffer.convertedData();
+		// Referenced normals only need to be read if the bitangents have to be calculated.
+		auto normalCount = normalsReferenced && !tangentData ? 0 : normalData->accessor_.count;
+		for (size_t vertexIndex = 0; vertexIndex < normalCount; vertexIndex++) {
 			auto normal = normalData->getDataAt<float>(vertexIndex);
 			if (globalNormalMatrix) {
 				// The transformation of the normals changes the length so we have to normalize them again afterwards:
@@ -377,9 +418,9 @@ void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tin
 				//float normalScalingFactor = 1.0;
 				normalScalingFactors.emplace_back(normalScalingFactor);
 				auto normalized = normalScalingFactor * transformed;
-				normalBuffer.insert(normalBuffer.end(), {static_cast<float>(normalized.x), static_cast<float>(normalized.y), static_cast<float>(normalized.z)});
-			} else {
-				normalBuffer.insert(normalBuffer.end(), {normal[0], normal[1], normal[2]});
+				normalValues->insert(normalValues->end(), {static_cast<float>(normalized.x), static_cast<float>(normalized.y), static_cast<float>(normalized.z)});
+			} else if (normalValues) {
+				normalValues->insert(normalValues->end(), {normal[0], normal[1], normal[2]});
 			}
 
 			if (tangentData) {
@@ -397,9 +438,13 @@ void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tin
 		for (size_t targetIndex = 0; targetIndex < primitive.targets.size(); targetIndex++) {
 			auto it = primitive.targets[targetIndex].find("NORMAL");
 			if (it != primitive.targets[targetIndex].end()) {
-				glTFBufferData data(scene, it->second, std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC3});
+				glTFBufferData data(scene, buffers, it->second, std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT}, std ::set<int>{TINYGLTF_TYPE_VEC3});
 
 				if (data.accessor_.count == numVertices) {
+					if (!globalNormalMatrix && referenceAttributeData(data, morphNormalBuffers[targetIndex], TINYGLTF_TYPE_VEC3, referenceSceneData)) {
+						continue;
+					}
+					auto &morphNormalBuffer = morphNormalBuffers[targetIndex].convertedData();
 					for (size_t index = 0; index < data.accessor_.count; index++) {
 						auto normal = data.getDataAt<float>(index);
 						if (globalNormalMatrix) {
@@ -407,9 +452,9 @@ void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tin
 							// Use the same scaling factor for the morph target normals as for the base normals to make sure the direction
 							// of the morphed normals is not changed by normalization.
 							auto normalized = normalScalingFactors[index] * transformed;
-							morphNormalBuffers[targetIndex].insert(morphNormalBuffers[targetIndex].end(), {static_cast<float>(normalized.x), static_cast<float>(normalized.y), static_cast<float>(normalized.z)});
+							morphNormalBuffer.insert(morphNormalBuffer.end(), {static_cast<float>(normalized.x), static_cast<float>(normalized.y), static_cast<float>(normalized.z)});
 						} else {
-							morphNormalBuffers[targetIndex].insert(morphNormalBuffers[targetIndex].end(), {normal[0], normal[1], normal[2]});
+							morphNormalBuffer.insert(morphNormalBuffer.end(), {normal[0], normal[1], normal[2]});
 						}
 
 
@@ -421,34 +466,34 @@ void glTFMesh::loadPrimitiveData(const tinygltf::Primitive &primitive, const tin
 		}
 	}
 
-	convertAttributeSet(primitive, scene, uvBuffers, "TEXCOORD",
+	convertAttributeSet(primitive, scene, buffers, uvBuffers, "TEXCOORD",
 		std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT},
-		std::set<int>{TINYGLTF_TYPE_VEC2}, true, numVertices);
+		std::set<int>{TINYGLTF_TYPE_VEC2}, true, numVertices, referenceSceneData);
 
-	convertAttributeSet(primitive, scene, colorBuffers, "COLOR",
+	convertAttributeSet(primitive, scene, buffers, colorBuffers, "COLOR",
 		std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT},
-		std::set<int>{TINYGLTF_TYPE_VEC3, TINYGLTF_TYPE_VEC4}, true, numVertices, true);
+		std::set<int>{TINYGLTF_TYPE_VEC3, TINYGLTF_TYPE_VEC4}, true, numVertices, referenceSceneData, true);
 
 	if (colorBuffers.empty()) {
-		convertAttributeSet(primitive, scene, colorBuffers, "_COLOR",
+		convertAttributeSet(primitive, scene, buffers, colorBuffers, "_COLOR",
 			std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT},
-			std::set<int>{TINYGLTF_TYPE_VEC3, TINYGLTF_TYPE_VEC4}, true, numVertices, true);
+			std::set<int>{TINYGLTF_TYPE_VEC3, TINYGLTF_TYPE_VEC4}, true, numVertices, referenceSceneData, true);
 	}
 
-	convertAttributeSet(primitive, scene, jointBuffers, "JOINTS",
+	convertAttributeSet(primitive, scene, buffers, jointBuffers, "JOINTS",
 		std::set<int>{TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT},
-		std::set<int>{TINYGLTF_TYPE_VEC4}, false, numVertices);
+		std::set<int>{TINYGLTF_TYPE_VEC4}, false, numVertices, referenceSceneData);
 
-	convertAttributeSet(primitive, scene, weightBuffers, "WEIGHTS",
+	convertAttributeSet(primitive, scene, buffers, weightBuffers, "WEIGHTS",
 		std::set<int>{TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT},
-		std::set<int>{TINYGLTF_TYPE_VEC4}, true, numVertices);
+		std::set<int>{TINYGLTF_TYPE_VEC4}, true, numVertices, referenceSceneData);
 
 	// Collect our faces/indexes
 	// Note: we build the correct submesh ranges here in anticipation of submesh support in the meshnode.
 	IndexBufferRangeInfo bufferRange = {static_cast<uint32_t>(indexBuffer_.size()), 0};
 
 	if (primitive.indices > -1) {
-		glTFBufferData indexBufferData(scene, primitive.indices, {TINYGLTF_PARAMETER_TYPE_UNSIGNED_INT, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, TINYGLTF_TEXTURE_TYPE_UNSIGNED_BYTE}, std::set<int>{TINYGLTF_TYPE_SCALAR});
+		glTFBufferData indexBufferData(scene, buffers, primitive.indices, {TINYGLTF_PARAMETER_TYPE_UNSIGNED_INT, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, TINYGLTF_TEXTURE_TYPE_UNSIGNED_BYTE}, std::set<int>{TINYGLTF_TYPE_SCALAR});
 		auto indexAccessorCount = indexBufferData.accessor_.count;
 
 		for (size_t index = 0; index < indexAccessorCount; index++) {
@@ -153,6 +153,42 @@ TEST_F(MeshLoaderTest, glTFLoadInvalidThenValid) {
 	ASSERT_NE(mesh, nullptr);
 }
 
+TEST_F(MeshLoaderTest, glTFUnbakedAttributeDataValidAfterLoaderReset) {
+	core::MeshDescriptor desc;
+	desc.absPath = test_path().append("meshes/AnimatedMorphCube/AnimatedMorphCube.gltf").string();
+	desc.bakeAllSubmeshes = false;
+	desc.submeshIndex = 0;
+
+	mesh_loader::glTFFileLoader fileloader(desc.absPath);
+	auto mesh = fileloader.loadMesh(desc);
+	fileloader.reset();
+	auto reloadedMesh = fileloader.loadMesh(desc);
+	fileloader.reset();
+
+	ASSERT_EQ(mesh->numAttributes(), reloadedMesh->numAttributes());
+	for (uint32_t index = 0; index < mesh->numAttributes(); index++) {
+		ASSERT_EQ(mesh->attribName(index), reloadedMesh->attribName(index));
+		ASSERT_EQ(mesh->attribDataSize(index), reloadedMesh->attribDataSize(index));
+		ASSERT_EQ(std::memcmp(mesh->attribBuffer(index), reloadedMesh->attribBuffer(index), mesh->attribDataSize(index)), 0);
+	}
+}
+
+TEST_F(MeshLoaderTest, glTFTriangleBufferMatchesIndexedPositions) {
+	for (bool bake : {false, true}) {
+		auto mesh = loadMesh("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf", bake, 1);
+		auto posData = getPositionData(mesh);
+		const auto &indices = mesh->getIndices();
+
+		const auto &triangles = mesh->triangleBuffer();
+		ASSERT_EQ(triangles.size(), indices.size());
+		for (size_t index = 0; index < indices.size(); index++) {
+			auto vertex = indices[index];
+			ASSERT_EQ(triangles[index], glm::vec3(posData[3 * vertex], posData[3 * vertex + 1], posData[3 * vertex + 2]));
+		}
+		ASSERT_EQ(&mesh->triangleBuffer(), &triangles);
+	}
+}
+
 TEST_F(MeshLoaderTest, glTFWithTangentsAndBitangents) {
 	auto mesh = loadMesh("meshes/AnimatedMorphCube/AnimatedMorphCube.gltf", false, 0);
 
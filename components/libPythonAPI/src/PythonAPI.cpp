@@ -417,22 +417,31 @@ void setTags(core::SEditorObject obj, std::vector<std::string> tags, std::string
 
 class CompositeCommand {
 public:
-	CompositeCommand(const std::string& description) : description_(description) {}
+	CompositeCommand(const std::string& description, bool transaction) : description_(description), transaction_(transaction) {}
 
 	void enter() {
-		app->activeRaCoProject().undoStack()->beginCompositeCommand();
-		LOG_DEBUG(log_system::PYTHON, "Being composite command '{}'.", description_);
+		if (transaction_) {
+			app->activeRaCoProject().commandInterface()->beginTransaction();
+		} else {
+			app->activeRaCoProject().undoStack()->beginCompositeCommand();
+		}
+		LOG_DEBUG(log_system::PYTHON, "Being composite command '{}'. Transaction = {}", description_, transaction_);
 	}
 
 	bool exit(std::optional<py::object> ex_type, std::optional<py::object> ex_value, std::optional<py::object> traceback) {
 		bool haveException = ex_type.has_value();
-		app->activeRaCoProject().undoStack()->endCompositeCommand(description_, haveException);
+		if (transaction_) {
+			app->activeRaCoProject().commandInterface()->endTransaction(description_, haveException);
+		} else {
+			app->activeRaCoProject().undoStack()->endCompositeCommand(description_, haveException);
+		}
 		LOG_DEBUG(log_system::PYTHON, "End composite command '{}'. Exception = {}", description_, haveException);
 		return false;
 	}
 
 private:
 	std::string description_;
+	bool transaction_;
 };
 
 }  // namespace
@@ -681,7 +690,7 @@ PYBIND11_EMBEDDED_MODULE(raco, m) {
 		}
 	});
 
-	m.def("save", [](std::string path, bool setNewIDs) {
+	m.def("save", [](std::string path, bool setNewIDs, std::optional<bool> binary) {
 		if (app->isRunningInUI()) {
 			throw std::runtime_error(fmt::format("Can not save project: project-switching Python functions currently not allowed in UI."));
 		}
@@ -692,6 +701,9 @@ PYBIND11_EMBEDDED_MODULE(raco, m) {
 		if (app->canSaveActiveProject()) {
 			std::string errorMsg;
 			bool success;
+			if (binary.has_value()) {
+				app->activeRaCoProject().setFileFormat(*binary ? application::RaCoProject::FileFormat::Binary : application::RaCoProject::FileFormat::Json);
+			}
 			if (setNewIDs) {
 				success = app->saveAsWithNewIDs(QString::fromStdString(path), errorMsg, app->activeProjectPath().empty());
 			} else {
@@ -703,7 +715,7 @@ PYBIND11_EMBEDDED_MODULE(raco, m) {
 		} else {
 			throw std::runtime_error(fmt::format("Can not save project: externally referenced projects not clean."));
 		}
-	});
+	}, py::arg("path"), py::arg("setNewIDs") = false, py::arg("binary") = py::none());
 
 	m.def("projectPath", []() {
 		return app->activeProjectPath();
@@ -746,6 +758,27 @@ PYBIND11_EMBEDDED_MODULE(raco, m) {
 		return app->isRunningInUI();
 	});
 
+	m.def("meshCacheStatistics", []() {
+		auto stats = app->meshCache()->statistics();
+		return std::map<std::string, size_t>{
+			{"memoryBudget", stats.memoryBudget},
+			{"memoryUsage", stats.memoryUsage},
+			{"entryCount", stats.entryCount},
+			{"loadedEntryCount", stats.loadedEntryCount},
+			{"fileLoadCount", stats.fileLoadCount},
+			{"evictionCount", stats.evictionCount},
+			{"meshDataHitCount", stats.meshDataHitCount},
+			{"pendingLoadCount", stats.pendingLoadCount}};
+	});
+
+	m.def("waitForMeshLoading", []() {
+		app->waitForPendingMeshLoads();
+	});
+
+	m.def("setMeshCacheMemoryBudget", [](size_t memoryBudget) {
+		app->meshCache()->setMemoryBudget(memoryBudget);
+	});
+
 	m.def("importGLTF", [](const std::string path) {
 		python_import_gltf(path, nullptr);
 	});
@@ -1180,7 +1213,7 @@ PYBIND11_EMBEDDED_MODULE(raco, m) {
 	});
 
 	py::class_<CompositeCommand>(m, "compositeCommand")
-		.def(py::init<const std::string&>())
+		.def(py::init<const std::string&, bool>(), py::arg("description"), py::arg("transaction") = false)
 		.def("__enter__", &CompositeCommand::enter)
 		.def("__exit__", &CompositeCommand::exit);
 }
@@ -187,6 +187,40 @@ with raco.compositeCommand("outer"):
 	EXPECT_TRUE(raco::select<user_types::Node>(project().instances(), "node_2") != nullptr);
 }
 
+TEST_F(PythonTest, composite_command_transaction) {
+	auto start_index = application.activeRaCoProject().undoStack()->getIndex();
+	py::exec(R"(
+import raco
+with raco.compositeCommand("test", transaction=True):
+	node = raco.create("Node", "node_1")
+	for i in range(100):
+		node.translation.x = float(i)
+)");
+	auto end_index = application.activeRaCoProject().undoStack()->getIndex();
+	EXPECT_EQ(end_index - start_index, 1);
+	EXPECT_EQ(application.activeRaCoProject().commandInterface()->transactionDepth(), 0);
+	auto node = raco::select<user_types::Node>(project().instances(), "node_1");
+	ASSERT_TRUE(node != nullptr);
+	EXPECT_EQ(*node->translation_->x, 99.0);
+}
+
+TEST_F(PythonTest, composite_command_transaction_exception) {
+	auto start_index = application.activeRaCoProject().undoStack()->getIndex();
+	try {
+		py::exec(R"(
+import raco
+with raco.compositeCommand("test", transaction=True):
+	raco.create("Node", "node_1")
+	raise RuntimeError("error")
+)");
+	} catch (std::exception&) {
+	}
+	auto end_index = application.activeRaCoProject().undoStack()->getIndex();
+	EXPECT_EQ(end_index - start_index, 0);
+	EXPECT_EQ(application.activeRaCoProject().commandInterface()->transactionDepth(), 0);
+	EXPECT_TRUE(raco::select<user_types::Node>(project().instances(), "node_1") == nullptr);
+}
+
 TEST_F(PythonTest, composite_command_fail_reset) {
 	std::string script = R"(
 import raco
@@ -258,3 +292,20 @@ with raco.compositeCommand("test"):
 	auto end_index = application.activeRaCoProject().undoStack()->getIndex();
 	EXPECT_EQ(start_index, end_index);
 }
+
+TEST_F(PythonTest, mesh_cache_statistics) {
+	py::exec(R"(
+import raco
+raco.setMeshCacheMemoryBudget(0)
+mesh = raco.create("Mesh", "mesh")
+mesh.uri = ")" + (test_path() / "meshes/Duck.glb").string() + R"("
+)");
+	auto stats = py::eval("raco.meshCacheStatistics()").cast<std::map<std::string, size_t>>();
+	EXPECT_EQ(stats["memoryBudget"], 0);
+	EXPECT_EQ(stats["entryCount"], 1);
+	// The most recently used file is never discarded.
+	EXPECT_EQ(stats["loadedEntryCount"], 1);
+	EXPECT_GT(stats["memoryUsage"], 0);
+	EXPECT_EQ(stats["fileLoadCount"], 1);
+	EXPECT_EQ(stats["evictionCount"], 0);
+}
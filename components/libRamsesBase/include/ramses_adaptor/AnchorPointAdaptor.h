@@ -16,7 +16,7 @@
 
 namespace raco::ramses_adaptor {
 
-class AnchorPointAdaptor final : public UserTypeObjectAdaptor<user_types::AnchorPoint>, public ILogicPropertyProvider {
+class AnchorPointAdaptor final : public UserTypeObjectAdaptor<user_types::AnchorPoint>, public ILogicPropertyProvider, public ILogicOutputProvider {
 public:
 	AnchorPointAdaptor(SceneAdaptor* sceneAdaptor, user_types::SAnchorPoint anchorPoint);
 
@@ -26,7 +26,7 @@ public:
 	std::vector<ExportInformation> getExportInformation() const override;
 
 	bool sync(core::Errors* errors) override;
-	void readDataFromEngine(core::DataChangeRecorder& recorder);
+	void readDataFromEngine(core::DataChangeRecorder& recorder) override;
 
 private:
 	ramses_base::RamsesAnchorPoint anchorPoint_;
@@ -18,7 +18,7 @@
 
 namespace raco::ramses_adaptor {
 
-class AnimationAdaptor final : public UserTypeObjectAdaptor<user_types::Animation>, public ILogicPropertyProvider {
+class AnimationAdaptor final : public UserTypeObjectAdaptor<user_types::Animation>, public ILogicPropertyProvider, public ILogicOutputProvider {
 public:
 	explicit AnimationAdaptor(SceneAdaptor* sceneAdaptor, user_types::SAnimation animation);
 
@@ -27,7 +27,7 @@ public:
 	void onRuntimeError(core::Errors& errors, std::string const& message, core::ErrorLevel level) override;
 
 	bool sync(core::Errors* errors) override;
-	void readDataFromEngine(core::DataChangeRecorder& recorder);
+	void readDataFromEngine(core::DataChangeRecorder& recorder) override;
 	std::vector<ExportInformation> getExportInformation() const override;
 
 private:
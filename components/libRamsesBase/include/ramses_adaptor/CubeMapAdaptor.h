@@ -19,12 +19,13 @@
 
 namespace raco::ramses_adaptor {
 
-class CubeMapAdaptor : public TypedObjectAdaptor<user_types::CubeMap, ramses::TextureSampler> {
+class CubeMapAdaptor : public TypedObjectAdaptor<user_types::CubeMap, ramses::TextureSampler>, public IMipMapImageProvider {
 public:
 	explicit CubeMapAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<user_types::CubeMap> editorObject);
 
 	bool sync(core::Errors* errors) override;
 	std::vector<ExportInformation> getExportInformation() const override;
+	void getMipMapImages(std::vector<ramses_base::MipMapImage>& images) const override;
 
 private:
 	ramses_base::RamsesTextureCube createTexture(core::Errors* errors);
@@ -21,7 +21,7 @@
 
 namespace raco::ramses_adaptor {
 
-class LuaScriptAdaptor : public UserTypeObjectAdaptor<user_types::LuaScript>, public ILogicPropertyProvider {
+class LuaScriptAdaptor : public UserTypeObjectAdaptor<user_types::LuaScript>, public ILogicPropertyProvider, public ILogicOutputProvider {
 public:
 	explicit LuaScriptAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<user_types::LuaScript> editorObject);
 	void getLogicNodes(std::vector<ramses::LogicNode*>& logicNodes) const override;
@@ -29,7 +29,7 @@ public:
 	void onRuntimeError(core::Errors& errors, std::string const& message, core::ErrorLevel level) override;
 
 	bool sync(core::Errors* errors) override;
-	void readDataFromEngine(core::DataChangeRecorder &recorder);
+	void readDataFromEngine(core::DataChangeRecorder& recorder) override;
 	std::vector<ExportInformation> getExportInformation() const override;
 
 private:
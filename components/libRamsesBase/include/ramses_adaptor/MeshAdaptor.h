@@ -20,10 +20,12 @@ namespace raco::ramses_adaptor {
 
 class SceneAdaptor;
 using VertexDataMap = std::unordered_map<std::string, ramses_base::RamsesArrayResource>;
+struct MeshResources;
 
 class MeshAdaptor final : public UserTypeObjectAdaptor<user_types::Mesh> {
 public:
 	explicit MeshAdaptor(SceneAdaptor* sceneAdaptor, user_types::SMesh mesh);
+	~MeshAdaptor() override;
 
 	ramses_base::RamsesArrayResource indicesPtr();
 	const VertexDataMap& vertexData() const;
@@ -34,8 +36,8 @@ public:
 	std::vector<ExportInformation> getExportInformation() const override;
 
 private:
-	VertexDataMap vertexDataMap_;
-	ramses_base::RamsesArrayResource indices_;
+	// Array resources shared with all other Mesh adaptors using the same mesh data.
+	std::shared_ptr<const MeshResources> resources_;
 	core::FileChangeMonitor::UniqueListener meshFileChangeListener_;
 	components::Subscription subscription_;
 	components::Subscription nameSubscription_;
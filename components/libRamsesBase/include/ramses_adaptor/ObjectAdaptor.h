@@ -50,12 +50,26 @@ public:
 	}
 };
 
+/**
+ * Adaptors of objects with logic engine outputs which need to be copied back into the data model
+ * after each logic engine update. SceneAdaptor keeps a separate registry of these adaptors.
+ */
+class ILogicOutputProvider {
+public:
+	virtual void readDataFromEngine(core::DataChangeRecorder& recorder) = 0;
+};
 
 class ISceneObjectProvider {
 public:
 	virtual RamsesHandle<ramses::Node> sceneObject() = 0;
 };
 
+class IMipMapImageProvider {
+public:
+	// Images decoded by the next sync, used to decode the images of several adaptors in parallel beforehand.
+	virtual void getMipMapImages(std::vector<ramses_base::MipMapImage>& images) const = 0;
+};
+
 struct ExportInformation {
 	std::string type;
 	const std::string name;
@@ -21,8 +21,25 @@
 namespace raco::ramses_adaptor {
 
 class ObjectAdaptor;
+class ILogicOutputProvider;
 
 using SRamsesAdaptorDispatcher = std::shared_ptr<components::DataChangeDispatcher>;
+using VertexDataMap = std::unordered_map<std::string, ramses_base::RamsesArrayResource>;
+
+/**
+ * @brief Index and vertex array resources created from a single MeshData object.
+ *
+ * Shared by all Mesh adaptors using the same mesh data, see SceneAdaptor::meshResources.
+ */
+struct MeshResources {
+	core::SharedMeshData meshData;
+	ramses_base::RamsesArrayResource indices;
+	VertexDataMap vertexData;
+};
+using SharedMeshResources = std::shared_ptr<const MeshResources>;
+
+struct ExportInformation;
+
 class SceneAdaptor {
 	using Project = core::Project;
 	using SEditorObject = core::SEditorObject;
@@ -47,7 +64,16 @@ public:
 	const ramses_base::RamsesArrayResource defaultVertices(int index);
 	const ramses_base::RamsesArrayResource defaultNormals(int index);
 	const ramses_base::RamsesArrayResource defaultIndices(int index);
+	// Get the array resources for the mesh data and register the mesh as one of their users.
+	// The resources are named after their first user and renamed when that user releases them.
+	SharedMeshResources acquireMeshResources(const core::SharedMeshData& meshData, const SEditorObject& mesh);
+	// Unregister the mesh from its array resources; the resources are dropped from the pool together with their last user.
+	void releaseMeshResources(const SEditorObject& mesh);
+	// Export information of the pooled array resources used by the mesh, empty if it doesn't use any.
+	std::vector<ExportInformation> meshResourcesExportInformation(const SEditorObject& mesh) const;
 	ObjectAdaptor* lookupAdaptor(const core::SEditorObject& editorObject) const;
+	// Called by ObjectAdaptor::tagDirty: the adaptor of the object is synced in the next bulk update.
+	void markAdaptorDirty(const SEditorObject& object);
 	Project& project() const;
 
 	template <class T>
@@ -78,10 +104,14 @@ private:
 	void removeLink(const core::LinkDescriptor& link);
 	void createAdaptor(SEditorObject obj);
 	void removeAdaptor(SEditorObject obj);
+	void onObjectDeleted(SEditorObject obj);
 
 	void performBulkEngineUpdate(const core::SEditorObjectSet& changedObjects);
 
-	void rebuildSortedDependencyGraph(SEditorObjectSet const& objects);
+	void updateSortedDependencyGraph(SEditorObjectSet const& changedObjects);
+	void updateRenderOrderErrors();
+	// Decode the images of the dirty Texture and CubeMap adaptors of the changed objects in parallel before they are synced.
+	void prefetchTextureData(const core::SEditorObjectSet& changedObjects);
 
 	void deleteUnusedDefaultResources();
 
@@ -104,7 +134,25 @@ private:
 	std::array<ramses_base::RamsesArrayResource, 2> defaultVertices_;
 	std::array<ramses_base::RamsesArrayResource, 2> defaultNormals_;
 
+	struct MeshResourcesEntry {
+		SharedMeshResources resources;
+		// Meshes using the resources; the resources are named after the first one.
+		std::vector<SEditorObject> users;
+	};
+
+	// Mesh array resources pool: entries are dropped once the last Mesh adaptor using them releases them.
+	// Since the MeshResources keep the MeshData alive the key can't be reused while the entry exists.
+	// Declared before the adaptors since the Mesh adaptors release their resources on destruction.
+	std::unordered_map<const core::MeshData*, MeshResourcesEntry> meshResources_;
+	std::unordered_map<SEditorObject, const core::MeshData*> meshResourcesUsers_;
+
+	// Objects whose adaptors have been tagged dirty since the last bulk update.
+	// Declared before the adaptors since the adaptors may be tagged dirty until they are destroyed.
+	SEditorObjectSet dirtyObjects_;
+
 	std::map<SEditorObject, std::unique_ptr<ObjectAdaptor>> adaptors_{};
+	// Subset of the adaptors whose logic engine outputs are read back in readDataFromEngine.
+	std::map<SEditorObject, ILogicOutputProvider*> logicOutputProviders_{};
 
 	struct LinkAdaptorContainer {
 		std::map<std::string, std::map<core::LinkDescriptor, SharedLinkAdaptor>> linksByStart_{};
@@ -122,7 +170,12 @@ private:
 
 	bool adaptorStatusDirty_ = false;
 
-	std::vector<DependencyNode> dependencyGraph_;
+	SortedDependencyGraph dependencyGraph_;
+	// Objects deleted since the last bulk update; removed from the dependency graph in the next update.
+	SEditorObjectSet deletedObjects_;
+	// All RenderPass and BlitPass objects in the project, used for the renderOrder uniqueness check.
+	SEditorObjectSet renderPasses_;
+	bool renderOrderDirty_ = true;
 
 	SEditorObject lastErrorObject_ = nullptr;
 };
@@ -17,7 +17,7 @@
 
 namespace raco::ramses_adaptor {
 
-class TimerAdaptor final : public UserTypeObjectAdaptor<user_types::Timer>, public ILogicPropertyProvider {
+class TimerAdaptor final : public UserTypeObjectAdaptor<user_types::Timer>, public ILogicPropertyProvider, public ILogicOutputProvider {
 public:
 	TimerAdaptor(SceneAdaptor* sceneAdaptor, user_types::STimer timer);
 
@@ -27,7 +27,7 @@ public:
 	std::vector<ExportInformation> getExportInformation() const override;
 
 	bool sync(core::Errors* errors) override;
-	void readDataFromEngine(core::DataChangeRecorder& recorder);
+	void readDataFromEngine(core::DataChangeRecorder& recorder) override;
 
 private:
 	ramses_base::RamsesTimerNode timerNode_;
@@ -27,9 +27,11 @@
 #include "utils/MathUtils.h"
 
 #include <memory>
+#include <optional>
 #include <ramses/client/logic/Property.h>
 #include <ramses/client/logic/NodeBinding.h>
 #include <type_traits>
+#include <unordered_map>
 
 namespace raco::ramses_adaptor {
 
@@ -269,6 +271,47 @@ struct DependencyNode {
 
 std::vector<DependencyNode> buildSortedDependencyGraph(core::SEditorObjectSet const& objects);
 
+/**
+ * @brief Topologically sorted dependency graph which can be updated incrementally.
+ *
+ * The node list is sorted such that all objects referenced by a node come before the node itself.
+ * Instead of rebuilding the complete graph after every change, only the nodes of changed objects are rescanned
+ * for references. If a changed reference violates the current order only the range of nodes between the
+ * violating objects is re-sorted.
+ */
+class SortedDependencyGraph {
+public:
+	void rebuild(core::SEditorObjectSet const& objects);
+	void clear();
+
+	/**
+	 * @brief Update the graph.
+	 * @param changedObjects Created objects and objects with changed properties. Objects not yet in the graph are added.
+	 * @param deletedObjects Objects to remove from the graph.
+	 */
+	void update(core::SEditorObjectSet const& changedObjects, core::SEditorObjectSet const& deletedObjects);
+
+	bool empty() const;
+	bool contains(core::SEditorObject const& object) const;
+	// Position of the object in nodes() or std::nullopt if the object is not part of the graph.
+	std::optional<size_t> nodeIndex(core::SEditorObject const& object) const;
+	// Objects whose nodes reference the object.
+	const core::SEditorObjectSet& referencingObjects(core::SEditorObject const& object) const;
+
+	const std::vector<DependencyNode>& nodes() const;
+
+private:
+	void removeNodes(core::SEditorObjectSet const& deletedObjects);
+	void updateReferences(size_t nodeIndex, size_t& lowerBound, size_t& upperBound);
+	void sortRange(size_t lowerBound, size_t upperBound);
+	void reindex(size_t startIndex, size_t endIndex);
+
+	std::vector<DependencyNode> nodes_;
+	std::unordered_map<core::SEditorObject, size_t> index_;
+	// Reverse edges: objects referencing the key object.
+	std::unordered_map<core::SEditorObject, core::SEditorObjectSet> referencingObjects_;
+};
+
 ramses_base::RamsesArrayResource arrayResourceFromAttribute(ramses::Scene* scene, core::SharedMeshData mesh, int attribIndex, std::string_view name);
 
 };	// namespace raco::ramses_adaptor
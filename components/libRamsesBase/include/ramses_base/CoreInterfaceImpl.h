@@ -10,6 +10,7 @@
 #pragma once
 
 #include "core/EngineInterface.h"
+#include "ramses_base/LuaScriptInterfaceCache.h"
 #include "ramses_base/Utils.h"
 #include "user_types/LuaScript.h"
 #include "ramses_base/RamsesHandles.h"
@@ -36,6 +37,7 @@ private:
 	ramses::LogicEngine* logicEngine();
 
 	std::tuple<ramses::LuaConfig, bool> createFullLuaConfig(const std::vector<std::string>& stdModules, const data_storage::Table& modules);
+	LuaScriptInterfaceCache::Key luaInterfaceCacheKey(bool isInterface, const std::string& text, const std::vector<std::string>& stdModules, const data_storage::Table& modules) const;
 
 	BaseEngineBackend* backend_;
 
@@ -0,0 +1,132 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <ramses/framework/TextureEnums.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace raco::ramses_base {
+
+struct DecodedImage {
+	// lodepng error code, 0 if the image was decoded successfully.
+	unsigned error = 0;
+	unsigned width = 0;
+	unsigned height = 0;
+	// Color type and bit depth of the image file.
+	int colorType = -1;
+	unsigned bitdepth = 0;
+	// Decoded pixel data converted to the target texture format.
+	std::vector<unsigned char> data;
+
+	size_t memorySize() const {
+		return sizeof(DecodedImage) + data.size();
+	}
+};
+
+using SDecodedImage = std::shared_ptr<const DecodedImage>;
+
+/**
+ * @brief Cache for decoded image files shared by all texture and cubemap adaptors.
+ *
+ * Images are identified by the absolute file path together with the texture format and swizzle setting
+ * used for decoding. A cached image is only used as long as the modification time and size of the file
+ * are unchanged; this way a file change reported by the file change monitors will cause a reload when
+ * the adaptor is synced again. The file content itself is not compared: a change which keeps the file size
+ * and happens within the timestamp resolution of the file system is not detected. The application therefore
+ * clears the cache when switching projects.
+ *
+ * The memory used by the cached images is bounded; the least recently used images are dropped first.
+ * The cache is thread-safe. Decoding happens outside of the lock.
+ */
+class DecodedImageCache {
+public:
+	// Decode the image from the file content.
+	using Decoder = std::function<DecodedImage(const std::vector<unsigned char>& fileContent)>;
+
+	static constexpr size_t DEFAULT_MEMORY_BUDGET = 512 * 1024 * 1024;
+
+	struct Statistics {
+		size_t hits = 0;
+		// Number of lookups which needed to decode the image file.
+		size_t misses = 0;
+		size_t entryCount = 0;
+
+		// Fraction of lookups answered from the cache, 0 if there were no lookups.
+		double hitRate() const {
+			return hits + misses > 0 ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0;
+		}
+	};
+
+	static DecodedImageCache& instance();
+
+	explicit DecodedImageCache(size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+	/**
+	 * @brief Get the decoded image from the cache or read and decode the file if needed.
+	 *
+	 * Images of files which can't be accessed or which fail to decode are not cached.
+	 */
+	SDecodedImage get(const std::string& absPath, ramses::ETextureFormat format, bool swizzle, const Decoder& decoder);
+
+	void clear();
+
+	void setMemoryBudget(size_t memoryBudget);
+	size_t memoryBudget() const;
+	size_t memoryUsage() const;
+	size_t size() const;
+
+	Statistics statistics() const;
+	void resetStatistics();
+
+private:
+	struct FileVersion {
+		std::filesystem::file_time_type modificationTime;
+		std::uintmax_t size;
+
+		bool operator==(const FileVersion& other) const {
+			return modificationTime == other.modificationTime && size == other.size;
+		}
+	};
+
+	using Key = std::tuple<std::string, ramses::ETextureFormat, bool>;
+
+	struct Entry {
+		Key key;
+		FileVersion version;
+		SDecodedImage image;
+	};
+
+	static bool readFileVersion(const std::string& absPath, FileVersion& outVersion);
+
+	// All functions below need to be called with the mutex locked.
+	void erase(std::list<Entry>::iterator it);
+	void evict();
+
+	mutable std::mutex mutex_;
+	// Most recently used entries first.
+	std::list<Entry> entries_;
+	std::map<Key, std::list<Entry>::iterator> index_;
+	size_t memoryBudget_;
+	size_t memoryUsage_ = 0;
+	size_t hits_ = 0;
+	size_t misses_ = 0;
+};
+
+}  // namespace raco::ramses_base
@@ -0,0 +1,152 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace raco::ramses_base {
+
+inline void hashCombine(size_t& seed, size_t value) {
+	seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+inline void hashCombine(size_t& seed, const std::vector<std::string>& strings) {
+	for (const auto& string : strings) {
+		hashCombine(seed, std::hash<std::string>()(string));
+	}
+	hashCombine(seed, strings.size());
+}
+
+/**
+ * @brief Thread-safe cache of immutable shared values with a bounded number of entries.
+ *
+ * The least recently used entries are dropped first. Values are created outside of the lock,
+ * so two threads missing the same key at the same time may both create the value.
+ */
+template <typename Key, typename Value, typename KeyHash = std::hash<Key>>
+class LruCache {
+public:
+	using SValue = std::shared_ptr<const Value>;
+
+	struct Statistics {
+		size_t hits = 0;
+		size_t misses = 0;
+		size_t entryCount = 0;
+
+		// Fraction of lookups answered from the cache, 0 if there were no lookups.
+		double hitRate() const {
+			return hits + misses > 0 ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0;
+		}
+	};
+
+	explicit LruCache(size_t maxEntries) : maxEntries_(maxEntries) {
+	}
+
+	/**
+	 * @brief Get the value from the cache or create it using the factory if needed.
+	 *
+	 * The factory returns the new value or nullptr if the value can't be created; nullptr is not cached.
+	 */
+	template <typename Factory>
+	SValue getOrCreate(const Key& key, const Factory& factory) {
+		{
+			std::lock_guard lock(mutex_);
+			auto it = index_.find(key);
+			if (it != index_.end()) {
+				++hits_;
+				entries_.splice(entries_.begin(), entries_, it->second);
+				return entries_.front().value;
+			}
+			++misses_;
+		}
+
+		SValue value = factory();
+
+		if (value && maxEntries() > 0) {
+			std::lock_guard lock(mutex_);
+			// Another thread may have created the same value in the meantime.
+			if (auto it = index_.find(key); it != index_.end()) {
+				erase(it->second);
+			}
+			entries_.emplace_front(Entry{key, value});
+			index_[key] = entries_.begin();
+			evict();
+		}
+
+		return value;
+	}
+
+	void clear() {
+		std::lock_guard lock(mutex_);
+		entries_.clear();
+		index_.clear();
+	}
+
+	void setMaxEntries(size_t maxEntries) {
+		std::lock_guard lock(mutex_);
+		maxEntries_ = maxEntries;
+		evict();
+	}
+
+	size_t maxEntries() const {
+		std::lock_guard lock(mutex_);
+		return maxEntries_;
+	}
+
+	size_t size() const {
+		std::lock_guard lock(mutex_);
+		return entries_.size();
+	}
+
+	Statistics statistics() const {
+		std::lock_guard lock(mutex_);
+		return {hits_, misses_, entries_.size()};
+	}
+
+	void resetStatistics() {
+		std::lock_guard lock(mutex_);
+		hits_ = 0;
+		misses_ = 0;
+	}
+
+private:
+	struct Entry {
+		Key key;
+		SValue value;
+	};
+
+	// All functions below need to be called with the mutex locked.
+	void erase(typename std::list<Entry>::iterator it) {
+		index_.erase(it->key);
+		entries_.erase(it);
+	}
+
+	void evict() {
+		while (entries_.size() > maxEntries_) {
+			erase(std::prev(entries_.end()));
+		}
+	}
+
+	mutable std::mutex mutex_;
+	// Most recently used entries first.
+	std::list<Entry> entries_;
+	std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> index_;
+	size_t maxEntries_;
+	size_t hits_ = 0;
+	size_t misses_ = 0;
+};
+
+}  // namespace raco::ramses_base
@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/EngineInterface.h"
+#include "ramses_base/LruCache.h"
+
+#include <ramses/framework/EFeatureLevel.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace raco::ramses_base {
+
+struct LuaScriptInterface {
+	core::PropertyInterfaceList inputs;
+	core::PropertyInterfaceList outputs;
+};
+
+using SLuaScriptInterface = std::shared_ptr<const LuaScriptInterface>;
+
+struct LuaModuleDependency {
+	std::string name;
+	std::string text;
+	std::vector<std::string> stdModules;
+
+	bool operator==(const LuaModuleDependency& other) const {
+		return name == other.name && text == other.text && stdModules == other.stdModules;
+	}
+};
+
+struct LuaScriptInterfaceKey {
+	ramses::EFeatureLevel featureLevel;
+	// LuaInterface objects are parsed differently from LuaScripts and only have inputs.
+	bool isInterface;
+	std::string text;
+	std::vector<std::string> stdModules;
+	std::vector<LuaModuleDependency> modules;
+
+	bool operator==(const LuaScriptInterfaceKey& other) const {
+		return featureLevel == other.featureLevel && isInterface == other.isInterface && text == other.text && stdModules == other.stdModules && modules == other.modules;
+	}
+};
+
+struct LuaScriptInterfaceKeyHash {
+	size_t operator()(const LuaScriptInterfaceKey& key) const;
+};
+
+/**
+ * @brief Cache for the inputs and outputs of LuaScripts and LuaInterfaces shared by all objects using the same script.
+ *
+ * Scripts are identified by the script text, the standard modules and the name, text and standard modules
+ * of all module dependencies together with the feature level. A change of the script or of a module file
+ * therefore results in a different key; the stale entry is never looked up again and eventually dropped.
+ *
+ * Only successfully parsed scripts are cached since the error messages contain the name of the object.
+ *
+ * The number of cached scripts is bounded; the least recently used entries are dropped first.
+ * The cache is thread-safe. Parsing happens outside of the lock.
+ */
+class LuaScriptInterfaceCache : public LruCache<LuaScriptInterfaceKey, LuaScriptInterface, LuaScriptInterfaceKeyHash> {
+public:
+	using ModuleDependency = LuaModuleDependency;
+	using Key = LuaScriptInterfaceKey;
+
+	// Parse the script and fill in its interface. Returns false if parsing failed.
+	using Parser = std::function<bool(LuaScriptInterface& outInterface)>;
+
+	static constexpr size_t DEFAULT_MAX_ENTRIES = 1024;
+
+	static LuaScriptInterfaceCache& instance();
+
+	explicit LuaScriptInterfaceCache(size_t maxEntries = DEFAULT_MAX_ENTRIES);
+
+	/**
+	 * @brief Get the interface of the script from the cache or parse the script if needed.
+	 *
+	 * @return nullptr if the script failed to parse.
+	 */
+	SLuaScriptInterface get(const Key& key, const Parser& parser);
+};
+
+}  // namespace raco::ramses_base
@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/EngineInterface.h"
+#include "ramses_base/LruCache.h"
+
+#include <ramses/framework/EFeatureLevel.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace raco::ramses_base {
+
+struct ShaderReflection {
+	bool success = false;
+	core::PropertyInterfaceList uniforms;
+	core::PropertyInterfaceList attributes;
+	std::string error;
+};
+
+using SShaderReflection = std::shared_ptr<const ShaderReflection>;
+
+struct ShaderProgramKey {
+	ramses::EFeatureLevel featureLevel;
+	std::string vertexShader;
+	std::string geometryShader;
+	std::string fragmentShader;
+	std::string shaderDefines;
+
+	bool operator==(const ShaderProgramKey& other) const {
+		return featureLevel == other.featureLevel && vertexShader == other.vertexShader && geometryShader == other.geometryShader && fragmentShader == other.fragmentShader && shaderDefines == other.shaderDefines;
+	}
+};
+
+struct ShaderProgramKeyHash {
+	size_t operator()(const ShaderProgramKey& key) const;
+};
+
+/**
+ * @brief Cache for the uniforms and attributes reflected from shader programs shared by all Materials.
+ *
+ * Shader programs are identified by the preprocessed vertex, geometry and fragment shader sources
+ * together with the shader defines and the feature level. Since the included files are already
+ * inlined by the shader preprocessor a change of an included file results in a different key;
+ * the stale entry is never looked up again and eventually dropped.
+ *
+ * The number of cached shader programs is bounded; the least recently used entries are dropped first.
+ * The cache is thread-safe. Parsing happens outside of the lock.
+ */
+class ShaderReflectionCache : public LruCache<ShaderProgramKey, ShaderReflection, ShaderProgramKeyHash> {
+public:
+	// Parse the shader program and reflect its uniforms and attributes.
+	using Parser = std::function<ShaderReflection()>;
+
+	static constexpr size_t DEFAULT_MAX_ENTRIES = 1024;
+
+	static ShaderReflectionCache& instance();
+
+	explicit ShaderReflectionCache(size_t maxEntries = DEFAULT_MAX_ENTRIES);
+
+	/**
+	 * @brief Get the reflection data of the shader program from the cache or parse it if needed.
+	 *
+	 * Both successfully parsed shader programs and the error messages of failed ones are cached.
+	 */
+	SShaderReflection get(ramses::EFeatureLevel featureLevel, const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines, const Parser& parser);
+};
+
+}  // namespace raco::ramses_base
@@ -74,7 +74,22 @@ std::string pngColorTypeToString(int colorType);
 int ramsesTextureFormatToChannelAmount(ramses::ETextureFormat textureFormat);
 void normalize16BitColorData(std::vector<unsigned char>& data);
 std::vector<unsigned char> generateColorDataWithoutBlueChannel(const std::vector<unsigned char>& data);
+
+// Image file and decoding parameters of a single Texture or CubeMap image as used by decodeMipMapData.
+struct MipMapImage {
+	std::string path;
+	ramses::ETextureFormat format;
+	bool swizzle;
+};
+
+// Name of the uri property of the given mipmap level, e.g. "uriLeft" -> "level2uriLeft".
+std::string mipMapUriPropertyName(const std::string& uriPropName, int level);
+// Returns std::nullopt if the uri property is empty.
+std::optional<MipMapImage> mipMapImage(core::Project& project, core::SEditorObject obj, const std::string& uriPropName, bool swizzle = false);
 std::vector<unsigned char> decodeMipMapData(core::Errors* errors, core::Project& project, core::SEditorObject obj, const std::string& uriPropName, int level, PngDecodingInfo& decodingInfo, bool swizzle = false);
+// Decode the images in parallel and store them in the DecodedImageCache to be picked up by decodeMipMapData.
+// Errors are only reported by decodeMipMapData.
+void prefetchMipMapData(const std::vector<MipMapImage>& images);
 std::tuple<std::string, ramses::ETextureFormat, ramses::TextureSwizzle> ramsesTextureFormatToSwizzleInfo(int colorType, ramses::ETextureFormat textureFormat);
 
 
@@ -26,6 +26,10 @@
 
 namespace raco::ramses_adaptor {
 
+namespace {
+const std::vector<std::string> cubeMapUriPropertyNames{"uriRight", "uriLeft", "uriTop", "uriBottom", "uriFront", "uriBack"};
+}
+
 CubeMapAdaptor::CubeMapAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<user_types::CubeMap> editorObject)
 	: TypedObjectAdaptor(sceneAdaptor, editorObject, {}),
 	  subscriptions_{sceneAdaptor->dispatcher()->registerOn(core::ValueHandle{editorObject, &user_types::CubeMap::wrapUMode_}, [this]() {
@@ -113,16 +117,8 @@ std::map<std::string, std::vector<unsigned char>> CubeMapAdaptor::generateMipmap
 	std::map<std::string, std::vector<unsigned char>> data;
 	auto mipmapOk = true;
 
-	for (const std::string& propName : {
-			 "uriRight",
-			 "uriLeft",
-			 "uriTop",
-			 "uriBottom",
-			 "uriFront",
-			 "uriBack",
-		 }) {
-		auto uriPropName = (level > 1) ? fmt::format("level{}{}", level, propName) : propName;
-		data[propName] = decodeMipMapData(errors, sceneAdaptor_->project(), editorObject(), uriPropName, level, decodingInfo);
+	for (const auto& propName : cubeMapUriPropertyNames) {
+		data[propName] = decodeMipMapData(errors, sceneAdaptor_->project(), editorObject(), ramses_base::mipMapUriPropertyName(propName, level), level, decodingInfo);
 
 		if (data[propName].empty()) {
 			mipmapOk = false;
@@ -136,6 +132,19 @@ std::map<std::string, std::vector<unsigned char>> CubeMapAdaptor::generateMipmap
 	return data;
 }
 
+void CubeMapAdaptor::getMipMapImages(std::vector<ramses_base::MipMapImage>& images) const {
+	if (*editorObject()->mipmapLevel_ < 1 || *editorObject()->mipmapLevel_ > 4) {
+		return;
+	}
+	for (auto level = 1; level <= *editorObject()->mipmapLevel_; ++level) {
+		for (const auto& propName : cubeMapUriPropertyNames) {
+			if (auto image = ramses_base::mipMapImage(sceneAdaptor_->project(), baseEditorObject(), ramses_base::mipMapUriPropertyName(propName, level))) {
+				images.emplace_back(*image);
+			}
+		}
+	}
+}
+
 bool CubeMapAdaptor::sync(core::Errors* errors) {
 	errors->removeError({editorObject()->shared_from_this()});
 	errors->removeError({editorObject()->shared_from_this(), &user_types::CubeMap::textureFormat_});
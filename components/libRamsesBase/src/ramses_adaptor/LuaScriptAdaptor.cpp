@@ -21,8 +21,8 @@ namespace raco::ramses_adaptor {
 LuaScriptAdaptor::LuaScriptAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<user_types::LuaScript> editorObject)
 	: UserTypeObjectAdaptor{sceneAdaptor, editorObject},
 	  nameSubscription_{sceneAdaptor_->dispatcher()->registerOn({editorObject_, &user_types::LuaScript::objectName_}, [this]() {
+		  // Name changes only rename the engine object in sync(): no need to compile the script again.
 		  tagDirty();
-		  recreateStatus_ = true;
 	  })},
 	  subscription_{sceneAdaptor_->dispatcher()->registerOnPreviewDirty(editorObject_, [this]() {
 		  setupInputValuesSubscription();
@@ -33,7 +33,6 @@ LuaScriptAdaptor::LuaScriptAdaptor(SceneAdaptor* sceneAdaptor, std::shared_ptr<u
 		  if (parent_ != editorObject_->getParent()) {
 			  setupParentSubscription();
 			  tagDirty();
-			  recreateStatus_ = true;
 		  }
 	  })),
 	  stdModuleSubscription_{sceneAdaptor_->dispatcher()->registerOnChildren({editorObject_, &user_types::LuaScript::stdModules_}, [this](auto) {
@@ -58,7 +57,6 @@ void LuaScriptAdaptor::setupParentSubscription() {
 	if (parent_ && parent_->as<user_types::PrefabInstance>()) {
 		parentNameSubscription_ = sceneAdaptor_->dispatcher()->registerOn({parent_, &user_types::LuaScript::objectName_}, [this]() {
 			tagDirty();
-			recreateStatus_ = true;
 		});
 	} else {
 		parentNameSubscription_ = components::Subscription{};
@@ -108,6 +106,11 @@ bool LuaScriptAdaptor::sync(core::Errors* errors) {
 			}
 			luaScript_ = ramses_base::ramsesLuaScript(&sceneAdaptor_->logicEngine(), scriptContent, luaConfig, modules, generateRamsesObjectName(), editorObject_->objectIDAsRamsesLogicID());
 		}
+	} else if (luaScript_) {
+		auto ramsesObjectName = generateRamsesObjectName();
+		if (luaScript_->getName() != ramsesObjectName) {
+			luaScript_->setName(ramsesObjectName);
+		}
 	}
 
 	if (luaScript_) {
@@ -64,11 +64,7 @@ bool MaterialAdaptor::isValid() {
 }
 
 bool MaterialAdaptor::sync(core::Errors* errors) {
-	errors->removeIf([this](core::ErrorItem const& error) {
-		auto handle = error.valueHandle();
-		auto uniformsHandle = core::ValueHandle(editorObject(), &user_types::Material::uniforms_);
-		return uniformsHandle.contains(handle);
-	});
+	errors->removeContained(core::ValueHandle(editorObject(), &user_types::Material::uniforms_));
 
 	TypedObjectAdaptor::sync(errors);
 
@@ -31,11 +31,12 @@ MeshAdaptor::MeshAdaptor(SceneAdaptor* sceneAdaptor, user_types::SMesh mesh)
 }
 
 ramses_base::RamsesArrayResource MeshAdaptor::indicesPtr() {
-	return indices_;
+	return resources_ ? resources_->indices : nullptr;
 }
 
 const VertexDataMap& MeshAdaptor::vertexData() const {
-	return vertexDataMap_;
+	static const VertexDataMap empty;
+	return resources_ ? resources_->vertexData : empty;
 }
 
 bool MeshAdaptor::isValid() {
@@ -43,40 +44,25 @@ bool MeshAdaptor::isValid() {
 	return mesh.get() != nullptr;
 }
 
+MeshAdaptor::~MeshAdaptor() {
+	sceneAdaptor_->releaseMeshResources(editorObject_);
+}
+
 bool MeshAdaptor::sync(core::Errors* errors) {
 	ObjectAdaptor::sync(errors);
+	// Release the old resources first: if we are the only user they will be recreated using the current object name.
+	sceneAdaptor_->releaseMeshResources(editorObject_);
+	resources_.reset();
 	if (isValid()) {
-		auto mesh = editorObject_->meshData();
-		auto indices = mesh->getIndices();
-		indices_ = ramsesArrayResource(sceneAdaptor_->scene(), indices, std::string(this->editorObject_->objectName() + "_MeshIndexData").c_str());
-
-		for (uint32_t i{0}; i < mesh->numAttributes(); i++) {
-			auto name = mesh->attribName(i);
-			std::string attribName = this->editorObject_->objectName() + "_MeshVertexData_" + name;
-			vertexDataMap_[name] = arrayResourceFromAttribute(sceneAdaptor_->scene(), mesh, i, attribName); 
-		}
-	} else {
-		vertexDataMap_.clear();
-		indices_.reset();
+		resources_ = sceneAdaptor_->acquireMeshResources(editorObject_->meshData(), editorObject_);
 	}
 	tagDirty(false);
 	return true;
 }
 
 std::vector<ExportInformation> MeshAdaptor::getExportInformation() const {
-	if (indices_ == nullptr) {
-		return {};
-	}
-
-	auto result = std::vector<ExportInformation>();
-
-	result.emplace_back(indices_.get()->getType(), indices_->getName());
-
-	for (const auto& item : vertexDataMap_)	{
-		result.emplace_back(ramses::ERamsesObjectType::ArrayResource, item.second->getName());
-	}
-
-	return result;
+	// The array resources may be shared with other meshes and are reported by the pool, see SceneAdaptor::meshResourcesExportInformation.
+	return {};
 }
 
 };	// namespace raco::ramses_adaptor
@@ -115,11 +115,7 @@ const ramses_base::RamsesAppearanceBinding& MeshNodeAdaptor::appearanceBinding()
 
 
 bool MeshNodeAdaptor::sync(core::Errors* errors) {
-	errors->removeIf([this](core::ErrorItem const& error) {
-		auto handle = error.valueHandle();
-		auto materialsHandle = core::ValueHandle(editorObject(), &user_types::MeshNode::materials_);
-		return materialsHandle.contains(handle);
-	});
+	errors->removeContained(core::ValueHandle(editorObject(), &user_types::MeshNode::materials_));
 
 	SpatialAdaptor::sync(errors);
 	if (*editorObject()->instanceCount_ >= 1) {
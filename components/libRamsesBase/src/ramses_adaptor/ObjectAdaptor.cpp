@@ -26,6 +26,9 @@ bool ObjectAdaptor::isDirty() const {
 }
 
 void ObjectAdaptor::tagDirty(bool newStatus) {
+	if (newStatus) {
+		sceneAdaptor_->markAdaptorDirty(baseEditorObject());
+	}
 	dirtyStatus_ = newStatus;
 }
 
@@ -27,17 +27,22 @@
 #include "ramses_base/RamsesHandles.h"
 #include "user_types/Animation.h"
 #include "user_types/BlitPass.h"
+#include "user_types/CubeMap.h"
 #include "user_types/MeshNode.h"
 #include "user_types/Prefab.h"
 #include "core/ProjectSettings.h"
 #include "user_types/RenderPass.h"
+#include "user_types/Texture.h"
 
 #include <spdlog/fmt/fmt.h>
 
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <unordered_set>
+#include <utility>
 
 namespace raco::ramses_adaptor {
 
@@ -48,7 +53,7 @@ SceneAdaptor::SceneAdaptor(ramses::RamsesClient* client, ramses::sceneId_t id, P
 	  project_(project),
 	  scene_{ramsesScene(id, client_)},
 	  logicEngine_{ramses_base::BaseEngineBackend::UniqueLogicEngine(scene_->createLogicEngine("LogicEngine_" + project->projectName()), [this](ramses::LogicEngine* logicEngine) { scene_->destroy(*logicEngine); })},
-	  subscription_{dispatcher->registerOnObjectsLifeCycle([this](SEditorObject obj) { createAdaptor(obj); }, [this](SEditorObject obj) { removeAdaptor(obj); })},
+	  subscription_{dispatcher->registerOnObjectsLifeCycle([this](SEditorObject obj) { createAdaptor(obj); }, [this](SEditorObject obj) { onObjectDeleted(obj); })},
 	  childrenSubscription_(dispatcher->registerOnPropertyChange("children", [this](core::ValueHandle handle) {
 		  adaptorStatusDirty_ = true;
 	  })),
@@ -103,6 +108,9 @@ void SceneAdaptor::createAdaptor(SEditorObject obj) {
 		auto adaptor = Factories::createAdaptor(this, obj);
 		if (adaptor) {
 			adaptor->tagDirty();
+			if (auto outputProvider = dynamic_cast<ILogicOutputProvider*>(adaptor.get())) {
+				logicOutputProviders_[obj] = outputProvider;
+			}
 			adaptors_[obj] = std::move(adaptor);
 		}
 	}
@@ -110,12 +118,18 @@ void SceneAdaptor::createAdaptor(SEditorObject obj) {
 
 void SceneAdaptor::removeAdaptor(SEditorObject obj) {
 	auto adaptorWasLogicProvider = dynamic_cast<ILogicPropertyProvider*>(lookupAdaptor(obj)) != nullptr;
+	logicOutputProviders_.erase(obj);
 	adaptors_.erase(obj);
+	dirtyObjects_.erase(obj);
 	deleteUnusedDefaultResources();
 	if (adaptorWasLogicProvider && lastErrorObject_ == obj) {
 		clearRuntimeError();
 	}
-	dependencyGraph_.clear();
+}
+
+void SceneAdaptor::onObjectDeleted(SEditorObject obj) {
+	removeAdaptor(obj);
+	deletedObjects_.insert(obj);
 }
 
 void SceneAdaptor::iterateAdaptors(std::function<void(ObjectAdaptor*)> func) {
@@ -162,9 +176,9 @@ void SceneAdaptor::updateRuntimeError(const ramses::Issue& issue) {
 
 	// keep the old runtime error info message if it is identical to the new message to prevent unnecessary error regeneration in the UI
 	auto ramsesLogicErrorFoundMsg = fmt::format("Ramses logic engine detected a runtime error in '{}'.\nBe aware that some Lua script outputs and/or linked properties might not have been updated.", runtimeErrorObjectName);
-	errors_->removeIf([this, &ramsesLogicErrorFoundMsg, &logicProvidersWithoutRuntimeError](const core::ErrorItem& errorItem) {
+	errors_->removeIf(core::ErrorCategory::RAMSES_LOGIC_RUNTIME, [this, &ramsesLogicErrorFoundMsg, &logicProvidersWithoutRuntimeError](const core::ErrorItem& errorItem) {
 		if (auto logicProvider = dynamic_cast<ILogicPropertyProvider*>(lookupAdaptor(errorItem.valueHandle().rootObject()))) {
-			return logicProvidersWithoutRuntimeError.count(logicProvider) == 1 && errorItem.category() == core::ErrorCategory::RAMSES_LOGIC_RUNTIME && errorItem.message() != ramsesLogicErrorFoundMsg;
+			return logicProvidersWithoutRuntimeError.count(logicProvider) == 1 && errorItem.message() != ramsesLogicErrorFoundMsg;
 		}
 		return false;
 	});
@@ -176,9 +190,7 @@ void SceneAdaptor::updateRuntimeError(const ramses::Issue& issue) {
 
 void SceneAdaptor::clearRuntimeError() {
 	lastErrorObject_ = nullptr;
-	errors_->removeIf([](const core::ErrorItem& errorItem) {
-		return errorItem.category() == core::ErrorCategory::RAMSES_LOGIC_RUNTIME;
-	});
+	errors_->removeAll(core::ErrorCategory::RAMSES_LOGIC_RUNTIME);
 }
 
 void SceneAdaptor::deleteUnusedDefaultResources() {
@@ -230,16 +242,8 @@ void SceneAdaptor::readDataFromEngine(core::DataChangeRecorder& recorder) {
 			}
 		}
 	}
-	for (const auto& [editorObject, adaptor] : adaptors_) {
-		if (editorObject->isType<user_types::LuaScript>()) {
-			static_cast<LuaScriptAdaptor*>(adaptor.get())->readDataFromEngine(recorder);
-		} else if (editorObject->isType<user_types::Animation>()) {
-			static_cast<AnimationAdaptor*>(adaptor.get())->readDataFromEngine(recorder);
-		} else if (editorObject->isType<user_types::Timer>()) {
-			static_cast<TimerAdaptor*>(adaptor.get())->readDataFromEngine(recorder);
-		} else if (editorObject->isType<user_types::AnchorPoint>()) {
-			static_cast<AnchorPointAdaptor*>(adaptor.get())->readDataFromEngine(recorder);
-		}
+	for (const auto& [editorObject, outputProvider] : logicOutputProviders_) {
+		outputProvider->readDataFromEngine(recorder);
 	}
 }
 
@@ -311,6 +315,68 @@ const RamsesArrayResource SceneAdaptor::defaultIndices(int index) {
 	return defaultIndices_[index];
 }
 
+namespace {
+void nameMeshResources(const MeshResources& resources, const std::string& namePrefix) {
+	resources.indices->setName(namePrefix + "_MeshIndexData");
+	for (const auto& [name, vertexData] : resources.vertexData) {
+		vertexData->setName(namePrefix + "_MeshVertexData_" + name);
+	}
+}
+}  // namespace
+
+SharedMeshResources SceneAdaptor::acquireMeshResources(const core::SharedMeshData& meshData, const SEditorObject& mesh) {
+	releaseMeshResources(mesh);
+	meshResourcesUsers_[mesh] = meshData.get();
+
+	auto it = meshResources_.find(meshData.get());
+	if (it != meshResources_.end()) {
+		it->second.users.emplace_back(mesh);
+		return it->second.resources;
+	}
+
+	const auto& namePrefix = mesh->objectName();
+	auto resources = std::make_shared<MeshResources>();
+	resources->meshData = meshData;
+	resources->indices = ramsesArrayResource(scene_.get(), meshData->getIndices(), namePrefix + "_MeshIndexData");
+	for (uint32_t i{0}; i < meshData->numAttributes(); i++) {
+		auto name = meshData->attribName(i);
+		resources->vertexData[name] = arrayResourceFromAttribute(scene_.get(), meshData, i, namePrefix + "_MeshVertexData_" + name);
+	}
+	meshResources_[meshData.get()] = {resources, {mesh}};
+	return resources;
+}
+
+void SceneAdaptor::releaseMeshResources(const SEditorObject& mesh) {
+	auto userIt = meshResourcesUsers_.find(mesh);
+	if (userIt == meshResourcesUsers_.end()) {
+		return;
+	}
+	auto it = meshResources_.find(userIt->second);
+	meshResourcesUsers_.erase(userIt);
+
+	auto& users = it->second.users;
+	bool wasNamedAfterMesh = users.front() == mesh;
+	users.erase(std::find(users.begin(), users.end(), mesh));
+	if (users.empty()) {
+		meshResources_.erase(it);
+	} else if (wasNamedAfterMesh) {
+		nameMeshResources(*it->second.resources, users.front()->objectName());
+	}
+}
+
+std::vector<ExportInformation> SceneAdaptor::meshResourcesExportInformation(const SEditorObject& mesh) const {
+	std::vector<ExportInformation> result;
+	auto userIt = meshResourcesUsers_.find(mesh);
+	if (userIt != meshResourcesUsers_.end()) {
+		const auto& resources = meshResources_.at(userIt->second).resources;
+		result.emplace_back(resources->indices->getType(), resources->indices->getName());
+		for (const auto& item : resources->vertexData) {
+			result.emplace_back(ramses::ERamsesObjectType::ArrayResource, item.second->getName());
+		}
+	}
+	return result;
+}
+
 const ramses_base::RamsesTextureSampler SceneAdaptor::defaultTextureSampler() {
 	if (!defaultTextureSampler_) {
 		defaultTextureSampler_ = createDefaultTextureSampler(scene_.get());
@@ -326,7 +392,7 @@ const ramses_base::RamsesTextureSampler SceneAdaptor::defaultTextureCubeSampler(
 }
 
 const std::vector<DependencyNode>& SceneAdaptor::dependencyGraph() {
-	return dependencyGraph_;
+	return dependencyGraph_.nodes();
 }
 
 ObjectAdaptor* SceneAdaptor::lookupAdaptor(const core::SEditorObject& editorObject) const {
@@ -340,12 +406,88 @@ ObjectAdaptor* SceneAdaptor::lookupAdaptor(const core::SEditorObject& editorObje
 	return nullptr;
 }
 
+void SceneAdaptor::markAdaptorDirty(const SEditorObject& object) {
+	dirtyObjects_.insert(object);
+}
+
 core::Project& SceneAdaptor::project() const {
 	return *project_;
 }
 
-void SceneAdaptor::rebuildSortedDependencyGraph(SEditorObjectSet const& objects) {
-	dependencyGraph_ = buildSortedDependencyGraph(objects);
+void SceneAdaptor::updateSortedDependencyGraph(SEditorObjectSet const& changedObjects) {
+	auto isRenderPass = [](const SEditorObject& obj) {
+		return obj->isType<user_types::RenderPass>() || obj->isType<user_types::BlitPass>();
+	};
+
+	if (dependencyGraph_.empty()) {
+		const auto& instances{project_->instances()};
+		dependencyGraph_.rebuild(SEditorObjectSet(instances.begin(), instances.end()));
+		renderPasses_.clear();
+		std::copy_if(instances.begin(), instances.end(), std::inserter(renderPasses_, renderPasses_.end()), isRenderPass);
+		renderOrderDirty_ = true;
+	} else {
+		SEditorObjectSet graphChanges;
+		for (const auto& obj : changedObjects) {
+			// Only project instances are part of the graph; the change set may contain objects that are not (or no longer) in the project.
+			if (deletedObjects_.find(obj) == deletedObjects_.end() && project_->isInstance(obj)) {
+				graphChanges.insert(obj);
+				if (isRenderPass(obj)) {
+					renderPasses_.insert(obj);
+					renderOrderDirty_ = true;
+				}
+			}
+		}
+		for (const auto& obj : deletedObjects_) {
+			if (renderPasses_.erase(obj) > 0) {
+				renderOrderDirty_ = true;
+			}
+		}
+		dependencyGraph_.update(graphChanges, deletedObjects_);
+	}
+	deletedObjects_.clear();
+}
+
+void SceneAdaptor::updateRenderOrderErrors() {
+	// Check if all render passes have a unique order index, otherwise Ramses renders them in arbitrary order.
+	std::set<ValueHandle> oldErrors;
+	for (const auto& handle : errors_->getPropertyErrorHandles("renderOrder")) {
+		if (handle.isRefToProp(&user_types::RenderPass::renderOrder_) || handle.isRefToProp(&user_types::BlitPass::renderOrder_)) {
+			oldErrors.insert(handle);
+		}
+	}
+
+	std::vector<core::ErrorItem> newErrors;
+	std::map<int, std::vector<core::SEditorObject>> orderIndices;
+	for (auto const& obj : renderPasses_) {
+		int order = obj->get("renderOrder")->asInt();
+		orderIndices[order].emplace_back(obj);
+	}
+	for (auto const& oi : orderIndices) {
+		if (oi.second.size() > 1) {
+			auto errorMsg = fmt::format("The render/blit passes {} have the same order index and will be rendered in arbitrary order.", oi.second);
+			for (auto const& obj : oi.second) {
+				newErrors.emplace_back(core::ErrorCategory::GENERAL, core::ErrorLevel::WARNING, ValueHandle{obj, {"renderOrder"}}, errorMsg);
+			}
+		}
+	}
+	errors_->replaceErrors(oldErrors, newErrors);
+	renderOrderDirty_ = false;
+}
+
+void SceneAdaptor::prefetchTextureData(const core::SEditorObjectSet& changedObjects) {
+	std::vector<ramses_base::MipMapImage> images;
+	size_t textureCount = 0;
+	for (const auto& object : changedObjects) {
+		auto adaptor = lookupAdaptor(object);
+		if (auto imageProvider = dynamic_cast<IMipMapImageProvider*>(adaptor); imageProvider && adaptor->isDirty()) {
+			imageProvider->getMipMapImages(images);
+			++textureCount;
+		}
+	}
+	// Decoding a single texture in the sync itself is just as fast.
+	if (textureCount > 1) {
+		ramses_base::prefetchMipMapData(images);
+	}
 }
 
 void SceneAdaptor::performBulkEngineUpdate(const core::SEditorObjectSet& changedObjects) {
@@ -371,33 +513,43 @@ void SceneAdaptor::performBulkEngineUpdate(const core::SEditorObjectSet& changed
 		adaptorStatusDirty_ = false;
 	}
 
-	if (dependencyGraph_.empty() || !changedObjects.empty()) {
-		rebuildSortedDependencyGraph(SEditorObjectSet(project_->instances().begin(), project_->instances().end()));
-		// Check if all render passes have a unique order index, otherwise Ramses renders them in arbitrary order.
-		errors_->removeIf([](core::ErrorItem const& error) {
-			return error.valueHandle().isRefToProp(&user_types::RenderPass::renderOrder_) || error.valueHandle().isRefToProp(&user_types::BlitPass::renderOrder_);
-		});
+	if (dependencyGraph_.empty() || !changedObjects.empty() || !deletedObjects_.empty()) {
+		updateSortedDependencyGraph(changedObjects);
+	}
+	if (renderOrderDirty_) {
+		updateRenderOrderErrors();
+	}
 
-		std::map<int, std::vector<core::SEditorObject>> orderIndices;
-		for (auto const& obj : project_->instances()) {
-			if (obj->isType<user_types::RenderPass>() || obj->isType<user_types::BlitPass>()) {
-				int order = obj->get("renderOrder")->asInt();
-				orderIndices[order].emplace_back(obj);
-			}
-		}
-		for (auto const& oi : orderIndices) {
-			if (oi.second.size() > 1) {				
-				auto errorMsg = fmt::format("The render/blit passes {} have the same order index and will be rendered in arbitrary order.", oi.second);
-				for (auto const& obj : oi.second) {
-					errors_->addError(core::ErrorCategory::GENERAL, core::ErrorLevel::WARNING, ValueHandle{obj, {"renderOrder"}}, errorMsg);
+	prefetchTextureData(changedObjects);
+
+	std::set<LinkAdaptor*> liftedLinks;
+
+	// Only the dirty adaptors and the adaptors referencing objects updated by the sync need to be synced:
+	// visit them in dependency order instead of traversing the whole graph.
+	std::set<size_t> pending;
+	SEditorObjectSet deferred;
+	auto scheduleDirtyObjects = [this, &pending, &deferred](std::optional<size_t> currentIndex) {
+		for (const auto& object : std::exchange(dirtyObjects_, {})) {
+			if (auto index = dependencyGraph_.nodeIndex(object)) {
+				// Adaptors tagged dirty by the sync of an adaptor coming later in the graph are synced in the next update.
+				if (currentIndex && *index <= *currentIndex) {
+					deferred.insert(object);
+				} else {
+					pending.insert(*index);
 				}
+			} else if (lookupAdaptor(object)) {
+				// Not part of the graph yet: keep the adaptor dirty until it is.
+				deferred.insert(object);
 			}
 		}
-	}
-	std::set<LinkAdaptor*> liftedLinks;
+	};
+	scheduleDirtyObjects(std::nullopt);
 
 	SEditorObjectSet updated;
-	for (const auto& item : dependencyGraph_) {
+	while (!pending.empty()) {
+		auto nodeIndex = *pending.begin();
+		pending.erase(pending.begin());
+		const auto& item = dependencyGraph_.nodes()[nodeIndex];
 		auto object = item.object;
 		if (auto adaptor = lookupAdaptor(object)) {
 			bool needsUpdate = adaptor->isDirty();
@@ -430,10 +582,18 @@ void SceneAdaptor::performBulkEngineUpdate(const core::SEditorObjectSet& changed
 				auto hasChanged = adaptor->sync(errors_);
 				if (hasChanged) {
 					updated.insert(object);
+					for (const auto& referencing : dependencyGraph_.referencingObjects(object)) {
+						pending.insert(*dependencyGraph_.nodeIndex(referencing));
+					}
+				}
+				if (adaptor->isDirty()) {
+					deferred.insert(object);
 				}
 			}
 		}
+		scheduleDirtyObjects(nodeIndex);
 	}
+	dirtyObjects_.insert(deferred.begin(), deferred.end());
 
 	for (const auto& link : liftedLinks) {
 		link->connect();
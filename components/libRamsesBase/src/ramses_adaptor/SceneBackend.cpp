@@ -290,6 +290,9 @@ std::string SceneBackend::getExportedObjectNames(SEditorObject editorObject) con
 	}
 
 	auto exportInfo = adaptor->getExportInformation();
+	for (const auto& item : sceneAdaptor()->meshResourcesExportInformation(editorObject)) {
+		exportInfo.push_back(item);
+	}
 	if (exportInfo.empty()){
 		return "Will not be exported.";
 	}
@@ -132,10 +132,8 @@ RamsesTexture2D TextureSamplerAdaptor::createTexture(core::Errors* errors, PngDe
 	auto mipMapsOk = true;
 
 	for (auto level = 1; level <= *editorObject()->mipmapLevel_; ++level) {
-		auto uriPropName = (level > 1) ? fmt::format("level{}{}", level, "uri") : "uri";
-
 		// Raw data is requested in swizzled texture format.
-		auto levelMipData = decodeMipMapData(errors, sceneAdaptor_->project(), editorObject(), uriPropName, level, decodingInfo, true);
+		auto levelMipData = decodeMipMapData(errors, sceneAdaptor_->project(), editorObject(), mipMapUriPropertyName("uri", level), level, decodingInfo, true);
 		if (levelMipData.empty()) {
 			mipMapsOk = false;
 		}
@@ -166,6 +164,17 @@ RamsesTexture2D TextureSamplerAdaptor::createTexture(core::Errors* errors, PngDe
 	return ramsesTexture2D(sceneAdaptor_->scene(), swizzleTextureFormat, decodingInfo.width, decodingInfo.height, mipDatas, *editorObject()->generateMipmaps_, swizzle, {}, editorObject()->objectIDAsRamsesLogicID());
 }
 
+void TextureSamplerAdaptor::getMipMapImages(std::vector<ramses_base::MipMapImage>& images) const {
+	if (*editorObject()->mipmapLevel_ < 1 || *editorObject()->mipmapLevel_ > 4) {
+		return;
+	}
+	for (auto level = 1; level <= *editorObject()->mipmapLevel_; ++level) {
+		if (auto image = mipMapImage(sceneAdaptor_->project(), baseEditorObject(), mipMapUriPropertyName("uri", level), true)) {
+			images.emplace_back(*image);
+		}
+	}
+}
+
 std::string TextureSamplerAdaptor::createDefaultTextureDataName() {
 	return this->editorObject()->objectName() + "_Texture2D";
 }
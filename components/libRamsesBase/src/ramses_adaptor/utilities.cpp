@@ -17,6 +17,9 @@
 
 #include "core/MeshCacheInterface.h"
 
+#include <algorithm>
+#include <functional>
+
 namespace raco::ramses_adaptor {
 
 ramses_base::RamsesNodeBinding lookupNodeBinding(const SceneAdaptor* sceneAdaptor, core::SEditorObject node) {
@@ -74,6 +77,202 @@ std::vector<DependencyNode> buildSortedDependencyGraph(core::SEditorObjectSet co
 	return graph;
 }
 
+namespace {
+
+template <typename Predicate>
+void collectReferencedObjects(data_storage::ReflectionInterface* object, const Predicate& include, core::SEditorObjectSet& outReferenced) {
+	for (size_t index = 0; index < object->size(); index++) {
+		auto v = (*object)[index];
+		if (v->type() == data_storage::PrimitiveType::Ref) {
+			auto refValue = v->asRef();
+			if (refValue && include(refValue)) {
+				outReferenced.insert(refValue);
+			}
+		} else if (data_storage::hasTypeSubstructure(v->type())) {
+			collectReferencedObjects(&v->getSubstructure(), include, outReferenced);
+		}
+	}
+}
+
+}  // namespace
+
+void SortedDependencyGraph::rebuild(core::SEditorObjectSet const& objects) {
+	nodes_ = buildSortedDependencyGraph(objects);
+	index_.clear();
+	referencingObjects_.clear();
+	reindex(0, nodes_.size());
+	for (const auto& node : nodes_) {
+		for (const auto& refTarget : node.referencedObjects) {
+			referencingObjects_[refTarget].insert(node.object);
+		}
+	}
+}
+
+void SortedDependencyGraph::clear() {
+	nodes_.clear();
+	index_.clear();
+	referencingObjects_.clear();
+}
+
+bool SortedDependencyGraph::empty() const {
+	return nodes_.empty();
+}
+
+bool SortedDependencyGraph::contains(core::SEditorObject const& object) const {
+	return index_.find(object) != index_.end();
+}
+
+std::optional<size_t> SortedDependencyGraph::nodeIndex(core::SEditorObject const& object) const {
+	auto it = index_.find(object);
+	if (it == index_.end()) {
+		return std::nullopt;
+	}
+	return it->second;
+}
+
+const core::SEditorObjectSet& SortedDependencyGraph::referencingObjects(core::SEditorObject const& object) const {
+	static const core::SEditorObjectSet noObjects;
+	auto it = referencingObjects_.find(object);
+	return it != referencingObjects_.end() ? it->second : noObjects;
+}
+
+const std::vector<DependencyNode>& SortedDependencyGraph::nodes() const {
+	return nodes_;
+}
+
+void SortedDependencyGraph::update(core::SEditorObjectSet const& changedObjects, core::SEditorObjectSet const& deletedObjects) {
+	removeNodes(deletedObjects);
+
+	std::vector<size_t> changedIndices;
+	changedIndices.reserve(changedObjects.size());
+	for (const auto& object : changedObjects) {
+		if (deletedObjects.find(object) != deletedObjects.end()) {
+			continue;
+		}
+		auto it = index_.find(object);
+		if (it == index_.end()) {
+			// New objects are appended at the end; references between new objects are fixed below.
+			index_[object] = nodes_.size();
+			changedIndices.emplace_back(nodes_.size());
+			nodes_.emplace_back(DependencyNode{object, {}});
+		} else {
+			changedIndices.emplace_back(it->second);
+		}
+	}
+
+	// The range [lowerBound, upperBound] contains all nodes that are involved in order violations
+	size_t lowerBound = nodes_.size();
+	size_t upperBound = 0;
+	for (auto nodeIndex : changedIndices) {
+		updateReferences(nodeIndex, lowerBound, upperBound);
+	}
+	if (lowerBound < upperBound) {
+		sortRange(lowerBound, upperBound);
+	}
+}
+
+void SortedDependencyGraph::removeNodes(core::SEditorObjectSet const& deletedObjects) {
+	size_t firstRemoved = nodes_.size();
+	for (const auto& object : deletedObjects) {
+		auto it = index_.find(object);
+		if (it == index_.end()) {
+			continue;
+		}
+		firstRemoved = std::min(firstRemoved, it->second);
+
+		auto& node = nodes_[it->second];
+		for (const auto& refTarget : node.referencedObjects) {
+			auto refIt = referencingObjects_.find(refTarget);
+			if (refIt != referencingObjects_.end()) {
+				refIt->second.erase(object);
+			}
+		}
+		if (auto refIt = referencingObjects_.find(object); refIt != referencingObjects_.end()) {
+			for (const auto& referencing : refIt->second) {
+				if (auto srcIt = index_.find(referencing); srcIt != index_.end()) {
+					nodes_[srcIt->second].referencedObjects.erase(object);
+				}
+			}
+			referencingObjects_.erase(refIt);
+		}
+		index_.erase(it);
+	}
+
+	if (firstRemoved < nodes_.size()) {
+		nodes_.erase(std::remove_if(nodes_.begin() + firstRemoved, nodes_.end(), [&deletedObjects](const DependencyNode& node) {
+			return deletedObjects.find(node.object) != deletedObjects.end();
+		}),
+			nodes_.end());
+		reindex(firstRemoved, nodes_.size());
+	}
+}
+
+void SortedDependencyGraph::updateReferences(size_t nodeIndex, size_t& lowerBound, size_t& upperBound) {
+	auto& node = nodes_[nodeIndex];
+	core::SEditorObjectSet newReferenced;
+	collectReferencedObjects(node.object.get(), [this](const core::SEditorObject& refTarget) { return contains(refTarget); }, newReferenced);
+
+	if (newReferenced == node.referencedObjects) {
+		return;
+	}
+
+	for (const auto& refTarget : node.referencedObjects) {
+		if (newReferenced.find(refTarget) == newReferenced.end()) {
+			referencingObjects_[refTarget].erase(node.object);
+		}
+	}
+	for (const auto& refTarget : newReferenced) {
+		if (node.referencedObjects.find(refTarget) == node.referencedObjects.end()) {
+			referencingObjects_[refTarget].insert(node.object);
+		}
+		auto targetIndex = index_.at(refTarget);
+		if (targetIndex > nodeIndex) {
+			lowerBound = std::min(lowerBound, nodeIndex);
+			upperBound = std::max(upperBound, targetIndex);
+		}
+	}
+	node.referencedObjects = std::move(newReferenced);
+}
+
+void SortedDependencyGraph::sortRange(size_t lowerBound, size_t upperBound) {
+	// All order constraints between nodes inside and outside of the range are still satisfied if the nodes
+	// inside the range are permuted. It is therefore sufficient to topologically sort the range only.
+	core::SEditorObjectSet rangeObjects;
+	for (size_t index = lowerBound; index <= upperBound; index++) {
+		rangeObjects.insert(nodes_[index].object);
+	}
+
+	std::vector<DependencyNode> sorted;
+	sorted.reserve(upperBound - lowerBound + 1);
+	std::vector<bool> visited(upperBound - lowerBound + 1, false);
+
+	std::function<void(size_t)> visit = [this, lowerBound, &rangeObjects, &sorted, &visited, &visit](size_t index) {
+		if (visited[index - lowerBound]) {
+			return;
+		}
+		visited[index - lowerBound] = true;
+		for (const auto& refTarget : nodes_[index].referencedObjects) {
+			if (rangeObjects.find(refTarget) != rangeObjects.end()) {
+				visit(index_.at(refTarget));
+			}
+		}
+		sorted.emplace_back(std::move(nodes_[index]));
+	};
+
+	for (size_t index = lowerBound; index <= upperBound; index++) {
+		visit(index);
+	}
+
+	std::move(sorted.begin(), sorted.end(), nodes_.begin() + lowerBound);
+	reindex(lowerBound, upperBound + 1);
+}
+
+void SortedDependencyGraph::reindex(size_t startIndex, size_t endIndex) {
+	for (size_t index = startIndex; index < endIndex; index++) {
+		index_[nodes_[index].object] = index;
+	}
+}
+
 ramses_base::RamsesArrayResource arrayResourceFromAttribute(ramses::Scene* scene, core::SharedMeshData mesh, int attribIndex, std::string_view name) {
 	auto buffer = mesh->attribBuffer(attribIndex);
 	auto elementCount = mesh->attribElementCount(attribIndex);
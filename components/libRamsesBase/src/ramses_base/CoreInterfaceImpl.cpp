@@ -16,7 +16,9 @@
 #include "log_system/log.h"
 
 #include "ramses_base/BaseEngineBackend.h"
+#include "ramses_base/LuaScriptInterfaceCache.h"
 #include "ramses_base/RamsesHandles.h"
+#include "ramses_base/ShaderReflectionCache.h"
 #include "ramses_base/Utils.h"
 
 #include "user_types/Enumerations.h"
@@ -66,7 +68,15 @@ ramses::LogicEngine* CoreInterfaceImpl::logicEngine() {
 }
 
 bool CoreInterfaceImpl::parseShader(const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines, core::PropertyInterfaceList& outUniforms, core::PropertyInterfaceList& outAttributes, std::string& outError) {
-	return ramses_base::parseShaderText(backend_->internalScene(), vertexShader, geometryShader, fragmentShader, shaderDefines, outUniforms, outAttributes, outError);
+	auto reflection = ShaderReflectionCache::instance().get(backend_->featureLevel(), vertexShader, geometryShader, fragmentShader, shaderDefines, [this, &vertexShader, &geometryShader, &fragmentShader, &shaderDefines]() {
+		ShaderReflection result;
+		result.success = ramses_base::parseShaderText(backend_->internalScene(), vertexShader, geometryShader, fragmentShader, shaderDefines, result.uniforms, result.attributes, result.error);
+		return result;
+	});
+	outUniforms = reflection->uniforms;
+	outAttributes = reflection->attributes;
+	outError = reflection->error;
+	return reflection->success;
 }
 
 std::tuple<ramses::LuaConfig, bool> CoreInterfaceImpl::createFullLuaConfig(const std::vector<std::string>& stdModules, const data_storage::Table& modules) {
@@ -94,29 +104,49 @@ std::tuple<ramses::LuaConfig, bool> CoreInterfaceImpl::createFullLuaConfig(const
 	return {luaConfig, true};
 }
 
+LuaScriptInterfaceCache::Key CoreInterfaceImpl::luaInterfaceCacheKey(bool isInterface, const std::string& text, const std::vector<std::string>& stdModules, const data_storage::Table& modules) const {
+	LuaScriptInterfaceCache::Key key{backend_->featureLevel(), isInterface, text, stdModules, {}};
+	key.modules.reserve(modules.size());
+	for (auto i = 0; i < modules.size(); ++i) {
+		// createFullLuaConfig already made sure that all module references are valid
+		const auto module = modules.get(i)->asRef()->as<user_types::LuaScriptModule>();
+		key.modules.emplace_back(LuaScriptInterfaceCache::ModuleDependency{modules.name(i), module->currentScriptContents(), module->stdModules_->activeModules()});
+	}
+	return key;
+}
+
 bool CoreInterfaceImpl::parseLuaScript(const std::string& luaScript, const std::string& scriptName, const std::vector<std::string>& stdModules, const data_storage::Table& modules, core::PropertyInterfaceList& outInputs, core::PropertyInterfaceList& outOutputs, std::string& outError) {
 	auto [luaConfig, valid] = createFullLuaConfig(stdModules, modules);
 	if (!valid) {
 		return false;
 	}
 
-	const auto script = logicEngine()->createLuaScript(luaScript, luaConfig, scriptName);
-	if (!script) {
-		outError = logicEngine()->getScene().getRamsesClient().getRamsesFramework().getLastError().value().message;
-		return false;
-	}
+	auto scriptInterface = LuaScriptInterfaceCache::instance().get(luaInterfaceCacheKey(false, luaScript, stdModules, modules), [this, &luaScript, &luaConfig = luaConfig, &scriptName, &outError](LuaScriptInterface& outInterface) {
+		const auto script = logicEngine()->createLuaScript(luaScript, luaConfig, scriptName);
+		if (!script) {
+			outError = logicEngine()->getScene().getRamsesClient().getRamsesFramework().getLastError().value().message;
+			return false;
+		}
 
-	if (const auto inputs = script->getInputs()) {
-		fillLuaScriptInterface(outInputs, inputs);
-	}
-	if (const auto outputs = script->getOutputs()) {
-		fillLuaScriptInterface(outOutputs, outputs);
-	}
-	auto status = logicEngine()->destroy(*script);
-	if (!status) {
-		auto error = logicEngine()->getScene().getRamsesClient().getRamsesFramework().getLastError().value();
-		LOG_ERROR(log_system::RAMSES_BACKEND, "Deleting LogicEngine object failed: {}", error.message);
+		if (const auto inputs = script->getInputs()) {
+			fillLuaScriptInterface(outInterface.inputs, inputs);
+		}
+		if (const auto outputs = script->getOutputs()) {
+			fillLuaScriptInterface(outInterface.outputs, outputs);
+		}
+		auto status = logicEngine()->destroy(*script);
+		if (!status) {
+			auto error = logicEngine()->getScene().getRamsesClient().getRamsesFramework().getLastError().value();
+			LOG_ERROR(log_system::RAMSES_BACKEND, "Deleting LogicEngine object failed: {}", error.message);
+		}
+		return true;
+	});
+
+	if (!scriptInterface) {
+		return false;
 	}
+	outInputs = scriptInterface->inputs;
+	outOutputs = scriptInterface->outputs;
 	return true;
 }
 
@@ -126,22 +156,30 @@ bool CoreInterfaceImpl::parseLuaInterface(const std::string& interfaceText, cons
 		return false;
 	}
 
-	ramses::LuaInterface* interface = logicEngine()->createLuaInterface(interfaceText, "Stage::Preprocess", luaConfig);
+	auto scriptInterface = LuaScriptInterfaceCache::instance().get(luaInterfaceCacheKey(true, interfaceText, stdModules, modules), [this, &interfaceText, &luaConfig = luaConfig, &outError](LuaScriptInterface& outInterface) {
+		ramses::LuaInterface* luaInterface = logicEngine()->createLuaInterface(interfaceText, "Stage::Preprocess", luaConfig);
 
-	if (!interface) {
-		outError = logicEngine()->getScene().getRamsesClient().getRamsesFramework().getLastError().value().message;
-		return false;
-	}
+		if (!luaInterface) {
+			outError = logicEngine()->getScene().getRamsesClient().getRamsesFramework().getLastError().value().message;
+			return false;
+		}
 
-	if (auto inputs = interface->getInputs()) {
-		fillLuaScriptInterface(outInputs, inputs);
-	}
+		if (auto inputs = luaInterface->getInputs()) {
+			fillLuaScriptInterface(outInterface.inputs, inputs);
+		}
+
+		auto status = logicEngine()->destroy(*luaInterface);
+		if (!status) {
+			auto error = logicEngine()->getScene().getRamsesClient().getRamsesFramework().getLastError().value();
+			LOG_ERROR(log_system::RAMSES_BACKEND, "Deleting LogicEngine object failed: {}", error.message);
+		}
+		return true;
+	});
 
-	auto status = logicEngine()->destroy(*interface);
-	if (!status) {
-		auto error = logicEngine()->getScene().getRamsesClient().getRamsesFramework().getLastError().value();
-		LOG_ERROR(log_system::RAMSES_BACKEND, "Deleting LogicEngine object failed: {}", error.message);
+	if (!scriptInterface) {
+		return false;
 	}
+	outInputs = scriptInterface->inputs;
 	return true;
 }
 
@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "ramses_base/DecodedImageCache.h"
+
+#include "utils/FileUtils.h"
+#include "utils/u8path.h"
+
+namespace raco::ramses_base {
+
+DecodedImageCache& DecodedImageCache::instance() {
+	static DecodedImageCache cache;
+	return cache;
+}
+
+DecodedImageCache::DecodedImageCache(size_t memoryBudget) : memoryBudget_(memoryBudget) {
+}
+
+bool DecodedImageCache::readFileVersion(const std::string& absPath, FileVersion& outVersion) {
+	std::error_code error;
+	auto path = utils::u8path(absPath).internalPath();
+	outVersion.modificationTime = std::filesystem::last_write_time(path, error);
+	if (error) {
+		return false;
+	}
+	outVersion.size = std::filesystem::file_size(path, error);
+	return !error;
+}
+
+SDecodedImage DecodedImageCache::get(const std::string& absPath, ramses::ETextureFormat format, bool swizzle, const Decoder& decoder) {
+	Key key{absPath, format, swizzle};
+
+	// Read the version before the content: if the file is modified in between we will decode again next time.
+	FileVersion version;
+	bool versionValid = readFileVersion(absPath, version);
+
+	{
+		std::lock_guard lock(mutex_);
+		if (versionValid) {
+			auto it = index_.find(key);
+			if (it != index_.end()) {
+				if (it->second->version == version) {
+					++hits_;
+					entries_.splice(entries_.begin(), entries_, it->second);
+					return entries_.front().image;
+				}
+				erase(it->second);
+			}
+		}
+		++misses_;
+	}
+
+	auto image = std::make_shared<const DecodedImage>(decoder(utils::file::readBinary(absPath)));
+
+	if (versionValid && image->error == 0 && image->memorySize() <= memoryBudget()) {
+		std::lock_guard lock(mutex_);
+		// Another thread may have decoded the same image in the meantime.
+		if (auto it = index_.find(key); it != index_.end()) {
+			erase(it->second);
+		}
+		entries_.emplace_front(Entry{key, version, image});
+		index_[key] = entries_.begin();
+		memoryUsage_ += image->memorySize();
+		evict();
+	}
+
+	return image;
+}
+
+void DecodedImageCache::clear() {
+	std::lock_guard lock(mutex_);
+	entries_.clear();
+	index_.clear();
+	memoryUsage_ = 0;
+}
+
+void DecodedImageCache::setMemoryBudget(size_t memoryBudget) {
+	std::lock_guard lock(mutex_);
+	memoryBudget_ = memoryBudget;
+	evict();
+}
+
+size_t DecodedImageCache::memoryBudget() const {
+	std::lock_guard lock(mutex_);
+	return memoryBudget_;
+}
+
+size_t DecodedImageCache::memoryUsage() const {
+	std::lock_guard lock(mutex_);
+	return memoryUsage_;
+}
+
+size_t DecodedImageCache::size() const {
+	std::lock_guard lock(mutex_);
+	return entries_.size();
+}
+
+DecodedImageCache::Statistics DecodedImageCache::statistics() const {
+	std::lock_guard lock(mutex_);
+	return {hits_, misses_, entries_.size()};
+}
+
+void DecodedImageCache::resetStatistics() {
+	std::lock_guard lock(mutex_);
+	hits_ = 0;
+	misses_ = 0;
+}
+
+void DecodedImageCache::erase(std::list<Entry>::iterator it) {
+	memoryUsage_ -= it->image->memorySize();
+	index_.erase(it->key);
+	entries_.erase(it);
+}
+
+void DecodedImageCache::evict() {
+	while (memoryUsage_ > memoryBudget_ && !entries_.empty()) {
+		erase(std::prev(entries_.end()));
+	}
+}
+
+}  // namespace raco::ramses_base
@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "ramses_base/LuaScriptInterfaceCache.h"
+
+namespace raco::ramses_base {
+
+size_t LuaScriptInterfaceKeyHash::operator()(const LuaScriptInterfaceKey& key) const {
+	std::hash<std::string> stringHash;
+	size_t seed = std::hash<int>()(static_cast<int>(key.featureLevel));
+	hashCombine(seed, key.isInterface ? 1 : 0);
+	hashCombine(seed, stringHash(key.text));
+	hashCombine(seed, key.stdModules);
+	for (const auto& module : key.modules) {
+		hashCombine(seed, stringHash(module.name));
+		hashCombine(seed, stringHash(module.text));
+		hashCombine(seed, module.stdModules);
+	}
+	return seed;
+}
+
+LuaScriptInterfaceCache& LuaScriptInterfaceCache::instance() {
+	static LuaScriptInterfaceCache cache;
+	return cache;
+}
+
+LuaScriptInterfaceCache::LuaScriptInterfaceCache(size_t maxEntries) : LruCache(maxEntries) {
+}
+
+SLuaScriptInterface LuaScriptInterfaceCache::get(const Key& key, const Parser& parser) {
+	return getOrCreate(key, [&parser]() -> SLuaScriptInterface {
+		LuaScriptInterface parsed;
+		if (!parser(parsed)) {
+			return nullptr;
+		}
+		return std::make_shared<const LuaScriptInterface>(std::move(parsed));
+	});
+}
+
+}  // namespace raco::ramses_base
@@ -0,0 +1,38 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "ramses_base/ShaderReflectionCache.h"
+
+namespace raco::ramses_base {
+
+size_t ShaderProgramKeyHash::operator()(const ShaderProgramKey& key) const {
+	std::hash<std::string> stringHash;
+	size_t seed = std::hash<int>()(static_cast<int>(key.featureLevel));
+	hashCombine(seed, stringHash(key.vertexShader));
+	hashCombine(seed, stringHash(key.geometryShader));
+	hashCombine(seed, stringHash(key.fragmentShader));
+	hashCombine(seed, stringHash(key.shaderDefines));
+	return seed;
+}
+
+ShaderReflectionCache& ShaderReflectionCache::instance() {
+	static ShaderReflectionCache cache;
+	return cache;
+}
+
+ShaderReflectionCache::ShaderReflectionCache(size_t maxEntries) : LruCache(maxEntries) {
+}
+
+SShaderReflection ShaderReflectionCache::get(ramses::EFeatureLevel featureLevel, const std::string& vertexShader, const std::string& geometryShader, const std::string& fragmentShader, const std::string& shaderDefines, const Parser& parser) {
+	return getOrCreate(ShaderProgramKey{featureLevel, vertexShader, geometryShader, fragmentShader, shaderDefines}, [&parser]() {
+		return std::make_shared<const ShaderReflection>(parser());
+	});
+}
+
+}  // namespace raco::ramses_base
@@ -19,6 +19,7 @@
 #include "user_types/LuaScriptModule.h"
 #include "utils/FileUtils.h"
 #include "utils/MathUtils.h"
+#include "utils/ParallelUtils.h"
 #include "core/CoreFormatter.h"
 
 #include <ramses/framework/TextureEnums.h>
@@ -28,8 +29,10 @@
 #include <ramses/client/logic/LuaScript.h>
 #include <ramses/client/logic/Property.h>
 
+#include <set>
 #include <sstream>
 #include <string>
+#include <tuple>
 
 namespace {
 
@@ -591,8 +594,10 @@ PngCompatibilityInfo validateTextureColorTypeAndBitDepth(ramses::ETextureFormat
 		{{LCT_PALETTE, 8}, {ramses::ETextureFormat::R8, ramses::ETextureFormat::RG8, ramses::ETextureFormat::RGB8, ramses::ETextureFormat::RGBA8, ramses::ETextureFormat::SRGB8, ramses::ETextureFormat::SRGB8_ALPHA8}},
 	};
 
-	auto downConvertableTextureFormat = downConvertableTextureFormats[pngFormat].find(selectedTextureFormat);
-	if (downConvertableTextureFormat != downConvertableTextureFormats[pngFormat].end()) {
+	// Textures may be decoded concurrently: only use non-modifying lookups on the static tables.
+	const auto &downConvertableFormats = downConvertableTextureFormats.at(pngFormat);
+	auto downConvertableTextureFormat = downConvertableFormats.find(selectedTextureFormat);
+	if (downConvertableTextureFormat != downConvertableFormats.end()) {
 		return {fmt::format("Selected format {} is not equal to PNG color type {} - image will be converted.", ramsesTextureFormatToString(selectedTextureFormat), pngColorTypeToString(colorType)), core::ErrorLevel::INFORMATION, true};
 	}
 	return {fmt::format("Selected format {} is not equal to PNG color type {} - empty channels will be created.", ramsesTextureFormatToString(selectedTextureFormat), pngColorTypeToString(colorType)), core::ErrorLevel::WARNING, true};
@@ -646,31 +651,71 @@ std::vector<unsigned char> generateColorDataWithoutBlueChannel(const std::vector
 	return dataWithoutBlue;
 }
 
-std::vector<unsigned char> decodeMipMapData(core::Errors *errors, core::Project &project, core::SEditorObject obj, const std::string &uriPropName, int level, PngDecodingInfo &decodingInfo, bool swizzle) {
-	std::string uri = obj->get(uriPropName)->asString();
-	if (uri.empty()) {
-		return {};
-	}
-
-	std::vector<unsigned char> data;
-	unsigned int curWidth;
-	unsigned int curHeight;
+namespace {
 
-	std::string pngPath = core::PathQueries::resolveUriPropertyToAbsolutePath(project, {obj, {uriPropName}});
-	auto rawBinaryData = utils::file::readBinary(pngPath);
+DecodedImage decodePng(const std::vector<unsigned char> &rawBinaryData, ramses::ETextureFormat userFormat, bool swizzle) {
+	DecodedImage image;
 	lodepng::State pngImportState;
 	pngImportState.decoder.color_convert = false;
-	lodepng_inspect(&curWidth, &curHeight, &pngImportState, rawBinaryData.data(), rawBinaryData.size());
+	lodepng_inspect(&image.width, &image.height, &pngImportState, rawBinaryData.data(), rawBinaryData.size());
 
 	auto &lodePngColorInfo = pngImportState.info_png.color;
-	auto pngColorType = lodePngColorInfo.colortype;
+	image.colorType = lodePngColorInfo.colortype;
+	image.bitdepth = lodePngColorInfo.bitdepth;
+
+	auto convertedFormat = swizzle ? std::get<1>(ramsesTextureFormatToSwizzleInfo(image.colorType, userFormat)) : userFormat;
+	auto bitdepth = (image.colorType == LCT_PALETTE) ? 8 : lodePngColorInfo.bitdepth;
+	auto textureFormatCompatInfo = validateTextureColorTypeAndBitDepth(convertedFormat, image.colorType, bitdepth);
+
+	image.error = textureFormatCompatInfo.conversionNeeded
+					  ? lodepng::decode(image.data, image.width, image.height, rawBinaryData, ramsesTextureFormatToPngFormat(convertedFormat), bitdepth)
+					  : lodepng::decode(image.data, image.width, image.height, pngImportState, rawBinaryData);
+
+	if (image.error == 0) {
+		if (image.bitdepth == 16) {
+			ramses_base::normalize16BitColorData(image.data);
+		} else if (image.colorType != LCT_GREY_ALPHA && convertedFormat == ramses::ETextureFormat::RG8) {
+			image.data = ramses_base::generateColorDataWithoutBlueChannel(image.data);
+		}
+	}
+	return image;
+}
 
-	decodingInfo.originalPngFormat = pngColorType;
-	decodingInfo.originalBitdepth = lodePngColorInfo.bitdepth;
-	decodingInfo.pngColorChannels = pngColorTypeToColorInfo(decodingInfo.originalPngFormat);
+}  // namespace
+
+std::string mipMapUriPropertyName(const std::string &uriPropName, int level) {
+	return (level > 1) ? fmt::format("level{}{}", level, uriPropName) : uriPropName;
+}
+
+std::optional<MipMapImage> mipMapImage(core::Project &project, core::SEditorObject obj, const std::string &uriPropName, bool swizzle) {
+	if (obj->get(uriPropName)->asString().empty()) {
+		return std::nullopt;
+	}
 
 	auto format = static_cast<user_types::ETextureFormat>(obj->get("textureFormat")->asInt());
-	auto userFormat = ramses_base::enumerationTranslationTextureFormat.at(format);
+	return MipMapImage{
+		core::PathQueries::resolveUriPropertyToAbsolutePath(project, {obj, {uriPropName}}),
+		ramses_base::enumerationTranslationTextureFormat.at(format),
+		swizzle};
+}
+
+std::vector<unsigned char> decodeMipMapData(core::Errors *errors, core::Project &project, core::SEditorObject obj, const std::string &uriPropName, int level, PngDecodingInfo &decodingInfo, bool swizzle) {
+	auto request = mipMapImage(project, obj, uriPropName, swizzle);
+	if (!request) {
+		return {};
+	}
+
+	std::string uri = obj->get(uriPropName)->asString();
+	const auto &pngPath = request->path;
+	auto userFormat = request->format;
+	auto image = DecodedImageCache::instance().get(pngPath, userFormat, swizzle, [userFormat, swizzle](const std::vector<unsigned char> &rawBinaryData) {
+		return decodePng(rawBinaryData, userFormat, swizzle);
+	});
+
+	auto pngColorType = image->colorType;
+	decodingInfo.originalPngFormat = pngColorType;
+	decodingInfo.originalBitdepth = image->bitdepth;
+	decodingInfo.pngColorChannels = pngColorTypeToColorInfo(decodingInfo.originalPngFormat);
 
 	// If swizzling is enabled, swizzledFormat becomes the actual texture format used by ramses.
 	if (swizzle) {
@@ -684,13 +729,12 @@ std::vector<unsigned char> decodeMipMapData(core::Errors *errors, core::Project
 	auto userColorChannels = ramsesTextureFormatToRamsesColorInfo(decodingInfo.originalPngFormat, userFormat);
 	decodingInfo.shaderColorChannels = ramsesColorInfoToShaderColorInfo(userColorChannels);
 
-	auto textureFormatCompatInfo = validateTextureColorTypeAndBitDepth(decodingInfo.convertedPngFormat, pngColorType, (pngColorType == LCT_PALETTE) ? 8 : lodePngColorInfo.bitdepth);
+	auto textureFormatCompatInfo = validateTextureColorTypeAndBitDepth(decodingInfo.convertedPngFormat, pngColorType, (pngColorType == LCT_PALETTE) ? 8 : image->bitdepth);
 
-	auto ret = textureFormatCompatInfo.conversionNeeded
-				   ? lodepng::decode(data, curWidth, curHeight, rawBinaryData, ramsesTextureFormatToPngFormat(decodingInfo.convertedPngFormat), (pngColorType == LCT_PALETTE) ? 8 : lodePngColorInfo.bitdepth)
-				   : lodepng::decode(data, curWidth, curHeight, pngImportState, rawBinaryData);
+	unsigned int curWidth = image->width;
+	unsigned int curHeight = image->height;
 
-	if (ret != 0) {
+	if (image->error != 0) {
 		if (utils::file::isGitLfsPlaceholderFile(pngPath)) {
 			LOG_ERROR(log_system::RAMSES_ADAPTOR, "{} '{}': Couldn't load png file from '{}'. Git LFS placeholder file detected.", obj->getTypeDescription().typeName, obj->objectName(), uri);
 			errors->addError(core::ErrorCategory::PARSING, core::ErrorLevel::ERROR, {obj->shared_from_this(), {uriPropName}}, "Image file could not be loaded, Git LFS placeholder file detected.");
@@ -708,7 +752,7 @@ std::vector<unsigned char> decodeMipMapData(core::Errors *errors, core::Project
 		}
 
 
-		auto curBitDepth = pngImportState.info_png.color.bitdepth;
+		auto curBitDepth = image->bitdepth;
 
 		if (level == 1 && decodingInfo.width == -1) {
 			decodingInfo.width = curWidth;
@@ -742,15 +786,31 @@ std::vector<unsigned char> decodeMipMapData(core::Errors *errors, core::Project
 		} else {
 			errors->removeError({obj->shared_from_this(), {uriPropName}});
 		}
+	}
+
+	// The adaptors modify the data, e.g. to flip the image.
+	return image->data;
+}
 
-		if (decodingInfo.bitdepth == 16) {
-			ramses_base::normalize16BitColorData(data);
-		} else if (pngColorType != LCT_GREY_ALPHA && decodingInfo.convertedPngFormat == ramses::ETextureFormat::RG8) {
-			data = ramses_base::generateColorDataWithoutBlueChannel(data);
+void prefetchMipMapData(const std::vector<MipMapImage> &images) {
+	std::vector<const MipMapImage *> requests;
+	std::set<std::tuple<std::string, ramses::ETextureFormat, bool>> requested;
+	for (const auto &image : images) {
+		if (requested.emplace(image.path, image.format, image.swizzle).second) {
+			requests.emplace_back(&image);
 		}
 	}
 
-	return data;
+	// The DecodedImageCache evicts the least recently used images if the prefetched ones exceed its memory budget.
+	auto &cache = DecodedImageCache::instance();
+	utils::parallel::parallelFor(requests.size(), 1, [&requests, &cache](size_t begin, size_t end) {
+		for (auto index = begin; index < end; index++) {
+			const auto &request = *requests[index];
+			cache.get(request.path, request.format, request.swizzle, [&request](const std::vector<unsigned char> &rawBinaryData) {
+				return decodePng(rawBinaryData, request.format, request.swizzle);
+			});
+		}
+	});
 }
 
 int clipAndCheckIntProperty(const core::ValueHandle value, core::Errors *errors, bool *allValid) {
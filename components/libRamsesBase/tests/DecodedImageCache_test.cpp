@@ -0,0 +1,120 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include "ramses_base/DecodedImageCache.h"
+#include "testing/RacoBaseTest.h"
+
+#include <chrono>
+
+using raco::ramses_base::DecodedImage;
+using raco::ramses_base::DecodedImageCache;
+
+class DecodedImageCacheTest : public RacoBaseTest<> {
+protected:
+	DecodedImageCache::Decoder countingDecoder(size_t dataSize = 16) {
+		return [this, dataSize](const std::vector<unsigned char>& fileContent) {
+			decodeCount_++;
+			DecodedImage image;
+			image.data = std::vector<unsigned char>(dataSize, fileContent.empty() ? 0 : fileContent.front());
+			return image;
+		};
+	}
+
+	void touch(const std::string& path) {
+		auto internalPath = utils::u8path(path).internalPath();
+		std::filesystem::last_write_time(internalPath, std::filesystem::last_write_time(internalPath) + std::chrono::seconds(1));
+	}
+
+	DecodedImageCache cache_;
+	int decodeCount_ = 0;
+};
+
+TEST_F(DecodedImageCacheTest, get_decodes_only_once) {
+	auto file = makeFile("image.png", "a");
+
+	auto first = cache_.get(file, ramses::ETextureFormat::RGBA8, false, countingDecoder());
+	auto second = cache_.get(file, ramses::ETextureFormat::RGBA8, false, countingDecoder());
+
+	EXPECT_EQ(decodeCount_, 1);
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(cache_.size(), 1);
+	EXPECT_EQ(cache_.statistics().hits, 1);
+	EXPECT_EQ(cache_.statistics().misses, 1);
+}
+
+TEST_F(DecodedImageCacheTest, get_decodes_per_format_and_swizzle) {
+	auto file = makeFile("image.png", "a");
+
+	cache_.get(file, ramses::ETextureFormat::RGBA8, false, countingDecoder());
+	cache_.get(file, ramses::ETextureFormat::RGB8, false, countingDecoder());
+	cache_.get(file, ramses::ETextureFormat::RGBA8, true, countingDecoder());
+
+	EXPECT_EQ(decodeCount_, 3);
+	EXPECT_EQ(cache_.size(), 3);
+}
+
+TEST_F(DecodedImageCacheTest, get_decodes_again_after_file_change) {
+	auto file = makeFile("image.png", "a");
+	auto first = cache_.get(file, ramses::ETextureFormat::RGBA8, false, countingDecoder());
+
+	utils::file::write(file.path, "b");
+	touch(file);
+	auto second = cache_.get(file, ramses::ETextureFormat::RGBA8, false, countingDecoder());
+
+	EXPECT_EQ(decodeCount_, 2);
+	EXPECT_EQ(first->data.front(), 'a');
+	EXPECT_EQ(second->data.front(), 'b');
+	EXPECT_EQ(cache_.size(), 1);
+}
+
+TEST_F(DecodedImageCacheTest, get_doesnt_cache_failed_decoding_or_missing_files) {
+	auto file = makeFile("image.png", "a");
+	auto failingDecoder = [this](const std::vector<unsigned char>& fileContent) {
+		decodeCount_++;
+		DecodedImage image;
+		image.error = 1;
+		return image;
+	};
+
+	cache_.get(file, ramses::ETextureFormat::RGBA8, false, failingDecoder);
+	cache_.get(file, ramses::ETextureFormat::RGBA8, false, failingDecoder);
+	cache_.get((test_path() / "missing.png").string(), ramses::ETextureFormat::RGBA8, false, countingDecoder());
+
+	EXPECT_EQ(decodeCount_, 3);
+	EXPECT_EQ(cache_.size(), 0);
+	EXPECT_EQ(cache_.memoryUsage(), 0);
+}
+
+TEST_F(DecodedImageCacheTest, memory_budget_evicts_least_recently_used) {
+	auto fileA = makeFile("a.png", "a");
+	auto fileB = makeFile("b.png", "b");
+	auto fileC = makeFile("c.png", "c");
+	auto imageSize = DecodedImage{0, 0, 0, -1, 0, std::vector<unsigned char>(1000)}.memorySize();
+	cache_.setMemoryBudget(2 * imageSize);
+
+	cache_.get(fileA, ramses::ETextureFormat::RGBA8, false, countingDecoder(1000));
+	cache_.get(fileB, ramses::ETextureFormat::RGBA8, false, countingDecoder(1000));
+	// Use a again to make b the least recently used image
+	cache_.get(fileA, ramses::ETextureFormat::RGBA8, false, countingDecoder(1000));
+	cache_.get(fileC, ramses::ETextureFormat::RGBA8, false, countingDecoder(1000));
+	EXPECT_EQ(decodeCount_, 3);
+	EXPECT_EQ(cache_.size(), 2);
+	EXPECT_EQ(cache_.memoryUsage(), 2 * imageSize);
+
+	cache_.get(fileA, ramses::ETextureFormat::RGBA8, false, countingDecoder(1000));
+	EXPECT_EQ(decodeCount_, 3);
+	cache_.get(fileB, ramses::ETextureFormat::RGBA8, false, countingDecoder(1000));
+	EXPECT_EQ(decodeCount_, 4);
+
+	cache_.setMemoryBudget(0);
+	EXPECT_EQ(cache_.size(), 0);
+	EXPECT_EQ(cache_.memoryUsage(), 0);
+}
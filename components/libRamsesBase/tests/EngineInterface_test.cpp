@@ -9,6 +9,7 @@
  */
 
 #include "RamsesBaseFixture.h"
+#include "ramses_base/LuaScriptInterfaceCache.h"
 #include <gtest/gtest.h>
 
 using namespace raco::ramses_base;
@@ -73,3 +74,49 @@ end
 		EXPECT_EQ(EnginePrimitive::Double, in.at(0).children.at(i).type);
 	}
 }
+
+TEST_F(EngineInterfaceTest, parseLuaScript_reuses_interface_of_identical_script) {
+	const std::string script = R"(
+function interface(IN,OUT)
+	IN.x = Type:Float()
+	OUT.y = Type:Int32()
+end
+
+function run(IN,OUT)
+end
+)";
+	data_storage::Table modules;
+	auto before = LuaScriptInterfaceCache::instance().statistics();
+
+	for (auto name : {"first", "second"}) {
+		std::string error;
+		core::PropertyInterfaceList in;
+		core::PropertyInterfaceList out;
+		EXPECT_TRUE(backend.coreInterface()->parseLuaScript(script, name, {}, modules, in, out, error));
+		ASSERT_EQ(1, in.size());
+		EXPECT_EQ("x", in.at(0).name);
+		ASSERT_EQ(1, out.size());
+		EXPECT_EQ("y", out.at(0).name);
+	}
+
+	auto after = LuaScriptInterfaceCache::instance().statistics();
+	EXPECT_EQ(after.hits, before.hits + 1);
+	EXPECT_EQ(after.misses, before.misses + 1);
+}
+
+TEST_F(EngineInterfaceTest, parseLuaScript_reports_errors_with_script_name) {
+	const std::string script = R"(
+function interface(IN,OUT)
+	IN.x = Type:Float(
+end
+)";
+	data_storage::Table modules;
+
+	for (auto name : {"firstScript", "secondScript"}) {
+		std::string error;
+		core::PropertyInterfaceList in;
+		core::PropertyInterfaceList out;
+		EXPECT_FALSE(backend.coreInterface()->parseLuaScript(script, name, {}, modules, in, out, error));
+		EXPECT_NE(error.find(name), std::string::npos);
+	}
+}
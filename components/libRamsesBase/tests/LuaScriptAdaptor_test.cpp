@@ -133,6 +133,28 @@ end
 	}
 }
 
+TEST_F(LuaScriptAdaptorFixture, nameChange_doesnt_recreate_script) {
+	TextFile scriptFile = makeFile("script.lua", R"(
+function interface(IN,OUT)
+	IN.x = Type:Float()
+end
+
+function run(IN,OUT)
+end
+)");
+	auto luaScript = create_lua("LuaScript Name", scriptFile);
+	dispatch();
+
+	auto engineObj{select<ramses::LuaScript>(sceneContext.logicEngine(), "LuaScript Name")};
+	ASSERT_TRUE(engineObj != nullptr);
+
+	commandInterface.set({luaScript, {"objectName"}}, std::string("Changed"));
+	dispatch();
+
+	EXPECT_EQ(select<ramses::LuaScript>(sceneContext.logicEngine(), "Changed"), engineObj);
+	EXPECT_EQ(sceneContext.logicEngine().getCollection<ramses::LuaScript>().size(), 1);
+}
+
 TEST_F(LuaScriptAdaptorFixture, inInt) {
 	auto luaScript = context.createObject(LuaScript::typeDescription.typeName, "LuaScript Name");
 
@@ -812,3 +834,32 @@ end
 	engineObj = select<ramses::LuaScript>(sceneContext.logicEngine(), "PrefabInstance.LuaScript Name");
 	ASSERT_TRUE(engineObj == nullptr);
 }
+
+TEST_F(LuaScriptAdaptorFixture, outputs_read_back_until_script_deleted) {
+	auto luaScript = context.createObject(LuaScript::typeDescription.typeName, "LuaScript Name");
+
+	std::string uriPath{(test_path() / "script.lua").string()};
+	utils::file::write(uriPath, R"(
+function interface(IN,OUT)
+	IN.in_value = Type:Int32()
+	OUT.out_value = Type:Int32()
+end
+
+function run(IN,OUT)
+	OUT.out_value = IN.in_value
+end
+
+)");
+	context.set({luaScript, {"uri"}}, uriPath);
+	context.set({luaScript, {"inputs", "in_value"}}, 5);
+	dispatch();
+	EXPECT_EQ(core::ValueHandle(luaScript, {"outputs", "out_value"}).asInt(), 5);
+
+	context.set({luaScript, {"inputs", "in_value"}}, 7);
+	dispatch();
+	EXPECT_EQ(core::ValueHandle(luaScript, {"outputs", "out_value"}).asInt(), 7);
+
+	context.deleteObjects({luaScript});
+	dispatch();
+	EXPECT_TRUE(select<ramses::LuaScript>(sceneContext.logicEngine(), "LuaScript Name") == nullptr);
+}
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include "ramses_base/LuaScriptInterfaceCache.h"
+
+using raco::ramses_base::LuaScriptInterface;
+using raco::ramses_base::LuaScriptInterfaceCache;
+
+class LuaScriptInterfaceCacheTest : public testing::Test {
+protected:
+	LuaScriptInterfaceCache::Parser countingParser(const std::string& inputName, bool success = true) {
+		return [this, inputName, success](LuaScriptInterface& outInterface) {
+			parseCount_++;
+			outInterface.inputs.emplace_back(inputName, raco::core::EnginePrimitive::Double);
+			return success;
+		};
+	}
+
+	static LuaScriptInterfaceCache::Key key(const std::string& text, std::vector<LuaScriptInterfaceCache::ModuleDependency> modules = {}) {
+		return {ramses::EFeatureLevel_01, false, text, {"math"}, modules};
+	}
+
+	LuaScriptInterfaceCache cache_;
+	int parseCount_ = 0;
+};
+
+TEST_F(LuaScriptInterfaceCacheTest, get_parses_only_once) {
+	auto first = cache_.get(key("script"), countingParser("x"));
+	auto second = cache_.get(key("script"), countingParser("x"));
+
+	EXPECT_EQ(parseCount_, 1);
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(cache_.size(), 1);
+	EXPECT_EQ(cache_.statistics().hits, 1);
+	EXPECT_EQ(cache_.statistics().misses, 1);
+}
+
+TEST_F(LuaScriptInterfaceCacheTest, get_parses_per_kind_std_modules_and_module_dependencies) {
+	cache_.get(key("script"), countingParser("x"));
+
+	auto interfaceKey = key("script");
+	interfaceKey.isInterface = true;
+	cache_.get(interfaceKey, countingParser("x"));
+
+	auto stdModulesKey = key("script");
+	stdModulesKey.stdModules = {"math", "string"};
+	cache_.get(stdModulesKey, countingParser("x"));
+
+	cache_.get(key("script", {{"mymodule", "module text", {}}}), countingParser("x"));
+	cache_.get(key("script", {{"mymodule", "changed module text", {}}}), countingParser("x"));
+	cache_.get(key("script", {{"othermodule", "module text", {}}}), countingParser("x"));
+	cache_.get(key("script", {{"mymodule", "module text", {"math"}}}), countingParser("x"));
+
+	EXPECT_EQ(parseCount_, 7);
+	EXPECT_EQ(cache_.size(), 7);
+
+	cache_.get(key("script", {{"mymodule", "module text", {}}}), countingParser("x"));
+	EXPECT_EQ(parseCount_, 7);
+}
+
+TEST_F(LuaScriptInterfaceCacheTest, get_doesnt_cache_parse_errors) {
+	EXPECT_EQ(cache_.get(key("script"), countingParser("x", false)), nullptr);
+	EXPECT_EQ(cache_.get(key("script"), countingParser("x", false)), nullptr);
+
+	EXPECT_EQ(parseCount_, 2);
+	EXPECT_EQ(cache_.size(), 0);
+}
+
+TEST_F(LuaScriptInterfaceCacheTest, max_entries_evicts_least_recently_used) {
+	cache_.setMaxEntries(2);
+
+	cache_.get(key("a"), countingParser("a"));
+	cache_.get(key("b"), countingParser("b"));
+	// Use a again to make b the least recently used entry
+	cache_.get(key("a"), countingParser("a"));
+	cache_.get(key("c"), countingParser("c"));
+	EXPECT_EQ(parseCount_, 3);
+	EXPECT_EQ(cache_.size(), 2);
+
+	cache_.get(key("a"), countingParser("a"));
+	EXPECT_EQ(parseCount_, 3);
+	auto b = cache_.get(key("b"), countingParser("b"));
+	EXPECT_EQ(parseCount_, 4);
+	EXPECT_EQ(b->inputs.front().name, "b");
+
+	cache_.setMaxEntries(0);
+	EXPECT_EQ(cache_.size(), 0);
+}
@@ -127,3 +127,86 @@ TEST_F(MeshAdaptorTest, gltf_color_attribute_vec4_with_underscore) {
 	ASSERT_TRUE(isRamsesNameInArray("mesh_MeshVertexData_a_Color", meshStuff));
 	ASSERT_EQ(context.errors().getError({mesh}).level(), core::ErrorLevel::INFORMATION);
 }
+
+TEST_F(MeshAdaptorTest, meshes_with_same_descriptor_share_data_and_resources) {
+	auto mesh = create<user_types::Mesh>("mesh");
+	context.set({mesh, &user_types::Mesh::uri_}, test_path().append("meshes/Duck.glb").string());
+	auto other = create<user_types::Mesh>("other");
+	context.set({other, &user_types::Mesh::uri_}, test_path().append("meshes/Duck.glb").string());
+
+	dispatch();
+
+	EXPECT_EQ(mesh->meshData(), other->meshData());
+	auto meshAdaptor = sceneContext.lookup<ramses_adaptor::MeshAdaptor>(mesh);
+	auto otherAdaptor = sceneContext.lookup<ramses_adaptor::MeshAdaptor>(other);
+	EXPECT_EQ(meshAdaptor->indicesPtr(), otherAdaptor->indicesPtr());
+	EXPECT_EQ(meshAdaptor->vertexData().at("a_Position"), otherAdaptor->vertexData().at("a_Position"));
+
+	auto exportsIndices = [this](SEditorObject object, const std::string& name) {
+		auto exportInfo = sceneContext.meshResourcesExportInformation(object);
+		return exportInfo.size() == 4 && std::any_of(exportInfo.begin(), exportInfo.end(), [&name](const auto& item) {
+			return item.name == name;
+		});
+	};
+
+	// The resources are named after the mesh synced first; both meshes report them.
+	auto meshStuff{select<ramses::ArrayResource>(*sceneContext.scene(), ramses::ERamsesObjectType::ArrayResource)};
+	EXPECT_EQ(meshStuff.size(), 4);
+	const std::string indicesName{meshAdaptor->indicesPtr()->getName()};
+	EXPECT_TRUE(indicesName == "mesh_MeshIndexData" || indicesName == "other_MeshIndexData");
+	EXPECT_TRUE(exportsIndices(mesh, indicesName));
+	EXPECT_TRUE(exportsIndices(other, indicesName));
+
+	context.deleteObjects({mesh});
+	dispatch();
+
+	meshStuff = select<ramses::ArrayResource>(*sceneContext.scene(), ramses::ERamsesObjectType::ArrayResource);
+	EXPECT_EQ(meshStuff.size(), 4);
+	ASSERT_TRUE(otherAdaptor->indicesPtr() != nullptr);
+	ASSERT_TRUE(isRamsesNameInArray("other_MeshIndexData", meshStuff));
+	EXPECT_TRUE(sceneContext.meshResourcesExportInformation(mesh).empty());
+	EXPECT_TRUE(exportsIndices(other, "other_MeshIndexData"));
+
+	context.set({other, &user_types::Mesh::objectName_}, std::string("renamed"));
+	dispatch();
+
+	meshStuff = select<ramses::ArrayResource>(*sceneContext.scene(), ramses::ERamsesObjectType::ArrayResource);
+	EXPECT_EQ(meshStuff.size(), 4);
+	ASSERT_TRUE(isRamsesNameInArray("renamed_MeshIndexData", meshStuff));
+	EXPECT_TRUE(exportsIndices(other, "renamed_MeshIndexData"));
+}
+
+TEST_F(MeshAdaptorTest, meshes_with_different_submesh_dont_share_data) {
+	auto mesh = create<user_types::Mesh>("mesh");
+	context.set({mesh, &user_types::Mesh::bakeMeshes_}, false);
+	context.set({mesh, &user_types::Mesh::uri_}, test_path().append("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf").string());
+	auto other = create<user_types::Mesh>("other");
+	context.set({other, &user_types::Mesh::bakeMeshes_}, false);
+	context.set({other, &user_types::Mesh::meshIndex_}, 1);
+	context.set({other, &user_types::Mesh::uri_}, test_path().append("meshes/CesiumMilkTruck/CesiumMilkTruck.gltf").string());
+
+	dispatch();
+
+	ASSERT_TRUE(mesh->meshData() != nullptr);
+	ASSERT_TRUE(other->meshData() != nullptr);
+	EXPECT_NE(mesh->meshData(), other->meshData());
+	auto meshStuff{select<ramses::ArrayResource>(*sceneContext.scene(), ramses::ERamsesObjectType::ArrayResource)};
+	EXPECT_EQ(meshStuff.size(), 8);
+	EXPECT_TRUE(isRamsesNameInArray("mesh_MeshIndexData", meshStuff));
+	EXPECT_TRUE(isRamsesNameInArray("other_MeshIndexData", meshStuff));
+}
+
+TEST_F(MeshAdaptorTest, meshes_with_different_bake_flag_dont_share_data) {
+	auto mesh = create<user_types::Mesh>("mesh");
+	context.set({mesh, &user_types::Mesh::bakeMeshes_}, false);
+	context.set({mesh, &user_types::Mesh::uri_}, test_path().append("meshes/Duck.glb").string());
+	auto other = create<user_types::Mesh>("other");
+	context.set({other, &user_types::Mesh::uri_}, test_path().append("meshes/Duck.glb").string());
+
+	dispatch();
+
+	ASSERT_TRUE(mesh->meshData() != nullptr);
+	EXPECT_NE(mesh->meshData(), other->meshData());
+	auto meshStuff{select<ramses::ArrayResource>(*sceneContext.scene(), ramses::ERamsesObjectType::ArrayResource)};
+	EXPECT_EQ(meshStuff.size(), 8);
+}
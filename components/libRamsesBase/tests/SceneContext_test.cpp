@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <gtest/gtest.h>
 
 using ramses_adaptor::SceneAdaptor;
@@ -436,6 +437,77 @@ TEST_F(SceneContextTest, prefab_delete_and_move_in) {
 	dontFind<ramses::Node>("node_2");
 }
 
+static void checkDependencyGraphSorted(const std::vector<ramses_adaptor::DependencyNode>& graph, const core::Project& project) {
+	core::SEditorObjectSet visited;
+	for (const auto& item : graph) {
+		for (const auto& refTarget : item.referencedObjects) {
+			EXPECT_TRUE(visited.find(refTarget) != visited.end()) << item.object->objectName() << " sorted before " << refTarget->objectName();
+		}
+		visited.insert(item.object);
+	}
+	EXPECT_EQ(visited.size(), project.instances().size());
+}
+
+TEST_F(SceneContextTest, dependency_graph_incremental_update) {
+	auto mesh = create<Mesh>("mesh");
+	auto material = create<Material>("material");
+	auto meshNode = create<MeshNode>("meshnode");
+	auto node = create<Node>("node");
+	dispatch();
+	checkDependencyGraphSorted(sceneContext.dependencyGraph(), project);
+
+	commandInterface.set({meshNode, &MeshNode::mesh_}, mesh);
+	commandInterface.set({meshNode, {"materials", "material", "material"}}, material);
+	dispatch();
+	checkDependencyGraphSorted(sceneContext.dependencyGraph(), project);
+
+	commandInterface.moveScenegraphChildren({meshNode}, node);
+	auto mesh_2 = create<Mesh>("mesh_2");
+	commandInterface.set({meshNode, &MeshNode::mesh_}, mesh_2);
+	dispatch();
+	checkDependencyGraphSorted(sceneContext.dependencyGraph(), project);
+
+	commandInterface.deleteObjects({mesh_2, material});
+	dispatch();
+	checkDependencyGraphSorted(sceneContext.dependencyGraph(), project);
+
+	commandInterface.undoStack().undo();
+	dispatch();
+	checkDependencyGraphSorted(sceneContext.dependencyGraph(), project);
+}
+
+#ifdef NDEBUG
+TEST_F(SceneContextTest, dependency_graph_update_performance_independent_of_project_size) {
+	auto node = create<Node>("node");
+	auto addNodes = [this](int first, int last) {
+		for (int i = first; i < last; i++) {
+			auto parent = create<Node>(fmt::format("parent_{}", i));
+			create<Node>(fmt::format("child_{}", i), parent);
+		}
+		dispatch();
+	};
+	// The same change set is applied to both project sizes.
+	auto measureUpdates = [this, node]() {
+		auto startTime = std::chrono::steady_clock::now();
+		for (int i = 0; i < 1000; i++) {
+			commandInterface.set({node, &Node::translation_, &core::Vec3f::x}, static_cast<double>(i));
+			dispatch();
+		}
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+	};
+
+	addNodes(0, 250);
+	auto smallProjectTime = measureUpdates();
+	addNodes(250, 5000);
+	auto largeProjectTime = measureUpdates();
+
+	// Setting a value on a single object must not traverse the complete project: 20 times as many nodes must not
+	// make the update noticeably slower. The constant allows for timer resolution and noise in short runs.
+	EXPECT_LE(largeProjectTime, 2 * smallProjectTime + 100) << "500 nodes: " << smallProjectTime << " ms, 10000 nodes: " << largeProjectTime << " ms";
+	checkDependencyGraphSorted(sceneContext.dependencyGraph(), project);
+}
+#endif
+
 // TODO: this seems a little bit of an overkill to get all permutations of an array of size 4, find an easier way to tell INSTANTIATE_TEST_SUITE_P to do it for all permutations of the array
 struct CreationOrder {
 	CreationOrder(const std::array<std::string, 4>& a) : order{a} {};
@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include "ramses_base/ShaderReflectionCache.h"
+
+using raco::ramses_base::ShaderReflection;
+using raco::ramses_base::ShaderReflectionCache;
+
+class ShaderReflectionCacheTest : public testing::Test {
+protected:
+	ShaderReflectionCache::Parser countingParser(const std::string& uniformName, bool success = true) {
+		return [this, uniformName, success]() {
+			parseCount_++;
+			ShaderReflection reflection;
+			reflection.success = success;
+			if (success) {
+				reflection.uniforms.emplace_back(uniformName, raco::core::EnginePrimitive::Double);
+			} else {
+				reflection.error = "parse error";
+			}
+			return reflection;
+		};
+	}
+
+	ShaderReflectionCache cache_;
+	int parseCount_ = 0;
+};
+
+TEST_F(ShaderReflectionCacheTest, get_parses_only_once) {
+	auto first = cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment", "", countingParser("u"));
+	auto second = cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment", "", countingParser("u"));
+
+	EXPECT_EQ(parseCount_, 1);
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(cache_.size(), 1);
+	EXPECT_EQ(cache_.statistics().hits, 1);
+	EXPECT_EQ(cache_.statistics().misses, 1);
+	EXPECT_DOUBLE_EQ(cache_.statistics().hitRate(), 0.5);
+}
+
+TEST_F(ShaderReflectionCacheTest, get_parses_per_source_and_defines) {
+	cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment", "", countingParser("u"));
+	cache_.get(ramses::EFeatureLevel_01, "vertex2", "", "fragment", "", countingParser("u"));
+	cache_.get(ramses::EFeatureLevel_01, "vertex", "geometry", "fragment", "", countingParser("u"));
+	cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment2", "", countingParser("u"));
+	cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment", "#define A", countingParser("u"));
+
+	EXPECT_EQ(parseCount_, 5);
+	EXPECT_EQ(cache_.size(), 5);
+	EXPECT_EQ(cache_.statistics().hits, 0);
+}
+
+TEST_F(ShaderReflectionCacheTest, get_caches_parse_errors) {
+	auto first = cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment", "", countingParser("u", false));
+	auto second = cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment", "", countingParser("u", false));
+
+	EXPECT_EQ(parseCount_, 1);
+	EXPECT_FALSE(second->success);
+	EXPECT_EQ(second->error, "parse error");
+}
+
+TEST_F(ShaderReflectionCacheTest, max_entries_evicts_least_recently_used) {
+	cache_.setMaxEntries(2);
+
+	cache_.get(ramses::EFeatureLevel_01, "a", "", "fragment", "", countingParser("a"));
+	cache_.get(ramses::EFeatureLevel_01, "b", "", "fragment", "", countingParser("b"));
+	// Use a again to make b the least recently used entry
+	cache_.get(ramses::EFeatureLevel_01, "a", "", "fragment", "", countingParser("a"));
+	cache_.get(ramses::EFeatureLevel_01, "c", "", "fragment", "", countingParser("c"));
+	EXPECT_EQ(parseCount_, 3);
+	EXPECT_EQ(cache_.size(), 2);
+
+	cache_.get(ramses::EFeatureLevel_01, "a", "", "fragment", "", countingParser("a"));
+	EXPECT_EQ(parseCount_, 3);
+	auto b = cache_.get(ramses::EFeatureLevel_01, "b", "", "fragment", "", countingParser("b"));
+	EXPECT_EQ(parseCount_, 4);
+	EXPECT_EQ(b->uniforms.front().name, "b");
+
+	cache_.setMaxEntries(0);
+	EXPECT_EQ(cache_.size(), 0);
+}
+
+TEST_F(ShaderReflectionCacheTest, reset_statistics_keeps_entries) {
+	cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment", "", countingParser("u"));
+	cache_.get(ramses::EFeatureLevel_01, "vertex", "", "fragment", "", countingParser("u"));
+
+	cache_.resetStatistics();
+	EXPECT_EQ(cache_.statistics().hits, 0);
+	EXPECT_EQ(cache_.statistics().misses, 0);
+	EXPECT_EQ(cache_.statistics().entryCount, 1);
+
+	cache_.clear();
+	EXPECT_EQ(cache_.size(), 0);
+}
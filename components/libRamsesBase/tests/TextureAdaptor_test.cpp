@@ -11,8 +11,12 @@
 
 #include "RamsesBaseFixture.h"
 #include "ramses_adaptor/TextureSamplerAdaptor.h"
+#include "ramses_base/DecodedImageCache.h"
 #include "testing/TestUtil.h"
 #include "user_types/Enumerations.h"
+#include "utils/ParallelUtils.h"
+
+#include <chrono>
 
 using user_types::ETextureFormat;
 
@@ -470,3 +474,88 @@ TEST_F(TextureAdaptorFixture, gitLfsPlaceholderFileInUri) {
 	ASSERT_TRUE(commandInterface.errors().hasError({texture, &user_types::Texture::uri_}));
 	ASSERT_TRUE(commandInterface.errors().getError({texture, &user_types::Texture::uri_}).message().find("Git LFS Placeholder"));
 }
+
+TEST_F(TextureAdaptorFixture, bulkUpdateDecodesAllTextureImagesOnce) {
+	auto& cache = ramses_base::DecodedImageCache::instance();
+	cache.clear();
+
+	std::vector<core::SEditorObject> textures;
+	for (const auto& image : {"blue_1024.png", "green_512.png", "red_128.png"}) {
+		auto texture = create<user_types::Texture>(image);
+		commandInterface.set({texture, &user_types::Texture::uri_}, (test_path() / "images" / image).string());
+		textures.emplace_back(texture);
+	}
+	auto sharedImageTexture = create<user_types::Texture>("shared");
+	commandInterface.set({sharedImageTexture, &user_types::Texture::uri_}, (test_path() / "images" / "red_128.png").string());
+	cache.resetStatistics();
+	dispatch();
+
+	// The images are decoded by the prefetch before the adaptors are synced: every adaptor finds its image in the cache.
+	auto stats = cache.statistics();
+	EXPECT_EQ(stats.misses, 3);
+	EXPECT_EQ(stats.hits, 4);
+	EXPECT_EQ(stats.entryCount, 3);
+	for (const auto& texture : textures) {
+		ASSERT_FALSE(commandInterface.errors().hasError({texture, &user_types::Texture::uri_}));
+	}
+	ASSERT_EQ(select<ramses::TextureSampler>(*sceneContext.scene(), ramses::ERamsesObjectType::TextureSampler).size(), 4);
+}
+
+TEST_F(TextureAdaptorFixture, bulkUpdateDecodesOnlyChangedTextureImages) {
+	auto& cache = ramses_base::DecodedImageCache::instance();
+
+	std::vector<core::SEditorObject> textures;
+	for (const auto& image : {"blue_1024.png", "green_512.png", "red_128.png"}) {
+		auto texture = create<user_types::Texture>(image);
+		commandInterface.set({texture, &user_types::Texture::uri_}, (test_path() / "images" / image).string());
+		textures.emplace_back(texture);
+	}
+	dispatch();
+
+	cache.clear();
+	cache.resetStatistics();
+	commandInterface.set({textures[0], &user_types::Texture::uri_}, (test_path() / "images" / "green_512.png").string());
+	commandInterface.set({textures[1], &user_types::Texture::uri_}, (test_path() / "images" / "blue_1024.png").string());
+	dispatch();
+
+	// The unchanged texture is neither prefetched nor synced.
+	auto stats = cache.statistics();
+	EXPECT_EQ(stats.misses, 2);
+	EXPECT_EQ(stats.hits, 2);
+	EXPECT_EQ(stats.entryCount, 2);
+}
+
+#ifdef NDEBUG
+TEST_F(TextureAdaptorFixture, benchmark_bulk_update_texture_decoding) {
+	const int numTextures = 100;
+	for (int index = 0; index < numTextures; index++) {
+		std::filesystem::copy(test_path() / "images" / "blue_1024.png", test_path() / "images" / fmt::format("blue_1024_{}.png", index));
+	}
+
+	auto measure = [this, numTextures](size_t workerCount) {
+		utils::parallel::setWorkerCount(workerCount);
+		ramses_base::DecodedImageCache::instance().clear();
+
+		std::vector<core::SEditorObject> textures;
+		for (int index = 0; index < numTextures; index++) {
+			auto texture = create<user_types::Texture>(fmt::format("texture_{}", index));
+			commandInterface.set({texture, &user_types::Texture::uri_}, (test_path() / "images" / fmt::format("blue_1024_{}.png", index)).string());
+			textures.emplace_back(texture);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		dispatch();
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+		commandInterface.deleteObjects(textures);
+		dispatch();
+		return elapsed;
+	};
+
+	auto serialTime = measure(1);
+	auto parallelTime = measure(0);
+	if (utils::parallel::workerCount() >= 4) {
+		EXPECT_LT(parallelTime, serialTime);
+	}
+}
+#endif
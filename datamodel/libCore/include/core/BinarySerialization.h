@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include "core/ProjectObjectIndex.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace raco::serialization {
+
+/**
+ * Binary encoding of the JSON project file content.
+ * 
+ * The binary format is a lossless encoding of the JSON document: converting a JSON project to binary and back
+ * results in the same JSON document. All numbers are little endian.
+ * 
+ *   file      := magic "RCAB" | uint32 format version | uint32 string count | string* | value
+ *   string    := uint32 byte length | UTF-8 bytes
+ *   value     := uint8 tag | payload
+ * 
+ * with the payload depending on the tag:
+ *   Null, False, True:  none
+ *   Int32:              int32; used for integral numbers in the int32 range
+ *   Double:             float64
+ *   String:             uint32 index into the string table
+ *   NumberArray:        uint32 element count | float64*
+ *   Array:              uint32 byte size of the rest | uint32 element count | value*
+ *   Object:             uint32 byte size of the rest | uint32 member count | (uint32 key string index | value)*
+ * 
+ * All strings (property names, type names and string values) are interned in the string table.
+ * The byte size prefix of arrays and objects allows readers to skip them without decoding.
+*/
+
+constexpr int BINARY_PROJECT_FORMAT_VERSION = 1;
+
+bool isBinaryProject(std::string_view data);
+
+std::string convertJsonToBinary(const QJsonDocument& document);
+
+// @exception std::runtime_error if the data is not a valid binary project
+QJsonDocument convertBinaryToJson(std::string_view data);
+
+/**
+ * @brief Binary project content with the object and link arrays split off from the remaining top-level data.
+ * 
+ * The elements of the object and link arrays are decoded in parallel. The result can be deserialized using
+ * deserializeProject(header, instances, links, filename).
+*/
+struct BinaryProjectContent {
+	QJsonDocument header;
+	std::vector<QJsonObject> instances;
+	std::vector<QJsonObject> links;
+};
+
+/**
+ * @param selection If not null only the selected objects and links are decoded.
+ * @exception std::runtime_error if the data is not a valid binary project or the selection doesn't match the data
+*/
+BinaryProjectContent decodeBinaryProject(std::string_view data, const ProjectObjectSelection* selection = nullptr);
+
+/**
+ * @brief Decode only the top-level data of a binary project; the object and link arrays are skipped without decoding.
+ * 
+ * @exception std::runtime_error if the data is not a valid binary project
+*/
+QJsonDocument decodeBinaryProjectHeader(std::string_view data);
+
+}  // namespace raco::serialization
@@ -67,6 +67,9 @@ public:
 	 */
 	DataChangeRecorder release();
 
+	// True if no changes have been recorded since the last #reset().
+	bool empty() const;
+
 	SEditorObjectSet const& getCreatedObjects() const;
 	SEditorObjectSet const& getDeletedObjects() const;
 
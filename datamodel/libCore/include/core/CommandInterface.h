@@ -266,6 +266,39 @@ public:
 	 */
 	void executeCompositeCommand(std::function<void()> compositeCommand, const std::string& description);
 
+	/**
+	 * @brief Begin a transaction.
+	 *
+	 * A transaction is a composite command (see #executeCompositeCommand) which additionally defers the
+	 * update of the prefab instances: instead of after every single operation the prefab instances are only
+	 * updated once when the outermost transaction ends. This makes bulk edits of many properties much faster.
+	 *
+	 * Inside a transaction prefab instances don't reflect changes made to their prefabs in the same transaction.
+	 *
+	 * Transactions can be nested and can be mixed with composite commands.
+	 */
+	void beginTransaction();
+
+	/**
+	 * @brief End a transaction started with #beginTransaction.
+	 *
+	 * Ending the outermost transaction updates the prefab instances and, unless the transaction is nested in a
+	 * composite command, generates a single undo stack entry.
+	 *
+	 * @param description Description for the undo stack entry.
+	 * @param abort Signals that the transaction failed. The changes are rolled back like for composite commands.
+	 */
+	void endTransaction(const std::string& description, bool abort = false);
+
+	/**
+	 * @brief Execute a lambda function as a transaction, see #beginTransaction.
+	 *
+	 * If the function throws an exception the transaction is rolled back and the exception is re-thrown.
+	 */
+	void executeTransaction(std::function<void()> transaction, const std::string& description);
+
+	int transactionDepth() const;
+
 private:
 	bool canSetHandle(ValueHandle const& handle, PrimitiveType type) const;
 
@@ -280,8 +313,12 @@ private:
 
 	static std::string getMergeId(const std::set<ValueHandle>& handles);
 
+	// Update the prefab instances unless this is deferred by a running transaction.
+	void updatePrefabs();
+
 	BaseContext* context_;
 	UndoStack* undoStack_;
+	int transactionDepth_ = 0;
 };
 
 }  // namespace raco::core
\ No newline at end of file
@@ -16,12 +16,18 @@
 #include "log_system/log.h"
 
 #include <map>
+#include <set>
+#include <vector>
 
 namespace raco::core {
 
 /**
  * Basic Error storage.
  * For now we only allow one error per [ValueHandle].
+ *
+ * Besides the main storage indexed by object the errors are also indexed by [ErrorCategory] and by the name
+ * of the top-level property they refer to. Use the operations working on these indices instead of #removeIf
+ * in code which runs on every update.
  */
 class Errors {
 public:
@@ -63,11 +69,44 @@ public:
 	 * @returns true if any error item has been removed.
 	 */
 	bool removeAll(const SCEditorObject& object);
+	/**
+	 * Removes all error items of the given [ErrorCategory].
+	 * @returns true if any error item has been removed.
+	 */
+	bool removeAll(ErrorCategory category);
+	/**
+	 * Removes all error items of properties nested inside the given [ValueHandle]. The error of the handle itself is kept.
+	 * @returns true if any error item has been removed.
+	 */
+	bool removeContained(const ValueHandle& parent);
 	/**
 	 * Remove all error items matching the given filter.
+	 * This needs to check all errors in the project; prefer the overload taking an [ErrorCategory] if possible.
 	 * @returns true if any error item has been removed.
 	 */
 	bool removeIf(const std::function<bool(const ErrorItem&)>& predicate);
+	/**
+	 * Remove all error items of the given [ErrorCategory] matching the given filter.
+	 * @returns true if any error item has been removed.
+	 */
+	bool removeIf(ErrorCategory category, const std::function<bool(const ErrorItem&)>& predicate);
+
+	/**
+	 * Replace the errors of the given handles by the new errors.
+	 * Errors identical to an existing error are not recorded as changed and errors of old handles not occurring
+	 * in the new errors are removed.
+	 * The old handles are copied, so the handle sets returned by the getters below can be passed directly.
+	 */
+	void replaceErrors(std::set<ValueHandle> oldHandles, const std::vector<ErrorItem>& newErrors);
+
+	/**
+	 * @returns the handles of all errors of the given [ErrorCategory].
+	 */
+	const std::set<ValueHandle>& getErrorHandles(ErrorCategory category) const;
+	/**
+	 * @returns the handles of all property errors located at or below a top-level property with the given name.
+	 */
+	const std::set<ValueHandle>& getPropertyErrorHandles(const std::string& propertyName) const;
 
 	/**
 	 * @returns read-only reference to all saved errors.
@@ -79,7 +118,14 @@ public:
 	ErrorLevel maxErrorLevel() const;
 
 private:
+	static std::string topLevelPropertyName(const ValueHandle& handle);
+
+	void addToIndex(const ErrorItem& error);
+	void removeFromIndex(const ErrorItem& error);
+
 	std::map<SCEditorObject, std::map<ValueHandle, ErrorItem>> errors_;
+	std::map<ErrorCategory, std::set<ValueHandle>> errorsByCategory_;
+	std::map<std::string, std::set<ValueHandle>> errorsByProperty_;
 	DataChangeRecorder* recorder_;
 };
 
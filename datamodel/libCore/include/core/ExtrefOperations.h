@@ -12,10 +12,13 @@
 
 #include "EditorObject.h"
 
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
-#include <functional>
 
 namespace raco::core {
 
@@ -26,6 +29,12 @@ class Project;
 struct LoadContext {
 	std::vector<std::string> pathStack;
 	int featureLevel{-1};
+
+	// Set while collecting the external objects during an external reference update.
+	// Maps external project path -> IDs of the top-level external reference objects of the project being updated.
+	// This allows the ExternalProjectsStoreInterface to load only the part of an external project which is actually used.
+	// If not set the complete external projects are needed.
+	std::optional<std::map<std::string, std::set<std::string>>> requiredExternalObjects;
 };
 
 class ExternalProjectsStoreInterface {
@@ -192,6 +192,11 @@ public:
 	// Nesting level of property.
 	size_t depth() const;
 
+	// Property indices along the path from the root object; empty for object handles.
+	const std::vector<size_t>& indices() const {
+		return indices_;
+	}
+
 	bool operator==(const ValueHandle& right) const;
 	bool operator<(const ValueHandle& right) const;
 
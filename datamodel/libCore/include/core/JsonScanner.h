@@ -0,0 +1,69 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace raco::serialization {
+
+/**
+ * @brief Forward-only JSON scanner reading from a std::istream.
+ * 
+ * The scanner doesn't build a document. It walks through objects and arrays and either skips values
+ * or copies their raw JSON text. This allows to process large files piece by piece without holding
+ * the complete file or a complete document in memory.
+ * 
+ * The structure is only validated as far as needed for scanning. Malformed input results in a std::runtime_error.
+*/
+class JsonScanner {
+public:
+	explicit JsonScanner(std::istream& stream);
+
+	// Consume the opening bracket of an object.
+	void beginObject();
+
+	// Advance to the next key of the current object. Returns false and consumes the closing bracket if the end of the object is reached.
+	// After a key has been read the value must be consumed using skipValue, readRawValue, beginObject or beginArray.
+	bool nextKey(std::string& outKey);
+
+	// Consume the opening bracket of an array.
+	void beginArray();
+
+	// Advance to the next element of the current array. Returns false and consumes the closing bracket if the end of the array is reached.
+	bool nextElement();
+
+	void skipValue();
+
+	// Copy the raw JSON text of the next value into outValue.
+	void readRawValue(std::string& outValue);
+
+	// Byte offset of the next unread character relative to the start of the stream.
+	std::streamoff offset() const;
+
+	// Continue scanning at the given offset. The nesting state is reset.
+	void seek(std::streamoff offset);
+
+private:
+	int peekNonWhitespace();
+	int get();
+	void expect(char c);
+	void scanValue(std::string* out);
+	void scanString(std::string* out);
+
+	std::streambuf* buffer_;
+	std::istream& stream_;
+	std::streamoff offset_ = 0;
+	// One entry per open object or array: true if no element/key has been read yet.
+	std::vector<bool> first_;
+};
+
+}  // namespace raco::serialization
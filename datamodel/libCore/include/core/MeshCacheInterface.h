@@ -285,6 +285,10 @@ public:
 	// Discard away the currently loaded file. Use this to force a reload of the file on the next loadMesh.
 	virtual void reset() = 0;
 
+	// Approximate memory in bytes released by reset(). Data of the loaded file which is still referenced by
+	// meshes created from it is not included. 0 if no file is loaded.
+	virtual size_t memoryUsage() = 0;
+
 	virtual const MeshScenegraph* getScenegraph(const std::string& absPath) = 0;
 
 	virtual int getTotalMeshCount() = 0;
@@ -301,6 +305,9 @@ public:
 	virtual ~MeshCache() = default;
 
 	virtual SharedMeshData loadMesh(const core::MeshDescriptor& descriptor) = 0;
+	// True if the file is currently loaded in the background. The file change callbacks registered for the file
+	// are invoked once the loading has finished; loadMesh will then return the loaded mesh.
+	virtual bool isLoading(const std::string& absPath) = 0;
 
 	virtual const MeshScenegraph* getMeshScenegraph(const std::string& absPath) = 0;
 	virtual std::string getMeshError(const std::string& absPath) = 0;
@@ -12,6 +12,8 @@
 
 #include "core/Context.h"
 
+#include <unordered_set>
+
 namespace raco::user_types {
 
 class Prefab;
@@ -80,7 +82,10 @@ public:
 	static void prefabUpdateOrderDepthFirstSearch(user_types::SPrefab current, std::vector<user_types::SPrefab>& order);
 
 private:
-	static void updatePrefabInstance(BaseContext& context, const user_types::SPrefab& prefab, user_types::SPrefabInstance instance, bool instanceDirty, bool propagateMissingInterfaceProperties);
+	static void prefabUpdateOrderDepthFirstSearch(user_types::SPrefab current, std::vector<user_types::SPrefab>& order, std::unordered_set<user_types::SPrefab>& visited);
+
+	// @return true if the prefab instance was changed.
+	static bool updatePrefabInstance(BaseContext& context, const user_types::SPrefab& prefab, user_types::SPrefabInstance instance, bool instanceDirty, bool propagateMissingInterfaceProperties);
 };
 
 }  // namespace raco::core
\ No newline at end of file
@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace raco::core {
+class EditorObject;
+using SEditorObject = std::shared_ptr<EditorObject>;
+class Link;
+using SLink = std::shared_ptr<Link>;
+}  // namespace raco::core
+
+namespace raco::serialization {
+
+/**
+ * @brief Subset of the elements of the object and link arrays of a project file.
+ *
+ * The flags are indexed by the position of the element in the respective array of the file.
+*/
+struct ProjectObjectSelection {
+	std::vector<bool> instances;
+	std::vector<bool> links;
+};
+
+/**
+ * @brief Object index of a project file.
+ *
+ * The index contains the object IDs together with the IDs of all objects each object depends on. It is
+ * stored in a sidecar file next to the project file and allows to load only the part of a project needed
+ * to resolve a set of objects, e.g. the external reference objects used by another project.
+ *
+ * The index is only valid for the file content it was created for; this is checked via a content hash.
+*/
+struct ProjectObjectIndex {
+	struct Object {
+		std::string id;
+		std::string typeName;
+		// Empty if the object has no parent
+		std::string parentID;
+		// IDs of all objects referenced by the properties of the object, including the children.
+		std::vector<std::string> references;
+	};
+
+	struct Link {
+		std::string startID;
+		std::string endID;
+	};
+
+	// In the order of the instances array of the project file
+	std::vector<Object> objects;
+	// In the order of the links array of the project file
+	std::vector<Link> links;
+	std::string fileHash;
+
+	static constexpr int FORMAT_VERSION = 1;
+	static constexpr const char* FILE_SUFFIX = ".idx";
+
+	/**
+	 * @brief Create the index for the object and link arrays of a project file.
+	 *
+	 * The objects and links must be in the same order as in the file. The fileHash needs to be set
+	 * separately once the file content is known.
+	*/
+	static ProjectObjectIndex create(const std::vector<core::SEditorObject>& objects, const std::vector<core::SLink>& links);
+
+	static std::string indexFilePath(const std::string& projectFilePath);
+
+	static std::string hashFileContent(std::string_view fileContent);
+	static std::string hashFileContent(std::istream& stream);
+
+	std::string serialize() const;
+
+	// @return empty optional if the data is no valid index
+	static std::optional<ProjectObjectIndex> deserialize(std::string_view data);
+
+	/**
+	 * @brief Select the objects needed to load the given objects.
+	 *
+	 * The selection is the closure of the given objects under
+	 * - the references of the objects
+	 * - the parent of the objects
+	 * - the starting object of links ending on the objects
+	 * Only links with both endpoints in the selection are selected. The ProjectSettings are always selected.
+	 * Object IDs not contained in the index are ignored.
+	*/
+	ProjectObjectSelection select(const std::set<std::string>& objectIDs) const;
+};
+
+}  // namespace raco::serialization
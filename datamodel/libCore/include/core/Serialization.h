@@ -12,13 +12,16 @@
 #include "core/CoreAnnotations.h"
 #include "core/BasicAnnotations.h"
 #include "core/BasicTypes.h"
+#include "core/ProjectObjectIndex.h"
 #include "core/UserObjectFactoryInterface.h"
 #include "data_storage/Value.h"
 #include "user_types/UserObjectFactory.h"
 
 #include <QJsonArray>
 #include <QJsonDocument>
+#include <QJsonObject>
 #include <functional>
+#include <istream>
 #include <map>
 #include <memory>
 #include <optional>
@@ -146,6 +149,42 @@ std::map<std::string, std::map<std::string, std::string>> deserializeUserTypePro
 
 ProjectDeserializationInfoIR deserializeProjectToIR(const QJsonDocument& document, const std::string& filename);
 
+/**
+ * @brief Top-level data of a project file except for the object and link arrays.
+ * 
+ * The arrays are only located in the file; their offsets are used by the streaming deserialization functions below.
+*/
+struct ProjectFileHeader {
+	QJsonDocument document;
+	std::streamoff instancesOffset = -1;
+	std::streamoff linksOffset = -1;
+};
+
+ProjectFileHeader deserializeProjectHeader(std::istream& stream);
+
+/**
+ * @brief Deserialize a project from a stream one object at a time.
+ * 
+ * In contrast to the QJsonDocument based functions only the JSON of a single object is kept in memory.
+ * Files needing the JSON migration to file version 23 are read completely and handled by the document based code.
+ * 
+ * @param header Result of deserializeProjectHeader for the same stream.
+ * @param selection If not null only the selected objects and links are deserialized; the elements which are not selected
+ * are skipped without parsing. The selection is ignored for files needing the JSON migration to file version 23.
+ * @exception std::runtime_error if the selection doesn't match the number of objects or links in the file.
+*/
+ProjectDeserializationInfoIR deserializeProjectToIR(std::istream& stream, const ProjectFileHeader& header, const std::string& filename, const ProjectObjectSelection* selection = nullptr);
+ProjectDeserializationInfo deserializeProject(std::istream& stream, const ProjectFileHeader& header, const std::string& filename, const ProjectObjectSelection* selection = nullptr);
+
+/**
+ * @brief Deserialize a project from the top-level data and the already extracted instance and link objects.
+ * 
+ * The header document contains everything except for the object and link arrays. This is used for project
+ * encodings where the objects can be extracted without parsing the complete file, e.g. the binary project format.
+*/
+ProjectDeserializationInfoIR deserializeProjectToIR(const QJsonDocument& header, const std::vector<QJsonObject>& instances, const std::vector<QJsonObject>& links, const std::string& filename);
+ProjectDeserializationInfo deserializeProject(const QJsonDocument& header, const std::vector<QJsonObject>& instances, const std::vector<QJsonObject>& links, const std::string& filename);
+
 namespace test_helpers {
 
 std::string serializeObject(const SReflectionInterface& object, const std::string& projectPath = {});
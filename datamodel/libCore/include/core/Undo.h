@@ -12,7 +12,9 @@
 #include "core/Project.h"
 
 #include <functional>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace raco::core {
 
@@ -44,8 +46,19 @@ class UndoStack {
 public:
 	using Callback = std::function<void()>;
 
+	enum class StorageMode {
+		// Every entry stores a complete Project. Objects not changed by the entry are shared with the previous entry.
+		Snapshot,
+		// Every entry only stores the property-level differences to the previous entry together with
+		// created/deleted objects and added/removed links. A single copy of the current state is kept to
+		// compute the differences.
+		Delta
+	};
+
 	UndoStack(
-		BaseContext *context, const Callback &onChange = []() {});
+		BaseContext *context, const Callback &onChange = []() {}, StorageMode mode = StorageMode::Snapshot);
+
+	StorageMode storageMode() const;
 
 	// Add another undo stack entry.
 	void push(const std::string &description, std::string mergeId = std::string());
@@ -98,27 +111,112 @@ public:
 
 	void reset();
 
+	/**
+	 * @brief Limit the size of the undo stack.
+	 * 
+	 * After each push the oldest entries are dropped until both limits are satisfied again. The current
+	 * entry is never dropped.
+	 * 
+	 * @param maxEntries Maximum number of entries including the current one. 0 disables the limit.
+	 * @param maxMemoryBytes Maximum estimated memory footprint in bytes (see memoryFootprint). 0 disables the limit.
+	*/
+	void setMemoryBudget(size_t maxEntries, size_t maxMemoryBytes);
+	size_t maxEntries() const;
+	size_t maxMemoryBytes() const;
+
+	// Estimated memory held by the undo stack entries in bytes.
+	// Objects shared between several snapshot entries are only counted once.
+	size_t memoryFootprint() const;
+
 protected:
 	void saveProjectState(const Project *src, Project *dest, Project *ref, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory);
-	void updateProjectState(const Project *src, Project *dest, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory);
+	void updateProjectState(const Project *src, Project *dest, const Project *ref, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory);
 
 	void restoreProjectState(Project *src, Project *dest, BaseContext &context, UserObjectFactoryInterface &factory);
 
 	bool canMerge(const DataChangeRecorder &changes);
 
+	// Change of a single property. Paths of different ValueDeltas of the same object never nest.
+	// The contained references are translated by object id when the value is restored.
+	struct ValueDelta {
+		std::string objectID;
+		std::vector<std::string> propertyPath;
+		std::unique_ptr<ValueBase> oldValue;
+		std::unique_ptr<ValueBase> newValue;
+	};
+
+	struct ObjectRecord {
+		// Detached copy of the object state.
+		SEditorObject snapshot;
+		size_t instanceIndex;
+	};
+
+	struct LinkChange {
+		SLink oldLink;
+		SLink newLink;
+	};
+
+	// Difference between an undo stack entry and its predecessor.
+	struct Delta {
+		std::vector<ObjectRecord> createdObjects;
+		std::vector<ObjectRecord> deletedObjects;
+		// Objects with changed object annotations are stored completely.
+		std::vector<std::pair<SEditorObject, SEditorObject>> replacedObjects;
+		std::vector<ValueDelta> changedValues;
+
+		std::vector<SLink> addedLinks;
+		std::vector<SLink> removedLinks;
+		std::vector<LinkChange> changedLinks;
+
+		// Only filled if the order of the instances changed beyond creation and deletion of objects.
+		std::vector<std::string> oldInstanceOrder;
+		std::vector<std::string> newInstanceOrder;
+
+		bool externalProjectsMapChanged = false;
+		std::map<std::string, serialization::ExternalProjectInfo> oldExternalProjectsMap;
+		std::map<std::string, serialization::ExternalProjectInfo> newExternalProjectsMap;
+	};
+
+	void restoreProjectStateChanges(Project *src, Project *dest, BaseContext &context, UserObjectFactoryInterface &factory, DataChangeRecorder &changes, bool &extrefDirty);
+	void finishRestore(Project *dest, DataChangeRecorder &changes, bool extrefDirty);
+
+	void computeDelta(const Project *src, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory, Delta &outDelta);
+	void mergeDelta(const Project *src, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory, Delta &delta);
+	void applyDelta(const Delta &delta, bool forward, Project *dest, BaseContext &context, UserObjectFactoryInterface &factory, DataChangeRecorder &changes, bool &extrefDirty);
+	void setIndexDelta(size_t newIndex, bool force);
+	void updateMemoryFootprint(bool merged);
+	void evictEntries();
+	void syncMirror(const Project *src, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory);
+	void resetMirror();
+
 	BaseContext *context_;
 	Callback onChange_;
+	StorageMode mode_;
 
 	struct Entry {
 		Entry(std::string description = std::string(), std::string mergeId = std::string());
 		std::string description;
 		std::string mergeId;
+		// Only used in StorageMode::Snapshot
 		Project state;
+		// Only used in StorageMode::Delta
+		Delta delta;
+
+		size_t memoryFootprint = 0;
+		// Estimated size of the objects in state which are not shared with the previous entry.
+		// Only used in StorageMode::Snapshot
+		std::map<std::string, size_t> ownedObjectSizes;
 	};
 
 	std::vector<std::unique_ptr<Entry>> stack_;
 	size_t index_ = 0;
 	size_t depth_ = 0;
+
+	size_t maxEntries_ = 0;
+	size_t maxMemoryBytes_ = 0;
+
+	// Copy of the project state at the current stack index. Only used in StorageMode::Delta.
+	std::unique_ptr<Project> mirror_;
 };
 
 }  // namespace raco::core
\ No newline at end of file
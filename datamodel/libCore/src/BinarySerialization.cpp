@@ -0,0 +1,456 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "core/BinarySerialization.h"
+
+#include "core/SerializationKeys.h"
+#include "utils/ParallelUtils.h"
+
+#include <QJsonArray>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace raco::serialization {
+
+namespace {
+
+constexpr std::string_view BINARY_PROJECT_MAGIC{"RCAB"};
+
+// Minimum number of objects decoded per worker thread.
+constexpr size_t PARALLEL_DECODE_RANGE_SIZE = 256;
+
+enum class Tag : uint8_t {
+	Null = 0,
+	False = 1,
+	True = 2,
+	Int32 = 3,
+	Double = 4,
+	String = 5,
+	NumberArray = 6,
+	Array = 7,
+	Object = 8
+};
+
+class BinaryWriter {
+public:
+	std::string encode(const QJsonDocument& document) {
+		if (document.isArray()) {
+			writeArray(document.array());
+		} else {
+			writeObject(document.object());
+		}
+
+		std::string result;
+		result.reserve(BINARY_PROJECT_MAGIC.size() + 8 + stringTableSize_ + body_.size());
+		result.append(BINARY_PROJECT_MAGIC);
+		appendUInt32(result, BINARY_PROJECT_FORMAT_VERSION);
+		appendUInt32(result, static_cast<uint32_t>(strings_.size()));
+		for (const auto& str : strings_) {
+			appendUInt32(result, static_cast<uint32_t>(str.size()));
+			result.append(str);
+		}
+		result.append(body_);
+		return result;
+	}
+
+private:
+	static void appendUInt32(std::string& buffer, uint32_t value) {
+		for (int byte = 0; byte < 4; byte++) {
+			buffer.push_back(static_cast<char>((value >> (8 * byte)) & 0xff));
+		}
+	}
+
+	static void appendDouble(std::string& buffer, double value) {
+		uint64_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		for (int byte = 0; byte < 8; byte++) {
+			buffer.push_back(static_cast<char>((bits >> (8 * byte)) & 0xff));
+		}
+	}
+
+	void writeTag(Tag tag) {
+		body_.push_back(static_cast<char>(tag));
+	}
+
+	void writeStringIndex(const QString& str) {
+		auto utf8 = str.toStdString();
+		auto it = stringIndices_.find(utf8);
+		if (it == stringIndices_.end()) {
+			it = stringIndices_.emplace(utf8, static_cast<uint32_t>(strings_.size())).first;
+			stringTableSize_ += 4 + utf8.size();
+			strings_.emplace_back(std::move(utf8));
+		}
+		appendUInt32(body_, it->second);
+	}
+
+	// Reserve space for the byte size of a container; returns the position to be passed to finishSizePrefix.
+	size_t beginSizePrefix() {
+		auto position = body_.size();
+		appendUInt32(body_, 0);
+		return position;
+	}
+
+	void finishSizePrefix(size_t position) {
+		auto size = static_cast<uint32_t>(body_.size() - position - 4);
+		for (int byte = 0; byte < 4; byte++) {
+			body_[position + byte] = static_cast<char>((size >> (8 * byte)) & 0xff);
+		}
+	}
+
+	void writeNumber(double value) {
+		if (std::trunc(value) == value && value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max() && !(value == 0.0 && std::signbit(value))) {
+			writeTag(Tag::Int32);
+			appendUInt32(body_, static_cast<uint32_t>(static_cast<int32_t>(value)));
+		} else {
+			writeTag(Tag::Double);
+			appendDouble(body_, value);
+		}
+	}
+
+	void writeArray(const QJsonArray& array) {
+		bool allNumbers = array.size() > 1 && std::all_of(array.begin(), array.end(), [](const QJsonValue& value) {
+			return value.isDouble();
+		});
+		if (allNumbers) {
+			writeTag(Tag::NumberArray);
+			appendUInt32(body_, static_cast<uint32_t>(array.size()));
+			for (const auto& value : array) {
+				appendDouble(body_, value.toDouble());
+			}
+			return;
+		}
+
+		writeTag(Tag::Array);
+		auto sizePosition = beginSizePrefix();
+		appendUInt32(body_, static_cast<uint32_t>(array.size()));
+		for (const auto& value : array) {
+			writeValue(value);
+		}
+		finishSizePrefix(sizePosition);
+	}
+
+	void writeObject(const QJsonObject& object) {
+		writeTag(Tag::Object);
+		auto sizePosition = beginSizePrefix();
+		appendUInt32(body_, static_cast<uint32_t>(object.size()));
+		for (auto it = object.begin(); it != object.end(); ++it) {
+			writeStringIndex(it.key());
+			writeValue(it.value());
+		}
+		finishSizePrefix(sizePosition);
+	}
+
+	void writeValue(const QJsonValue& value) {
+		switch (value.type()) {
+			case QJsonValue::Null:
+			case QJsonValue::Undefined:
+				writeTag(Tag::Null);
+				break;
+			case QJsonValue::Bool:
+				writeTag(value.toBool() ? Tag::True : Tag::False);
+				break;
+			case QJsonValue::Double:
+				writeNumber(value.toDouble());
+				break;
+			case QJsonValue::String:
+				writeTag(Tag::String);
+				writeStringIndex(value.toString());
+				break;
+			case QJsonValue::Array:
+				writeArray(value.toArray());
+				break;
+			case QJsonValue::Object:
+				writeObject(value.toObject());
+				break;
+		}
+	}
+
+	std::string body_;
+	std::vector<std::string> strings_;
+	std::unordered_map<std::string, uint32_t> stringIndices_;
+	size_t stringTableSize_ = 0;
+};
+
+class BinaryReader {
+public:
+	BinaryReader(std::string_view data, const std::vector<QString>& strings, size_t position) : data_(data), strings_(strings), position_(position) {
+	}
+
+	size_t position() const {
+		return position_;
+	}
+
+	Tag readTag() {
+		auto tag = static_cast<uint8_t>(read(1)[0]);
+		if (tag > static_cast<uint8_t>(Tag::Object)) {
+			throw std::runtime_error(fmt::format("Invalid binary project: unknown value tag {} at offset {}", tag, position_ - 1));
+		}
+		return static_cast<Tag>(tag);
+	}
+
+	uint32_t readUInt32() {
+		auto bytes = read(4);
+		uint32_t value = 0;
+		for (int byte = 0; byte < 4; byte++) {
+			value |= static_cast<uint32_t>(static_cast<uint8_t>(bytes[byte])) << (8 * byte);
+		}
+		return value;
+	}
+
+	double readDouble() {
+		auto bytes = read(8);
+		uint64_t bits = 0;
+		for (int byte = 0; byte < 8; byte++) {
+			bits |= static_cast<uint64_t>(static_cast<uint8_t>(bytes[byte])) << (8 * byte);
+		}
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	const QString& readString() {
+		auto index = readUInt32();
+		if (index >= strings_.size()) {
+			throw std::runtime_error(fmt::format("Invalid binary project: string index {} out of range", index));
+		}
+		return strings_[index];
+	}
+
+	QJsonValue readValue() {
+		return readValue(readTag());
+	}
+
+	QJsonValue readValue(Tag tag) {
+		switch (tag) {
+			case Tag::Null:
+				return QJsonValue(QJsonValue::Null);
+			case Tag::False:
+				return false;
+			case Tag::True:
+				return true;
+			case Tag::Int32:
+				return static_cast<int>(static_cast<int32_t>(readUInt32()));
+			case Tag::Double:
+				return readDouble();
+			case Tag::String:
+				return readString();
+			case Tag::NumberArray: {
+				auto count = readUInt32();
+				QJsonArray array;
+				for (uint32_t index = 0; index < count; index++) {
+					array.append(readDouble());
+				}
+				return array;
+			}
+			case Tag::Array: {
+				readUInt32();
+				auto count = readUInt32();
+				QJsonArray array;
+				for (uint32_t index = 0; index < count; index++) {
+					array.append(readValue());
+				}
+				return array;
+			}
+			case Tag::Object: {
+				readUInt32();
+				auto count = readUInt32();
+				QJsonObject object;
+				for (uint32_t index = 0; index < count; index++) {
+					const auto& key = readString();
+					object.insert(key, readValue());
+				}
+				return object;
+			}
+		}
+		return {};
+	}
+
+	// Skip a value using the size prefixes without decoding it.
+	void skipValue() {
+		switch (readTag()) {
+			case Tag::Null:
+			case Tag::False:
+			case Tag::True:
+				break;
+			case Tag::Int32:
+			case Tag::String:
+				read(4);
+				break;
+			case Tag::Double:
+				read(8);
+				break;
+			case Tag::NumberArray:
+				read(8 * static_cast<size_t>(readUInt32()));
+				break;
+			case Tag::Array:
+			case Tag::Object:
+				read(readUInt32());
+				break;
+		}
+	}
+
+private:
+	const char* read(size_t size) {
+		if (size > data_.size() - position_) {
+			throw std::runtime_error("Invalid binary project: unexpected end of data");
+		}
+		auto result = data_.data() + position_;
+		position_ += size;
+		return result;
+	}
+
+	std::string_view data_;
+	const std::vector<QString>& strings_;
+	size_t position_;
+};
+
+// Check the file header and read the string table. Returns the position of the root value.
+size_t readStringTable(std::string_view data, std::vector<QString>& outStrings) {
+	if (!isBinaryProject(data)) {
+		throw std::runtime_error("Invalid binary project: wrong file signature");
+	}
+	std::vector<QString> noStrings;
+	BinaryReader reader(data, noStrings, BINARY_PROJECT_MAGIC.size());
+	auto formatVersion = reader.readUInt32();
+	if (formatVersion != BINARY_PROJECT_FORMAT_VERSION) {
+		throw std::runtime_error(fmt::format("Invalid binary project: unsupported format version {}", formatVersion));
+	}
+	auto count = reader.readUInt32();
+	outStrings.clear();
+	outStrings.reserve(count);
+	auto position = reader.position();
+	for (uint32_t index = 0; index < count; index++) {
+		BinaryReader lengthReader(data, noStrings, position);
+		auto length = lengthReader.readUInt32();
+		position = lengthReader.position();
+		if (length > data.size() - position) {
+			throw std::runtime_error("Invalid binary project: unexpected end of data");
+		}
+		outStrings.emplace_back(QString::fromUtf8(data.data() + position, static_cast<int>(length)));
+		position += length;
+	}
+	return position;
+}
+
+}  // namespace
+
+bool isBinaryProject(std::string_view data) {
+	return data.size() >= BINARY_PROJECT_MAGIC.size() && data.substr(0, BINARY_PROJECT_MAGIC.size()) == BINARY_PROJECT_MAGIC;
+}
+
+std::string convertJsonToBinary(const QJsonDocument& document) {
+	return BinaryWriter().encode(document);
+}
+
+QJsonDocument convertBinaryToJson(std::string_view data) {
+	std::vector<QString> strings;
+	BinaryReader reader(data, strings, readStringTable(data, strings));
+	auto value = reader.readValue();
+	if (value.isArray()) {
+		return QJsonDocument(value.toArray());
+	}
+	if (!value.isObject()) {
+		throw std::runtime_error("Invalid binary project: root value is not an object");
+	}
+	return QJsonDocument(value.toObject());
+}
+
+BinaryProjectContent decodeBinaryProject(std::string_view data, const ProjectObjectSelection* selection) {
+	std::vector<QString> strings;
+	BinaryReader reader(data, strings, readStringTable(data, strings));
+	if (reader.readTag() != Tag::Object) {
+		throw std::runtime_error("Invalid binary project: root value is not an object");
+	}
+	reader.readUInt32();
+
+	BinaryProjectContent content;
+	QJsonObject header;
+
+	// Decode the elements of a top-level array in parallel. The element positions are found by skipping
+	// over the size-prefixed elements first.
+	auto decodeArray = [&data, &strings, &reader](const std::vector<bool>* selected, std::vector<QJsonObject>& outObjects) {
+		auto tag = reader.readTag();
+		if (tag == Tag::Null) {
+			return;
+		}
+		if (tag != Tag::Array) {
+			throw std::runtime_error("Invalid binary project: object list is not an array");
+		}
+		reader.readUInt32();
+		auto count = reader.readUInt32();
+		if (selected && selected->size() != count) {
+			throw std::runtime_error("Object selection doesn't match binary project");
+		}
+		std::vector<size_t> positions;
+		positions.reserve(count);
+		for (uint32_t index = 0; index < count; index++) {
+			if (!selected || (*selected)[index]) {
+				positions.emplace_back(reader.position());
+			}
+			reader.skipValue();
+		}
+
+		outObjects.resize(positions.size());
+		utils::parallel::parallelFor(positions.size(), PARALLEL_DECODE_RANGE_SIZE, [&data, &strings, &positions, &outObjects](size_t begin, size_t end) {
+			for (auto index = begin; index < end; index++) {
+				BinaryReader elementReader(data, strings, positions[index]);
+				auto value = elementReader.readValue();
+				if (!value.isObject()) {
+					throw std::runtime_error("Invalid binary project: array element is not an object");
+				}
+				outObjects[index] = value.toObject();
+			}
+		});
+	};
+
+	auto count = reader.readUInt32();
+	for (uint32_t index = 0; index < count; index++) {
+		const auto& key = reader.readString();
+		if (key == keys::INSTANCES) {
+			decodeArray(selection ? &selection->instances : nullptr, content.instances);
+		} else if (key == keys::LINKS) {
+			decodeArray(selection ? &selection->links : nullptr, content.links);
+		} else {
+			header.insert(key, reader.readValue());
+		}
+	}
+	content.header = QJsonDocument(header);
+	return content;
+}
+
+QJsonDocument decodeBinaryProjectHeader(std::string_view data) {
+	std::vector<QString> strings;
+	BinaryReader reader(data, strings, readStringTable(data, strings));
+	if (reader.readTag() != Tag::Object) {
+		throw std::runtime_error("Invalid binary project: root value is not an object");
+	}
+	reader.readUInt32();
+
+	QJsonObject header;
+	auto count = reader.readUInt32();
+	for (uint32_t index = 0; index < count; index++) {
+		const auto& key = reader.readString();
+		if (key == keys::INSTANCES || key == keys::LINKS) {
+			reader.skipValue();
+		} else {
+			header.insert(key, reader.readValue());
+		}
+	}
+	return QJsonDocument(header);
+}
+
+}  // namespace raco::serialization
@@ -124,6 +124,19 @@ DataChangeRecorder DataChangeRecorder::release() {
 	return copy;
 }
 
+bool DataChangeRecorder::empty() const {
+	return createdObjects_.empty() &&
+		   deletedObjects_.empty() &&
+		   changedValues_.empty() &&
+		   changedErrors_.empty() &&
+		   previewDirty_.empty() &&
+		   addedLinks_.savedLinks().empty() &&
+		   removedLinks_.savedLinks().empty() &&
+		   changedValidityLinks_.savedLinks().empty() &&
+		   !externalProjectMapChanged_ &&
+		   !rootOrderChanged_;
+}
+
 void DataChangeRecorder::recordCreateObject(SEditorObject const& object) {
 	createdObjects_.insert(object);
 }
@@ -132,7 +132,7 @@ void CommandInterface::set(ValueHandle const& handle, bool const& value) {
 	if (checkScalarHandleForSet(handle, PrimitiveType::Bool, true) && handle.asBool() != value) {
 		context_->set(handle, value);
 		if (!handle.query<VolatileProperty>()) {
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to {}", handle.getPropertyPath(), value),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -163,7 +163,7 @@ void CommandInterface::set(ValueHandle const& handle, int const& value) {
 
 		context_->set(handle, value);
 		if (!handle.query<VolatileProperty>()) {
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to {}", handle.getPropertyPath(), value),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -192,7 +192,7 @@ void CommandInterface::set(const std::set<ValueHandle>& handles, int value) {
 				context_->set(handle, value);
 			}
 		}
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 
 		undoStack_->push(fmt::format("Set property '{}' to {}", Queries::getPropertyPath(handles), value), getMergeId(handles));
 	}
@@ -202,7 +202,7 @@ void CommandInterface::set(ValueHandle const& handle, int64_t const& value) {
 	if (checkScalarHandleForSet(handle, PrimitiveType::Int64, true) && handle.asInt64() != value) {
 		context_->set(handle, value);
 		if (!handle.query<VolatileProperty>()) {
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to {}", handle.getPropertyPath(), value),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -221,7 +221,7 @@ void CommandInterface::set(const std::set<ValueHandle>& handles, int64_t value)
 				context_->set(handle, value);
 			}
 		}
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 
 		undoStack_->push(fmt::format("Set property '{}' to {}", Queries::getPropertyPath(handles), value), getMergeId(handles));
 	}
@@ -231,7 +231,7 @@ void CommandInterface::set(ValueHandle const& handle, double const& value) {
 	if (checkScalarHandleForSet(handle, PrimitiveType::Double, true) && handle.asDouble() != value) {
 		context_->set(handle, value);
 		if (!handle.query<VolatileProperty>()) {
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to {}", handle.getPropertyPath(), value),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -250,7 +250,7 @@ void CommandInterface::set(const std::set<ValueHandle>& handles, double const& v
 				context_->set(handle, value);
 			}
 		}
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 
 		undoStack_->push(fmt::format("Set property '{}' to {}", Queries::getPropertyPath(handles), value), getMergeId(handles));
 	}
@@ -263,7 +263,7 @@ void CommandInterface::set(ValueHandle const& handle, std::string const& value)
 		if (handle.asString() != newValue) {
 			context_->set(handle, newValue);
 			if (!handle.query<VolatileProperty>()) {
-				PrefabOperations::globalPrefabUpdate(*context_);
+				updatePrefabs();
 				undoStack_->push(fmt::format("Set property '{}' to {}", handle.getPropertyPath(), newValue),
 					fmt::format("{}", handle.getPropertyPath(true)));
 			}
@@ -278,7 +278,7 @@ void CommandInterface::set(ValueHandle const& handle, SEditorObject const& value
 		}
 
 		context_->set(handle, value);
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 		undoStack_->push(fmt::format("Set property '{}' to {}", handle.getPropertyPath(),
 			value ? value->objectName() : "<None>"));
 	}
@@ -292,7 +292,7 @@ void CommandInterface::set(ValueHandle const& handle, std::array<double, 2> cons
 		}
 		if (handle.asVec2f() != value) {
 			context_->set(handle, value);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to ({}, {})", handle.getPropertyPath(), value[0], value[1]),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -306,7 +306,7 @@ void CommandInterface::set(ValueHandle const& handle, std::array<double, 3> cons
 		}
 		if (handle.asVec3f() != value) {
 			context_->set(handle, value);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to ({}, {}, {})", handle.getPropertyPath(), value[0], value[1], value[2]),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -320,7 +320,7 @@ void CommandInterface::set(ValueHandle const& handle, std::array<double, 4> cons
 		}
 		if (handle.asVec4f() != value) {
 			context_->set(handle, value);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to ({}, {}, {}, {})", handle.getPropertyPath(), value[0], value[1], value[2], value[3]),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -334,7 +334,7 @@ void CommandInterface::set(ValueHandle const& handle, std::array<int, 2> const&
 		}
 		if (handle.asVec2i() != value) {
 			context_->set(handle, value);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to ({}, {})", handle.getPropertyPath(), value[0], value[1]),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -348,7 +348,7 @@ void CommandInterface::set(ValueHandle const& handle, std::array<int, 3> const&
 		}
 		if (handle.asVec3i() != value) {
 			context_->set(handle, value);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to ({}, {}, {})", handle.getPropertyPath(), value[0], value[1], value[2]),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -362,7 +362,7 @@ void CommandInterface::set(ValueHandle const& handle, std::array<int, 4> const&
 		}
 		if (handle.asVec4i() != value) {
 			context_->set(handle, value);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set property '{}' to ({}, {}, {}, {})", handle.getPropertyPath(), value[0], value[1], value[2], value[3]),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -405,7 +405,7 @@ void CommandInterface::setTags(ValueHandle const& handle, std::vector<std::strin
 
 		if (handle.constValueRef()->asTable().asVector<std::string>() != value) {
 			context_->set(handle, value);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set tag set property '{}' to {}", handle.getPropertyPath(), value),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -457,7 +457,7 @@ void CommandInterface::setRenderableTags(ValueHandle const& handle, std::vector<
 
 		if (!(handle.constValueRef()->asTable() == table)) {
 			context_->set(handle, table);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Set renderable tag property '{}'", handle.getPropertyPath()),
 				fmt::format("{}", handle.getPropertyPath(true)));
 		}
@@ -476,7 +476,7 @@ void CommandInterface::resizeArray(const ValueHandle& handle, size_t newSize) {
 
 		if (newSize != handle.size()) {
 			context_->resizeArray(handle, newSize);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Resize array property '{}' to size {}.", handle.getPropertyPath(), newSize));
 		}
 	}
@@ -491,7 +491,7 @@ SEditorObject CommandInterface::createObject(std::string type, std::string name,
 		if (parent) {
 			context_->moveScenegraphChildren(Queries::filterForMoveableScenegraphChildren(*project(), {newObject}, parent), parent);
 		}
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 		undoStack_->push(fmt::format("Create '{}' object '{}'", type, name));
 		return newObject;
 	} else {
@@ -510,7 +510,7 @@ size_t CommandInterface::deleteObjects(std::vector<SEditorObject> const& objects
 	auto deletableObjects = Queries::filterForDeleteableObjects(*project(), objects);
 	if (!deletableObjects.empty()) {
 		auto numDeleted = context_->deleteObjects(deletableObjects);
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 		undoStack_->push(fmt::format("Delete {} objects", numDeleted));
 		return numDeleted;
 	}
@@ -540,7 +540,7 @@ size_t CommandInterface::moveScenegraphChildren(std::vector<SEditorObject> const
 
 	if (moveableChildren.size() > 0) {
 		context_->moveScenegraphChildren(moveableChildren, newParent, insertBeforeIndex);
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 		if (moveableChildren.size() == 1) {
 			undoStack_->push(fmt::format("Move object '{}' to new parent '{}' before index {}", moveableChildren.front()->objectName(),
 				newParent ? newParent->objectName() : "<root>",
@@ -561,7 +561,7 @@ void CommandInterface::insertAssetScenegraph(const core::MeshScenegraph& scenegr
 	}
 
 	context_->insertAssetScenegraph(scenegraph, absPath, parent);
-	PrefabOperations::globalPrefabUpdate(*context_);
+	updatePrefabs();
 	undoStack_->push(fmt::format("Inserted assets from {}", absPath));
 	PathManager::setCachedPath(core::PathManager::FolderTypeKeys::Mesh, utils::u8path(absPath).parent_path().string());
 }
@@ -585,7 +585,7 @@ std::string CommandInterface::cutObjects(const std::vector<SEditorObject>& objec
 	auto deletableObjects = Queries::filterForDeleteableObjects(*project(), objects);
 	if (!deletableObjects.empty()) {
 		auto result = context_->cutObjects(deletableObjects, deepCut);
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 		undoStack_->push(fmt::format("Cut {} objects with deep = {}", deletableObjects.size(), deepCut));
 		return result;
 	}
@@ -606,7 +606,7 @@ std::vector<SEditorObject> CommandInterface::pasteObjects(const std::string& val
 	// the project will remain unchanged in this case.
 	result = context_->pasteObjects(val, target, pasteAsExtref);
 
-	PrefabOperations::globalPrefabUpdate(*context_);
+	updatePrefabs();
 	undoStack_->push(fmt::format("Paste {} into '{}'",
 		pasteAsExtref ? std::string("as external reference") : std::string(),
 		target ? target->objectName() : "<root>"));
@@ -637,7 +637,7 @@ std::vector<SEditorObject> CommandInterface::duplicateObjects(const std::vector<
 		duplicatedObjs.emplace_back(duplicatedObj);
 	}
 
-	PrefabOperations::globalPrefabUpdate(*context_);
+	updatePrefabs();
 	undoStack_->push(fmt::format("Duplicate {} object{}", duplicatedObjs.size(), duplicatedObjs.size() > 1 ? "s" : ""));
 
 	return duplicatedObjs;
@@ -678,7 +678,7 @@ std::vector<SEditorObject> CommandInterface::convertToAnimationChannelRaco(const
 			racoChannels.emplace_back(racoChannel);
 		}
 
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 		undoStack_->push(fmt::format("Convert {} AnimationChannel{}", racoChannels.size(), racoChannels.size() > 1 ? "s" : ""));
 
 		return racoChannels;
@@ -761,7 +761,7 @@ void CommandInterface::setAnimationData(SEditorObject object, const std::vector<
 		}
 
 		animationChannel->setAnimationData(*context_, timeStamps, user_types::AnimationChannelRaco::makeAnimationOutputData(EnginePrimitive::Double, keyFrames, tangentsIn, tangentsOut));
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 
 		undoStack_->push(fmt::format("Set animation data for AnimationChannelRaco '{}'", object->objectName()));
 	}
@@ -776,7 +776,7 @@ void CommandInterface::setAnimationData(SEditorObject object, const std::vector<
 		}
 
 		animationChannel->setAnimationData(*context_, timeStamps, user_types::AnimationChannelRaco::makeAnimationOutputData(EnginePrimitive::Int32, keyFrames, tangentsIn, tangentsOut));
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 
 		undoStack_->push(fmt::format("Set animation data for AnimationChannelRaco '{}'", object->objectName()));
 	}
@@ -795,7 +795,7 @@ void CommandInterface::setAnimationData(SEditorObject object, const std::vector<
 		checkAnimationComponentSize(object, keyFrames, tangentsIn, tangentsOut);
 
 		animationChannel->setAnimationData(*context_, timeStamps, user_types::AnimationChannelRaco::makeAnimationOutputData(compType, keyFrames, tangentsIn, tangentsOut));
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 
 		undoStack_->push(fmt::format("Set animation data for AnimationChannelRaco '{}'", object->objectName()));
 	}
@@ -814,7 +814,7 @@ void CommandInterface::setAnimationData(SEditorObject object, const std::vector<
 		checkAnimationComponentSize(object, keyFrames, tangentsIn, tangentsOut);
 
 		animationChannel->setAnimationData(*context_, timeStamps, user_types::AnimationChannelRaco::makeAnimationOutputData(compType, keyFrames, tangentsIn, tangentsOut));
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 
 		undoStack_->push(fmt::format("Set animation data for AnimationChannelRaco '{}'", object->objectName()));
 	}
@@ -832,7 +832,7 @@ SLink CommandInterface::addLink(const ValueHandle& start, const ValueHandle& end
 
 	if (Queries::userCanCreateLink(*context_->project(), start, end, isWeak)) {
 		auto link = context_->addLink(start, end, isWeak);
-		PrefabOperations::globalPrefabUpdate(*context_);
+		updatePrefabs();
 		undoStack_->push(fmt::format("Create {} link from '{}' to '{}'", isWeak ? "weak" : "strong",
 			start.getPropertyPath(), end.getPropertyPath()));
 		return link;
@@ -851,7 +851,7 @@ void CommandInterface::removeLink(const PropertyDescriptor& end) {
 	if (auto link = Queries::getLink(*context_->project(), end)) {
 		if (Queries::userCanRemoveLink(*context_->project(), end)) {
 			context_->removeLink(end);
-			PrefabOperations::globalPrefabUpdate(*context_);
+			updatePrefabs();
 			undoStack_->push(fmt::format("Remove link ending on '{}'", end.getPropertyPath()));
 		} else {
 			throw std::runtime_error(fmt::format("Remove link {} failed: end object is read-only.", link));
@@ -867,6 +867,12 @@ size_t CommandInterface::deleteUnreferencedResources() {
 	return 0;
 }
 
+void CommandInterface::updatePrefabs() {
+	if (transactionDepth_ == 0) {
+		PrefabOperations::globalPrefabUpdate(*context_);
+	}
+}
+
 void CommandInterface::executeCompositeCommand(std::function<void()> compositeCommand, const std::string &description) {
 	undoStack_->beginCompositeCommand();
 	try {
@@ -878,4 +884,40 @@ void CommandInterface::executeCompositeCommand(std::function<void()> compositeCo
 	undoStack_->endCompositeCommand(description);
 }
 
+void CommandInterface::beginTransaction() {
+	undoStack_->beginCompositeCommand();
+	++transactionDepth_;
+}
+
+void CommandInterface::endTransaction(const std::string& description, bool abort) {
+	if (transactionDepth_ == 0) {
+		return;
+	}
+	--transactionDepth_;
+	if (transactionDepth_ == 0 && !abort) {
+		try {
+			PrefabOperations::globalPrefabUpdate(*context_);
+		} catch (const std::exception&) {
+			undoStack_->endCompositeCommand(description, true);
+			throw;
+		}
+	}
+	undoStack_->endCompositeCommand(description, abort);
+}
+
+void CommandInterface::executeTransaction(std::function<void()> transaction, const std::string& description) {
+	beginTransaction();
+	try {
+		transaction();
+	} catch (const std::exception&) {
+		endTransaction(description, true);
+		throw;
+	}
+	endTransaction(description);
+}
+
+int CommandInterface::transactionDepth() const {
+	return transactionDepth_;
+}
+
 }  // namespace raco::core
@@ -13,10 +13,53 @@ namespace raco::core {
 
 Errors::Errors(DataChangeRecorder* recorder) noexcept :	recorder_{ recorder } {}
 
+std::string Errors::topLevelPropertyName(const ValueHandle& handle) {
+	if (handle.isProperty()) {
+		return handle.rootObject()->name(handle.indices().front());
+	}
+	return {};
+}
+
+void Errors::addToIndex(const ErrorItem& error) {
+	auto handle = error.valueHandle();
+	errorsByCategory_[error.category()].insert(handle);
+	if (handle.isProperty()) {
+		errorsByProperty_[topLevelPropertyName(handle)].insert(handle);
+	}
+}
+
+void Errors::removeFromIndex(const ErrorItem& error) {
+	auto handle = error.valueHandle();
+	auto catIt = errorsByCategory_.find(error.category());
+	if (catIt != errorsByCategory_.end()) {
+		catIt->second.erase(handle);
+		if (catIt->second.empty()) {
+			errorsByCategory_.erase(catIt);
+		}
+	}
+	if (handle.isProperty()) {
+		auto propIt = errorsByProperty_.find(topLevelPropertyName(handle));
+		if (propIt != errorsByProperty_.end()) {
+			propIt->second.erase(handle);
+			if (propIt->second.empty()) {
+				errorsByProperty_.erase(propIt);
+			}
+		}
+	}
+}
+
 void Errors::addError(ErrorCategory category, ErrorLevel level, const ValueHandle& handle, const std::string& message) {
 	ErrorItem newError{category, level, handle, message};
-	if (!hasError(handle) || !(newError == getError(handle))) {
-		errors_[handle.rootObject()][handle] = newError;
+	auto& objErrors = errors_[handle.rootObject()];
+	auto it = objErrors.find(handle);
+	if (it == objErrors.end()) {
+		objErrors.emplace(handle, newError);
+		addToIndex(newError);
+		recorder_->recordErrorChanged(handle);
+	} else if (!(it->second == newError)) {
+		removeFromIndex(it->second);
+		it->second = newError;
+		addToIndex(newError);
 		recorder_->recordErrorChanged(handle);
 	}
 }
@@ -62,6 +105,7 @@ bool Errors::removeError(const ValueHandle& handle) {
 		auto& cont = objIt->second;
 		auto const it = cont.find(handle);
 		if (it != cont.end()) {
+			removeFromIndex(it->second);
 			cont.erase(it);
 			if (cont.empty()) {
 				errors_.erase(objIt);
@@ -112,6 +156,7 @@ bool Errors::removeAll(const SCEditorObject& object) {
 	if (objIt != errors_.end()) {
 		auto& cont = objIt->second;
 		for (const auto& [handle, item] : cont) {
+			removeFromIndex(item);
 			recorder_->recordErrorChanged(handle);
 		}
 		errors_.erase(objIt);
@@ -120,15 +165,87 @@ bool Errors::removeAll(const SCEditorObject& object) {
 	return false;
 }
 
-// TODO this is inefficient, don't use
+bool Errors::removeAll(ErrorCategory category) {
+	return removeIf(category, [](const ErrorItem&) {
+		return true;
+	});
+}
+
+bool Errors::removeContained(const ValueHandle& parent) {
+	auto const objIt = errors_.find(parent.rootObject());
+	if (objIt == errors_.end()) {
+		return false;
+	}
+	// Handles are ordered by object and then lexicographically by their property indices, so all handles
+	// nested inside the parent directly follow the parent itself.
+	bool changed = false;
+	auto& cont = objIt->second;
+	auto it = cont.upper_bound(parent);
+	while (it != cont.end() && parent.contains(it->first)) {
+		removeFromIndex(it->second);
+		recorder_->recordErrorChanged(it->first);
+		it = cont.erase(it);
+		changed = true;
+	}
+	if (cont.empty()) {
+		errors_.erase(objIt);
+	}
+	return changed;
+}
+
+bool Errors::removeIf(ErrorCategory category, const std::function<bool(const ErrorItem&)>& predicate) {
+	auto catIt = errorsByCategory_.find(category);
+	if (catIt == errorsByCategory_.end()) {
+		return false;
+	}
+	std::vector<ValueHandle> matching;
+	for (const auto& handle : catIt->second) {
+		if (predicate(getError(handle))) {
+			matching.emplace_back(handle);
+		}
+	}
+	for (const auto& handle : matching) {
+		removeError(handle);
+	}
+	return !matching.empty();
+}
+
+void Errors::replaceErrors(std::set<ValueHandle> oldHandles, const std::vector<ErrorItem>& newErrors) {
+	std::set<ValueHandle> newHandles;
+	for (const auto& error : newErrors) {
+		newHandles.insert(error.valueHandle());
+	}
+	for (const auto& handle : oldHandles) {
+		if (newHandles.find(handle) == newHandles.end()) {
+			removeError(handle);
+		}
+	}
+	for (const auto& error : newErrors) {
+		addError(error.category(), error.level(), error.valueHandle(), error.message());
+	}
+}
+
+const std::set<ValueHandle>& Errors::getErrorHandles(ErrorCategory category) const {
+	static const std::set<ValueHandle> empty;
+	auto it = errorsByCategory_.find(category);
+	return it != errorsByCategory_.end() ? it->second : empty;
+}
+
+const std::set<ValueHandle>& Errors::getPropertyErrorHandles(const std::string& propertyName) const {
+	static const std::set<ValueHandle> empty;
+	auto it = errorsByProperty_.find(propertyName);
+	return it != errorsByProperty_.end() ? it->second : empty;
+}
+
 bool Errors::removeIf(const std::function<bool(ErrorItem const&)>& predicate) {
-	bool changed = true;
+	bool changed = false;
 	auto objIt = errors_.begin();
 	while (objIt != errors_.end()) {
 		auto& cont = objIt->second;
 		auto it = cont.begin();
 		while (it != cont.end()) {
 			if (predicate(it->second)) {
+				removeFromIndex(it->second);
 				recorder_->recordErrorChanged(it->first);
 				it = cont.erase(it);
 				changed = true;
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cassert>
 #include <map>
+#include <set>
 #include <string>
 
 namespace raco::core {
@@ -130,6 +131,24 @@ void collectExternalObjects(Project* project, const ExternalObjectDescriptor& de
 	}
 };
 
+// Sets the required external objects of a LoadContext for the lifetime of the scope.
+// Nested external reference updates of external projects loaded while the scope is active set their own requirements.
+class RequiredExternalObjectsScope {
+public:
+	RequiredExternalObjectsScope(LoadContext& loadContext, std::map<std::string, std::set<std::string>> requiredExternalObjects)
+		: loadContext_(loadContext), outerRequiredExternalObjects_(std::move(loadContext.requiredExternalObjects)) {
+		loadContext_.requiredExternalObjects = std::move(requiredExternalObjects);
+	}
+
+	~RequiredExternalObjectsScope() {
+		loadContext_.requiredExternalObjects = std::move(outerRequiredExternalObjects_);
+	}
+
+private:
+	LoadContext& loadContext_;
+	std::optional<std::map<std::string, std::set<std::string>>> outerRequiredExternalObjects_;
+};
+
 SLink lookupLink(SLink srcLink, const std::map<std::string, std::set<SLink>>& destLinks) {
 	auto it = destLinks.find((*srcLink->endObject_)->objectID());
 	if (it != destLinks.end()) {
@@ -182,7 +201,17 @@ void ExtrefOperations::updateExternalObjects(BaseContext& context, Project* proj
 	// walk tree following all references but use objects from correct external project when following references.
 	std::map<std::string, ExternalObjectDescriptor> externalObjects;
 
+	// Announce the top-level objects we need from each external project.
+	std::map<std::string, std::set<std::string>> requiredExternalObjects;
+	for (const auto& [id, object] : localObjects) {
+		auto projectID = *object->query<ExternalReferenceAnnotation>()->projectID_;
+		if (object->getParent() == nullptr && project->hasExternalProjectMapping(projectID)) {
+			requiredExternalObjects[project->lookupExternalProjectPath(projectID)].insert(id);
+		}
+	}
+
 	try {
+		RequiredExternalObjectsScope requiredObjectsScope(loadContext, std::move(requiredExternalObjects));
 		for (const auto& [id, object] : localObjects) {
 			if (object->getParent() == nullptr) {
 				collectExternalObjects(project, ExternalObjectDescriptor{object, project}, externalProjectsStore, externalObjects, loadContext, true);
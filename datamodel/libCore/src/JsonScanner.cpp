@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "core/JsonScanner.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <stdexcept>
+
+namespace raco::serialization {
+
+JsonScanner::JsonScanner(std::istream& stream) : buffer_(stream.rdbuf()), stream_(stream) {
+	offset_ = stream.tellg();
+	if (offset_ < 0) {
+		offset_ = 0;
+	}
+}
+
+int JsonScanner::get() {
+	int c = buffer_->sbumpc();
+	if (c == std::char_traits<char>::eof()) {
+		throw std::runtime_error(fmt::format("Unexpected end of JSON input at offset {}", offset_));
+	}
+	++offset_;
+	return c;
+}
+
+int JsonScanner::peekNonWhitespace() {
+	while (true) {
+		int c = buffer_->sgetc();
+		if (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+			buffer_->sbumpc();
+			++offset_;
+		} else {
+			return c;
+		}
+	}
+}
+
+void JsonScanner::expect(char c) {
+	if (peekNonWhitespace() != c) {
+		throw std::runtime_error(fmt::format("Invalid JSON input at offset {}: expected '{}'", offset_, c));
+	}
+	get();
+}
+
+void JsonScanner::beginObject() {
+	expect('{');
+	first_.push_back(true);
+}
+
+bool JsonScanner::nextKey(std::string& outKey) {
+	if (first_.empty()) {
+		throw std::runtime_error("JSON scanner: nextKey called outside of object");
+	}
+	if (peekNonWhitespace() == '}') {
+		get();
+		first_.pop_back();
+		return false;
+	}
+	if (!first_.back()) {
+		expect(',');
+	}
+	first_.back() = false;
+	if (peekNonWhitespace() != '"') {
+		throw std::runtime_error(fmt::format("Invalid JSON input at offset {}: expected object key", offset_));
+	}
+	outKey.clear();
+	scanString(&outKey);
+	// Remove quotes
+	outKey = outKey.substr(1, outKey.size() - 2);
+	expect(':');
+	return true;
+}
+
+void JsonScanner::beginArray() {
+	expect('[');
+	first_.push_back(true);
+}
+
+bool JsonScanner::nextElement() {
+	if (first_.empty()) {
+		throw std::runtime_error("JSON scanner: nextElement called outside of array");
+	}
+	if (peekNonWhitespace() == ']') {
+		get();
+		first_.pop_back();
+		return false;
+	}
+	if (!first_.back()) {
+		expect(',');
+	}
+	first_.back() = false;
+	return true;
+}
+
+void JsonScanner::skipValue() {
+	scanValue(nullptr);
+}
+
+void JsonScanner::readRawValue(std::string& outValue) {
+	outValue.clear();
+	scanValue(&outValue);
+}
+
+std::streamoff JsonScanner::offset() const {
+	return offset_;
+}
+
+void JsonScanner::seek(std::streamoff offset) {
+	stream_.clear();
+	stream_.seekg(offset);
+	if (!stream_) {
+		throw std::runtime_error(fmt::format("JSON scanner: can't seek to offset {}", offset));
+	}
+	offset_ = offset;
+	first_.clear();
+}
+
+void JsonScanner::scanString(std::string* out) {
+	// Opening quote
+	auto c = get();
+	if (out) {
+		out->push_back(static_cast<char>(c));
+	}
+	while (true) {
+		c = get();
+		if (out) {
+			out->push_back(static_cast<char>(c));
+		}
+		if (c == '\\') {
+			c = get();
+			if (out) {
+				out->push_back(static_cast<char>(c));
+			}
+		} else if (c == '"') {
+			return;
+		}
+	}
+}
+
+void JsonScanner::scanValue(std::string* out) {
+	int c = peekNonWhitespace();
+	if (c == '"') {
+		scanString(out);
+		return;
+	}
+
+	if (c == '{' || c == '[') {
+		// Only the bracket nesting is tracked here; strings are skipped as a whole since they may contain brackets.
+		int depth = 0;
+		do {
+			c = buffer_->sgetc();
+			if (c == '"') {
+				scanString(out);
+				continue;
+			}
+			c = get();
+			if (out) {
+				out->push_back(static_cast<char>(c));
+			}
+			if (c == '{' || c == '[') {
+				++depth;
+			} else if (c == '}' || c == ']') {
+				--depth;
+			}
+		} while (depth > 0);
+		return;
+	}
+
+	// Number, true, false or null
+	bool empty = true;
+	while (true) {
+		c = buffer_->sgetc();
+		if (c == std::char_traits<char>::eof() || c == ',' || c == '}' || c == ']' || c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+			break;
+		}
+		get();
+		if (out) {
+			out->push_back(static_cast<char>(c));
+		}
+		empty = false;
+	}
+	if (empty) {
+		throw std::runtime_error(fmt::format("Invalid JSON input at offset {}: expected value", offset_));
+	}
+}
+
+}  // namespace raco::serialization
@@ -116,12 +116,12 @@ SLink lookupLink(SLink srcLink, const std::map<std::string, std::set<SLink>>& de
 // - selective update of single properties according to the changerecorder entries for the prefab subtree
 // - change recorder will be used as input for the dirty parts of the prefab and output for the changes in
 //   the prefab instance and its children
-void PrefabOperations::updatePrefabInstance(BaseContext& context, const SPrefab& prefab, SPrefabInstance instance, bool instanceDirty, bool propagateMissingInterfaceProperties) {
+bool PrefabOperations::updatePrefabInstance(BaseContext& context, const SPrefab& prefab, SPrefabInstance instance, bool instanceDirty, bool propagateMissingInterfaceProperties) {
 	using namespace raco::core;
 	DataChangeRecorder localChanges;
 
 	if (instance->query<ExternalReferenceAnnotation>()) {
-		return;
+		return false;
 	}
 
 	std::unordered_set<SEditorObject> prefabChildren;
@@ -173,6 +173,8 @@ void PrefabOperations::updatePrefabInstance(BaseContext& context, const SPrefab&
 
 
 	// Delete prefab instance children who don't have corresponding prefab children
+	// The deletion is not recorded in localChanges, so remember it for the return value.
+	bool removedChildren = false;
 	{
 		std::vector<SEditorObject> toRemove;
 		auto it = instanceChildren.begin();
@@ -190,6 +192,7 @@ void PrefabOperations::updatePrefabInstance(BaseContext& context, const SPrefab&
 				++it;
 			}
 		}
+		removedChildren = !toRemove.empty();
 		context.deleteObjects(toRemove, true, false);
 	}
 
@@ -342,15 +345,22 @@ void PrefabOperations::updatePrefabInstance(BaseContext& context, const SPrefab&
 	// Sync from external files for new or changed objects
 	auto changedObjects = localChanges.getAllChangedObjects();
 	context.performExternalFileReload({changedObjects.begin(), changedObjects.end()});
+
+	return removedChildren || !localChanges.empty();
 }
 
 void PrefabOperations::prefabUpdateOrderDepthFirstSearch(SPrefab current, std::vector<SPrefab>& order) {
-	if (std::find(order.begin(), order.end(), current) == order.end()) {
+	std::unordered_set<SPrefab> visited(order.begin(), order.end());
+	prefabUpdateOrderDepthFirstSearch(current, order, visited);
+}
+
+void PrefabOperations::prefabUpdateOrderDepthFirstSearch(SPrefab current, std::vector<SPrefab>& order, std::unordered_set<SPrefab>& visited) {
+	if (visited.insert(current).second) {
 		for (auto weak_inst : current->instances_) {
 			if (auto inst = weak_inst.lock()) {
 				if (!PrefabOperations::findContainingPrefabInstance(inst->getParent())) {
 					if (auto inst_prefab = PrefabOperations::findContainingPrefab(inst)) {
-						prefabUpdateOrderDepthFirstSearch(inst_prefab, order);
+						prefabUpdateOrderDepthFirstSearch(inst_prefab, order, visited);
 					}
 				}
 			}
@@ -359,70 +369,88 @@ void PrefabOperations::prefabUpdateOrderDepthFirstSearch(SPrefab current, std::v
 	}
 }
 
-// Prefab update order
-// - prefab B needs to be updated after prefab A if B contains a prefab instance of A
-// @return reverse update order
-std::vector<SPrefab> prefabUpdateOrder(const Project& project) {
-	std::vector<SPrefab> result;
-	for (auto obj : project.instances()) {
-		if (auto prefab = obj->as<Prefab>()) {
-			PrefabOperations::prefabUpdateOrderDepthFirstSearch(prefab, result);
+namespace {
+
+// Prefab instances are dirty if the template property has changed or the instance was newly created.
+std::set<SPrefabInstance> dirtyPrefabInstances(const Project& project, const DataChangeRecorder& changes) {
+	std::set<SPrefabInstance> instances;
+	for (const auto& obj : changes.getCreatedObjects()) {
+		if (auto inst = obj->as<PrefabInstance>(); inst && project.isInstance(inst)) {
+			instances.insert(inst);
 		}
 	}
-	return result;
-}
-
-bool prefabDirty(const DataChangeRecorder& changes, SPrefab prefab) {
-	for (auto obj : changes.getAllChangedObjects(false, false, true)) {
-		auto parentPrefab = PrefabOperations::findContainingPrefab(obj);
-		if (parentPrefab && parentPrefab == prefab) {
-			return true;
+	for (const auto& [objectID, handles] : changes.getChangedValues()) {
+		auto inst = handles.begin()->rootObject()->as<PrefabInstance>();
+		if (inst && project.isInstance(inst) && changes.hasValueChanged(ValueHandle(inst, &PrefabInstance::template_))) {
+			instances.insert(inst);
 		}
 	}
-	return false;
+	return instances;
 }
 
-// Prefab instance is dirty if the template property has changed or the instance was newly created
-bool prefabInstanceDirty(const DataChangeRecorder& changes, SPrefabInstance instance) {
-	auto& createdObjects = changes.getCreatedObjects();
-	if (std::find_if(createdObjects.begin(), createdObjects.end(), [instance](const ValueHandle& handle) {
-			return handle.rootObject() == instance;
-		}) != createdObjects.end()) {
-		return true;
+// Prefabs are dirty if any object inside them has changed.
+std::set<SPrefab> dirtyPrefabs(const Project& project, const DataChangeRecorder& changes) {
+	std::set<SPrefab> prefabs;
+	for (const auto& obj : changes.getAllChangedObjects(false, false, true)) {
+		if (auto prefab = PrefabOperations::findContainingPrefab(obj); prefab && project.isInstance(prefab)) {
+			prefabs.insert(prefab);
+		}
 	}
-	ValueHandle templateHandle(instance, &PrefabInstance::template_);
-	return changes.hasValueChanged(templateHandle);
+	return prefabs;
 }
 
+}  // namespace
+
 void PrefabOperations::globalPrefabUpdate(BaseContext& context, bool propagateMissingInterfaceProperties) {
-	// Build prefab update order from dependency graph
-	auto order = prefabUpdateOrder(*context.project());
+	// Only the prefabs and prefab instances touched by the changes are considered. Changes outside of
+	// prefabs and prefab instances therefore don't need any further work.
+	auto dirtyInstances = dirtyPrefabInstances(*context.project(), context.modelChanges());
 
 	// Remove children from prefab instances which set the template property to nullptr:
 	std::vector<SPrefabInstance> prefabInstances;
-	for (auto obj : context.project()->instances()) {
-		if (auto inst = obj->as<PrefabInstance>()) {
-			if (prefabInstanceDirty(context.modelChanges(), inst) && *inst->template_ == nullptr && !findContainingPrefabInstance(inst->getParent())) {
-				prefabInstances.emplace_back(inst);
-			}
+	for (const auto& inst : dirtyInstances) {
+		if (*inst->template_ == nullptr && !findContainingPrefabInstance(inst->getParent())) {
+			prefabInstances.emplace_back(inst);
 		}
 	}
 	for (auto inst : prefabInstances) {
-		if (std::find(context.project()->instances().begin(), context.project()->instances().end(), inst) != context.project()->instances().end()) {
+		if (context.project()->isInstance(inst)) {
 			auto children = inst->children_->asVector<SEditorObject>();
 			context.deleteObjects(children);
 		}
 	}
 
+	auto prefabs = dirtyPrefabs(*context.project(), context.modelChanges());
+	if (prefabs.empty() && dirtyInstances.empty()) {
+		return;
+	}
+
+	// Build the update order of the dirty prefabs, the templates of the dirty instances and all prefabs depending on these.
+	std::vector<SPrefab> order;
+	std::unordered_set<SPrefab> visited;
+	for (const auto& prefab : prefabs) {
+		prefabUpdateOrderDepthFirstSearch(prefab, order, visited);
+	}
+	for (const auto& inst : dirtyInstances) {
+		if (SPrefab prefab = *inst->template_; prefab && context.project()->isInstance(inst)) {
+			prefabUpdateOrderDepthFirstSearch(prefab, order, visited);
+		}
+	}
+
 	for (auto it = order.rbegin(); it != order.rend(); ++it) {
-		auto prefab = (*it)->as<Prefab>();
-		bool prefab_dirty = prefabDirty(context.modelChanges(), prefab);
+		auto prefab = *it;
+		bool prefab_dirty = prefabs.find(prefab) != prefabs.end();
 		for (auto weak_inst : prefab->instances_) {
 			if (auto inst = weak_inst.lock()->as<PrefabInstance>()) {
 				if (!findContainingPrefabInstance(inst->getParent())) {
-					bool inst_dirty = prefabInstanceDirty(context.modelChanges(), inst);
+					bool inst_dirty = dirtyInstances.find(inst) != dirtyInstances.end();
 					if (inst_dirty || prefab_dirty) {
-						updatePrefabInstance(context, prefab, inst, inst_dirty, propagateMissingInterfaceProperties);
+						if (updatePrefabInstance(context, prefab, inst, inst_dirty, propagateMissingInterfaceProperties)) {
+							// Changing an instance inside a prefab makes that prefab dirty. It comes later in the update order.
+							if (auto instPrefab = findContainingPrefab(inst)) {
+								prefabs.insert(instPrefab);
+							}
+						}
 					}
 				}
 			}
@@ -0,0 +1,228 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "core/ProjectObjectIndex.h"
+
+#include "core/EditorObject.h"
+#include "core/Handles.h"
+#include "core/Iterators.h"
+#include "core/Link.h"
+#include "core/ProjectSettings.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace raco::serialization {
+
+namespace {
+
+constexpr const char* INDEX_VERSION = "indexVersion";
+constexpr const char* FILE_HASH = "fileHash";
+constexpr const char* OBJECTS = "objects";
+constexpr const char* LINKS = "links";
+constexpr const char* ID = "id";
+constexpr const char* TYPE = "type";
+constexpr const char* PARENT = "parent";
+constexpr const char* REFERENCES = "references";
+
+// 64 bit FNV-1a
+constexpr uint64_t HASH_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t HASH_PRIME = 1099511628211ULL;
+
+uint64_t hashUpdate(uint64_t hash, const char* data, size_t size) {
+	for (size_t index = 0; index < size; index++) {
+		hash ^= static_cast<unsigned char>(data[index]);
+		hash *= HASH_PRIME;
+	}
+	return hash;
+}
+
+std::string hashToString(uint64_t hash) {
+	return fmt::format("{:016x}", hash);
+}
+
+}  // namespace
+
+ProjectObjectIndex ProjectObjectIndex::create(const std::vector<core::SEditorObject>& objects, const std::vector<core::SLink>& links) {
+	ProjectObjectIndex index;
+	index.objects.reserve(objects.size());
+	for (const auto& object : objects) {
+		Object entry{object->objectID(), object->getTypeDescription().typeName};
+		if (auto parent = object->getParent()) {
+			entry.parentID = parent->objectID();
+		}
+		std::set<std::string> references;
+		for (const auto& prop : core::ValueTreeIteratorAdaptor(core::ValueHandle(object))) {
+			if (prop.type() == data_storage::PrimitiveType::Ref) {
+				if (auto refValue = prop.asRef()) {
+					references.insert(refValue->objectID());
+				}
+			}
+		}
+		entry.references.assign(references.begin(), references.end());
+		index.objects.emplace_back(std::move(entry));
+	}
+
+	index.links.reserve(links.size());
+	for (const auto& link : links) {
+		index.links.emplace_back(Link{(*link->startObject_)->objectID(), (*link->endObject_)->objectID()});
+	}
+
+	return index;
+}
+
+std::string ProjectObjectIndex::indexFilePath(const std::string& projectFilePath) {
+	return projectFilePath + FILE_SUFFIX;
+}
+
+std::string ProjectObjectIndex::hashFileContent(std::string_view fileContent) {
+	return hashToString(hashUpdate(HASH_OFFSET_BASIS, fileContent.data(), fileContent.size()));
+}
+
+std::string ProjectObjectIndex::hashFileContent(std::istream& stream) {
+	uint64_t hash = HASH_OFFSET_BASIS;
+	std::vector<char> buffer(1 << 16);
+	while (stream) {
+		stream.read(buffer.data(), buffer.size());
+		hash = hashUpdate(hash, buffer.data(), static_cast<size_t>(stream.gcount()));
+	}
+	return hashToString(hash);
+}
+
+std::string ProjectObjectIndex::serialize() const {
+	QJsonArray jsonObjects;
+	for (const auto& object : objects) {
+		QJsonObject jsonObject{
+			{ID, QString::fromStdString(object.id)},
+			{TYPE, QString::fromStdString(object.typeName)}};
+		if (!object.parentID.empty()) {
+			jsonObject.insert(PARENT, QString::fromStdString(object.parentID));
+		}
+		if (!object.references.empty()) {
+			QJsonArray jsonReferences;
+			for (const auto& reference : object.references) {
+				jsonReferences.append(QString::fromStdString(reference));
+			}
+			jsonObject.insert(REFERENCES, jsonReferences);
+		}
+		jsonObjects.append(jsonObject);
+	}
+
+	QJsonArray jsonLinks;
+	for (const auto& link : links) {
+		jsonLinks.append(QJsonArray{QString::fromStdString(link.startID), QString::fromStdString(link.endID)});
+	}
+
+	QJsonObject container{
+		{INDEX_VERSION, FORMAT_VERSION},
+		{FILE_HASH, QString::fromStdString(fileHash)},
+		{OBJECTS, jsonObjects},
+		{LINKS, jsonLinks}};
+	return QJsonDocument(container).toJson(QJsonDocument::Compact).toStdString();
+}
+
+std::optional<ProjectObjectIndex> ProjectObjectIndex::deserialize(std::string_view data) {
+	auto document = QJsonDocument::fromJson(QByteArray::fromRawData(data.data(), static_cast<int>(data.size())));
+	if (!document.isObject() || document[INDEX_VERSION].toInt() != FORMAT_VERSION) {
+		return std::nullopt;
+	}
+
+	ProjectObjectIndex index;
+	index.fileHash = document[FILE_HASH].toString().toStdString();
+
+	auto jsonObjects = document[OBJECTS].toArray();
+	index.objects.reserve(jsonObjects.size());
+	for (const auto& jsonValue : jsonObjects) {
+		auto jsonObject = jsonValue.toObject();
+		Object object{jsonObject[ID].toString().toStdString(), jsonObject[TYPE].toString().toStdString(), jsonObject[PARENT].toString().toStdString()};
+		if (object.id.empty()) {
+			return std::nullopt;
+		}
+		for (const auto& reference : jsonObject[REFERENCES].toArray()) {
+			object.references.emplace_back(reference.toString().toStdString());
+		}
+		index.objects.emplace_back(std::move(object));
+	}
+
+	for (const auto& jsonValue : document[LINKS].toArray()) {
+		auto jsonLink = jsonValue.toArray();
+		if (jsonLink.size() != 2) {
+			return std::nullopt;
+		}
+		index.links.emplace_back(Link{jsonLink[0].toString().toStdString(), jsonLink[1].toString().toStdString()});
+	}
+
+	return index;
+}
+
+ProjectObjectSelection ProjectObjectIndex::select(const std::set<std::string>& objectIDs) const {
+	std::unordered_map<std::string_view, size_t> objectIndices;
+	for (size_t index = 0; index < objects.size(); index++) {
+		objectIndices[objects[index].id] = index;
+	}
+	std::unordered_multimap<std::string_view, std::string_view> linkStartsByEnd;
+	for (const auto& link : links) {
+		linkStartsByEnd.emplace(link.endID, link.startID);
+	}
+
+	ProjectObjectSelection selection;
+	selection.instances.resize(objects.size(), false);
+	selection.links.resize(links.size(), false);
+
+	std::vector<size_t> pending;
+	auto add = [&objectIndices, &selection, &pending](std::string_view id) {
+		auto it = objectIndices.find(id);
+		if (it != objectIndices.end() && !selection.instances[it->second]) {
+			selection.instances[it->second] = true;
+			pending.emplace_back(it->second);
+		}
+	};
+
+	for (const auto& object : objects) {
+		if (object.typeName == core::ProjectSettings::typeDescription.typeName) {
+			add(object.id);
+		}
+	}
+	for (const auto& id : objectIDs) {
+		add(id);
+	}
+
+	while (!pending.empty()) {
+		const auto& object = objects[pending.back()];
+		pending.pop_back();
+
+		if (!object.parentID.empty()) {
+			add(object.parentID);
+		}
+		for (const auto& reference : object.references) {
+			add(reference);
+		}
+		auto [begin, end] = linkStartsByEnd.equal_range(object.id);
+		for (auto it = begin; it != end; ++it) {
+			add(it->second);
+		}
+	}
+
+	for (size_t index = 0; index < links.size(); index++) {
+		auto start = objectIndices.find(links[index].startID);
+		auto end = objectIndices.find(links[index].endID);
+		selection.links[index] = start != objectIndices.end() && end != objectIndices.end() &&
+								 selection.instances[start->second] && selection.instances[end->second];
+	}
+
+	return selection;
+}
+
+}  // namespace raco::serialization
@@ -13,6 +13,7 @@
 
 #include "core/DynamicEditorObject.h"
 #include "core/EditorObject.h"
+#include "core/JsonScanner.h"
 #include "core/Link.h"
 #include "core/Project.h"
 #include "core/ProjectMigration.h"
@@ -23,6 +24,7 @@
 #include "core/CommandInterface.h"
 #include "data_storage/Table.h"
 #include "log_system/log.h"
+#include "utils/ParallelUtils.h"
 #include "utils/u8path.h"
 
 #include <QJsonArray>
@@ -31,6 +33,8 @@
 #include <QStringList>
 
 #include <filesystem>
+#include <iterator>
+#include <mutex>
 
 using namespace raco::serialization;
 using namespace raco::data_storage;
@@ -605,6 +609,9 @@ void convertObjectAnnotationsIRToUser(const ClassWithReflectedMembers& dynObj, C
 	}
 }
 
+// Minimum number of objects processed per worker thread during project deserialization.
+constexpr size_t PARALLEL_DESERIALIZATION_RANGE_SIZE = 256;
+
 ProjectDeserializationInfo ConvertFromIRToUserTypes(const ProjectDeserializationInfoIR& deserializedIR) {
 	auto& userFactory{user_types::UserObjectFactory::getInstance()};
 
@@ -614,19 +621,20 @@ ProjectDeserializationInfo ConvertFromIRToUserTypes(const ProjectDeserialization
 	result.migrationObjWarnings = deserializedIR.migrationObjWarnings;
 	result.externalProjectsMap = deserializedIR.externalProjectsMap;
 
-	std::map<std::string, core::SEditorObject> instanceMap;
-	for (const auto& obj : deserializedIR.objects) {
-		auto dynObj = std::dynamic_pointer_cast<serialization::proxy::DynamicEditorObject>(obj);
-
-		auto objectID = *dynObj->objectID_;
-		auto typeName = dynObj->getTypeDescription().typeName;
-
-		auto userObj = std::dynamic_pointer_cast<EditorObject>(userFactory.createObject(typeName));
-		result.objects.emplace_back(userObj);
+	result.objects.resize(deserializedIR.objects.size());
+	utils::parallel::parallelFor(deserializedIR.objects.size(), PARALLEL_DESERIALIZATION_RANGE_SIZE, [&deserializedIR, &result, &userFactory](size_t begin, size_t end) {
+		for (auto index = begin; index < end; index++) {
+			auto typeName = deserializedIR.objects[index]->getTypeDescription().typeName;
+			result.objects[index] = std::dynamic_pointer_cast<EditorObject>(userFactory.createObject(typeName));
+		}
+	});
 
-		instanceMap[objectID] = userObj;
+	std::map<std::string, core::SEditorObject> instanceMap;
+	for (size_t index = 0; index < deserializedIR.objects.size(); index++) {
+		instanceMap[*deserializedIR.objects[index]->objectID_] = result.objects[index];
 	}
 
+	// The instance map is only read from here on and may be shared by the worker threads.
 	auto translateRef = [&instanceMap](SEditorObject obj) -> SEditorObject {
 		if (obj) {
 			return instanceMap.at(obj->objectID());
@@ -638,13 +646,17 @@ ProjectDeserializationInfo ConvertFromIRToUserTypes(const ProjectDeserialization
 		result.links.emplace_back(core::Link::cloneLinkWithTranslation(std::dynamic_pointer_cast<core::Link>(irLink), translateRef));
 	}
 
-	for (const auto& obj : deserializedIR.objects) {
-		auto dynObj = std::dynamic_pointer_cast<serialization::proxy::DynamicEditorObject>(obj);
-		auto userObj = instanceMap[dynObj->objectID()];
+	// Each object is converted independently; references are only translated, not registered with the referenced
+	// object. This is done by the onAfterDeserialization handlers after loading.
+	utils::parallel::parallelFor(deserializedIR.objects.size(), PARALLEL_DESERIALIZATION_RANGE_SIZE, [&deserializedIR, &result, &userFactory, &translateRef](size_t begin, size_t end) {
+		for (auto index = begin; index < end; index++) {
+			const auto& dynObj = *deserializedIR.objects[index];
+			auto& userObj = *result.objects[index];
 
-		convertObjectPropertiesIRToUser(*dynObj, *userObj, translateRef, userFactory);
-		convertObjectAnnotationsIRToUser(*dynObj, *userObj, translateRef, userFactory);
-	}
+			convertObjectPropertiesIRToUser(dynObj, userObj, translateRef, userFactory);
+			convertObjectAnnotationsIRToUser(dynObj, userObj, translateRef, userFactory);
+		}
+	});
 
 	return result;
 }
@@ -946,39 +958,44 @@ ProjectVersionInfo deserializeProjectVersionInfo(const QJsonDocument& document)
 	return deserializedProjectInfo;
 }
 
-ProjectDeserializationInfoIR deserializeProjectToIR(const QJsonDocument& document, const std::string& filename) {
-	auto migratedJson{raco::serializationToV23::migrateProjectToV23(document)};
-
-	auto& factory{serialization::proxy::ProxyObjectFactory::getInstance()};
-
-	ProjectDeserializationInfoIR deserializedProjectInfo;
+namespace {
 
-	deserializedProjectInfo.versionInfo = deserializeProjectVersionInfo(migratedJson);
-	deserializedProjectInfo.fileVersion = migratedJson.object()[keys::FILE_VERSION].toInt();
+void deserializeProjectInfo(const QJsonDocument& document, ProjectDeserializationInfoIR& outInfo) {
+	outInfo.versionInfo = deserializeProjectVersionInfo(document);
+	outInfo.fileVersion = document.object()[keys::FILE_VERSION].toInt();
 	// Don't deserialize the keys::FEATURE_LEVEL; this is redundant and already contained in the ProjectSettings object
 
-	deserializeExternalProjectsMap(migratedJson[keys::EXTERNAL_PROJECTS].toVariant(), deserializedProjectInfo.externalProjectsMap);
-	auto userPropTypeMap = deserializeUserTypePropertyMap(migratedJson[keys::USER_TYPE_PROP_MAP]);
-	auto structTypeMap = deserializeUserTypePropertyMap(migratedJson[keys::STRUCT_PROP_MAP]);
+	deserializeExternalProjectsMap(document[keys::EXTERNAL_PROJECTS].toVariant(), outInfo.externalProjectsMap);
+}
 
-	References references;
+/**
+ * Deserialize count objects from the JSON objects returned by jsonAt(index) and append them to outObjects.
+ * 
+ * The objects are deserialized on multiple threads. The references of each thread are collected separately and
+ * merged into outReferences; they are resolved later in the serial fix-up phase.
+ */
+template <typename T, typename JsonAtFunc>
+void deserializeTypedObjects(size_t count, const JsonAtFunc& jsonAt, std::vector<std::shared_ptr<T>>& outObjects, References& outReferences,
+	const std::map<std::string, std::map<std::string, std::string>>& userPropTypeMap, const std::map<std::string, std::map<std::string, std::string>>& structTypeMap) {
+	auto& factory{serialization::proxy::ProxyObjectFactory::getInstance()};
 
-	const auto instances = migratedJson[keys::INSTANCES].toArray();
-	deserializedProjectInfo.objects.reserve(instances.size());
-	for (const auto& instance : instances) {
-		auto obj = std::dynamic_pointer_cast<serialization::proxy::DynamicEditorObject>(deserializeTypedObject(instance.toObject(), factory, references, userPropTypeMap, structTypeMap));
-		deserializedProjectInfo.objects.push_back(obj);
-	}
-	const auto links = migratedJson[keys::LINKS].toArray();
-	deserializedProjectInfo.links.reserve(links.size());
-	for (const auto& linkJson: links) {
-		auto link = std::dynamic_pointer_cast<core::Link>(deserializeTypedObject(linkJson.toObject(), factory, references, userPropTypeMap, structTypeMap));
-		deserializedProjectInfo.links.push_back(link);
-	}
+	auto offset = outObjects.size();
+	outObjects.resize(offset + count);
+	std::mutex referencesMutex;
+	utils::parallel::parallelFor(count, PARALLEL_DESERIALIZATION_RANGE_SIZE, [&](size_t begin, size_t end) {
+		References references;
+		for (auto index = begin; index < end; index++) {
+			outObjects[offset + index] = std::dynamic_pointer_cast<T>(deserializeTypedObject(jsonAt(index), factory, references, userPropTypeMap, structTypeMap));
+		}
+		std::lock_guard<std::mutex> lock(referencesMutex);
+		outReferences.merge(references);
+	});
+}
 
+void finishProjectDeserializationIR(ProjectDeserializationInfoIR& info, const References& references, const std::string& filename) {
 	// Restore references
 	std::map<std::string, core::SEditorObject> instanceMap;
-	for (auto& d : deserializedProjectInfo.objects) {
+	for (auto& d : info.objects) {
 		auto obj = std::dynamic_pointer_cast<core::EditorObject>(d);
 		instanceMap[obj->objectID()] = obj;
 	}
@@ -990,12 +1007,168 @@ ProjectDeserializationInfoIR deserializeProjectToIR(const QJsonDocument& documen
 		}
 	}
 
-	for (const auto& obj : deserializedProjectInfo.objects) {
+	for (const auto& obj : info.objects) {
 		auto dynObj = std::dynamic_pointer_cast<serialization::proxy::DynamicEditorObject>(obj);
 		dynObj->onAfterDeserialization();
 	}
 
-	deserializedProjectInfo.currentPath = filename;
+	info.currentPath = filename;
+}
+
+}  // namespace
+
+ProjectDeserializationInfoIR deserializeProjectToIR(const QJsonDocument& document, const std::string& filename) {
+	auto migratedJson{raco::serializationToV23::migrateProjectToV23(document)};
+
+	// Extract the array elements up front: QJsonObject copies are shallow and may be read concurrently.
+	auto toObjects = [](const QJsonArray& array) {
+		std::vector<QJsonObject> objects;
+		objects.reserve(array.size());
+		for (const auto& element : array) {
+			objects.emplace_back(element.toObject());
+		}
+		return objects;
+	};
+
+	return deserializeProjectToIR(migratedJson, toObjects(migratedJson[keys::INSTANCES].toArray()), toObjects(migratedJson[keys::LINKS].toArray()), filename);
+}
+
+ProjectDeserializationInfoIR deserializeProjectToIR(const QJsonDocument& header, const std::vector<QJsonObject>& instances, const std::vector<QJsonObject>& links, const std::string& filename) {
+	if (deserializeFileVersion(header) < 23) {
+		// The migration to V23 works on the complete JSON document
+		auto toArray = [](const std::vector<QJsonObject>& objects) {
+			QJsonArray array;
+			for (const auto& object : objects) {
+				array.append(object);
+			}
+			return array;
+		};
+		auto container = header.object();
+		container.insert(keys::INSTANCES, toArray(instances));
+		container.insert(keys::LINKS, toArray(links));
+		return deserializeProjectToIR(QJsonDocument(container), filename);
+	}
+
+	ProjectDeserializationInfoIR deserializedProjectInfo;
+	deserializeProjectInfo(header, deserializedProjectInfo);
+
+	auto userPropTypeMap = deserializeUserTypePropertyMap(header[keys::USER_TYPE_PROP_MAP]);
+	auto structTypeMap = deserializeUserTypePropertyMap(header[keys::STRUCT_PROP_MAP]);
+
+	References references;
+
+	deserializeTypedObjects(
+		instances.size(), [&instances](size_t index) -> const QJsonObject& { return instances[index]; },
+		deserializedProjectInfo.objects, references, userPropTypeMap, structTypeMap);
+
+	deserializeTypedObjects(
+		links.size(), [&links](size_t index) -> const QJsonObject& { return links[index]; },
+		deserializedProjectInfo.links, references, userPropTypeMap, structTypeMap);
+
+	finishProjectDeserializationIR(deserializedProjectInfo, references, filename);
+
+	return deserializedProjectInfo;
+}
+
+ProjectFileHeader deserializeProjectHeader(std::istream& stream) {
+	ProjectFileHeader header;
+	QJsonObject container;
+
+	JsonScanner scanner(stream);
+	scanner.beginObject();
+	std::string key;
+	std::string rawValue;
+	while (scanner.nextKey(key)) {
+		if (key == keys::INSTANCES) {
+			header.instancesOffset = scanner.offset();
+			scanner.skipValue();
+		} else if (key == keys::LINKS) {
+			header.linksOffset = scanner.offset();
+			scanner.skipValue();
+		} else {
+			// Wrap into an array since QJsonDocument only accepts objects and arrays at the top level.
+			scanner.readRawValue(rawValue);
+			auto wrapped = QJsonDocument::fromJson(QByteArray("[") + QByteArray::fromStdString(rawValue) + "]");
+			if (wrapped.isNull()) {
+				throw std::runtime_error(fmt::format("Invalid JSON value for key '{}'", key));
+			}
+			container.insert(QString::fromStdString(key), wrapped.array()[0]);
+		}
+	}
+	header.document = QJsonDocument(container);
+	return header;
+}
+
+ProjectDeserializationInfoIR deserializeProjectToIR(std::istream& stream, const ProjectFileHeader& header, const std::string& filename, const ProjectObjectSelection* selection) {
+	if (deserializeFileVersion(header.document) < 23) {
+		// The migration to V23 works on the complete JSON document
+		stream.clear();
+		stream.seekg(0);
+		std::string contents{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+		return deserializeProjectToIR(QJsonDocument::fromJson(QByteArray::fromStdString(contents)), filename);
+	}
+
+	ProjectDeserializationInfoIR deserializedProjectInfo;
+	deserializeProjectInfo(header.document, deserializedProjectInfo);
+
+	auto userPropTypeMap = deserializeUserTypePropertyMap(header.document[keys::USER_TYPE_PROP_MAP]);
+	auto structTypeMap = deserializeUserTypePropertyMap(header.document[keys::STRUCT_PROP_MAP]);
+
+	References references;
+	JsonScanner scanner(stream);
+
+	// The raw JSON text is read in batches which are then parsed and deserialized in parallel.
+	// This bounds the amount of unparsed text held in memory.
+	constexpr size_t batchSize = 16 * PARALLEL_DESERIALIZATION_RANGE_SIZE;
+	std::vector<std::string> rawObjects;
+
+	auto deserializeArray = [&](std::streamoff offset, const std::vector<bool>* selected, auto& outObjects) {
+		if (offset < 0) {
+			if (selected && !selected->empty()) {
+				throw std::runtime_error("Object selection doesn't match project file");
+			}
+			return;
+		}
+		auto parseRawObject = [&rawObjects](size_t index) {
+			const auto& rawObject = rawObjects[index];
+			auto objectDocument = QJsonDocument::fromJson(QByteArray::fromRawData(rawObject.data(), static_cast<int>(rawObject.size())));
+			if (!objectDocument.isObject()) {
+				throw std::runtime_error("Invalid JSON object in project file");
+			}
+			return objectDocument.object();
+		};
+
+		scanner.seek(offset);
+		scanner.beginArray();
+		bool atEnd = false;
+		size_t elementIndex = 0;
+		while (!atEnd) {
+			size_t count = 0;
+			while (count < batchSize && !(atEnd = !scanner.nextElement())) {
+				if (selected && elementIndex >= selected->size()) {
+					throw std::runtime_error("Object selection doesn't match project file");
+				}
+				if (selected && !(*selected)[elementIndex++]) {
+					// Skipped elements are not parsed at all
+					scanner.skipValue();
+					continue;
+				}
+				if (rawObjects.size() <= count) {
+					rawObjects.emplace_back();
+				}
+				scanner.readRawValue(rawObjects[count++]);
+			}
+			deserializeTypedObjects(count, parseRawObject, outObjects, references, userPropTypeMap, structTypeMap);
+		}
+		if (selected && elementIndex != selected->size()) {
+			throw std::runtime_error("Object selection doesn't match project file");
+		}
+	};
+
+	deserializeArray(header.instancesOffset, selection ? &selection->instances : nullptr, deserializedProjectInfo.objects);
+	deserializeArray(header.linksOffset, selection ? &selection->links : nullptr, deserializedProjectInfo.links);
+
+	finishProjectDeserializationIR(deserializedProjectInfo, references, filename);
 
 	return deserializedProjectInfo;
 }
@@ -1015,4 +1188,34 @@ ProjectDeserializationInfo deserializeProject(const QJsonDocument& document, con
 	return {};
 }
 
+ProjectDeserializationInfo deserializeProject(std::istream& stream, const ProjectFileHeader& header, const std::string& filename, const ProjectObjectSelection* selection) {
+	try {
+		auto deserializedIR{deserializeProjectToIR(stream, header, filename, selection)};
+
+		// run new migration code
+		auto& factory{serialization::proxy::ProxyObjectFactory::getInstance()};
+		migrateProject(deserializedIR, factory);
+
+		return ConvertFromIRToUserTypes(deserializedIR);
+	} catch (std::exception&) {
+		throw std::runtime_error(fmt::format("Project file format invalid."));
+	}
+	return {};
+}
+
+ProjectDeserializationInfo deserializeProject(const QJsonDocument& header, const std::vector<QJsonObject>& instances, const std::vector<QJsonObject>& links, const std::string& filename) {
+	try {
+		auto deserializedIR{deserializeProjectToIR(header, instances, links, filename)};
+
+		// run new migration code
+		auto& factory{serialization::proxy::ProxyObjectFactory::getInstance()};
+		migrateProject(deserializedIR, factory);
+
+		return ConvertFromIRToUserTypes(deserializedIR);
+	} catch (std::exception&) {
+		throw std::runtime_error(fmt::format("Project file format invalid."));
+	}
+	return {};
+}
+
 }  // namespace raco::serialization
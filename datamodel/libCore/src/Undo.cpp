@@ -22,12 +22,170 @@
 #include "data_storage/Value.h"
 #include "data_storage/Array.h"
 
+#include <algorithm>
 #include <cassert>
 
 namespace raco::core {
 
 using namespace raco::data_storage;
 
+namespace {
+
+SEditorObject translateByID(const Project *project, const SEditorObject &obj) {
+	if (obj) {
+		return project->getInstanceByID(obj->objectID());
+	}
+	return nullptr;
+}
+
+ValueBase *valueAtPath(ReflectionInterface *root, const std::vector<std::string> &path, size_t start = 0) {
+	ValueBase *value = nullptr;
+	ReflectionInterface *current = root;
+	for (size_t index = start; index < path.size(); index++) {
+		if (!current || !current->hasProperty(path[index])) {
+			return nullptr;
+		}
+		value = current->get(path[index]);
+		current = hasTypeSubstructure(value->type()) ? &value->getSubstructure() : nullptr;
+	}
+	return value;
+}
+
+bool isPathPrefix(const std::vector<std::string> &prefix, const std::vector<std::string> &path) {
+	return prefix.size() <= path.size() && std::equal(prefix.begin(), prefix.end(), path.begin());
+}
+
+// Create a copy of an object which is not part of any project.
+// References are not translated and still point to the original objects.
+SEditorObject detachedCopy(const SEditorObject &src, UserObjectFactoryInterface &factory) {
+	auto copy = factory.createObject(src->getTypeDescription().typeName, src->objectName(), src->objectID());
+	UndoHelpers::updateEditorObject(
+		src.get(), copy, [](SEditorObject obj) { return obj; }, [](const std::string &) { return false; }, factory, nullptr, false);
+	return copy;
+}
+
+bool annotationsEqual(const EditorObject &left, const EditorObject &right) {
+	const auto &leftAnnos = left.annotations();
+	const auto &rightAnnos = right.annotations();
+	if (leftAnnos.size() != rightAnnos.size()) {
+		return false;
+	}
+	for (size_t index = 0; index < leftAnnos.size(); index++) {
+		if (leftAnnos[index]->serializationTypeName() != rightAnnos[index]->serializationTypeName() ||
+			!ReflectionInterface::compare(*leftAnnos[index], *rightAnnos[index], [](SEditorObject obj) { return obj; })) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool tableStructureEqual(const Table &left, const Table &right) {
+	if (left.size() != right.size()) {
+		return false;
+	}
+	for (size_t index = 0; index < left.size(); index++) {
+		if (left.name(index) != right.name(index) || !ValueBase::classesEqual(*left.get(index), *right.get(index))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Find the smallest set of non-nested properties that differ between oldValue and newValue.
+// Structs and Tables with identical structure are descended into, everything else is recorded as a whole.
+template <typename ValueDelta>
+void diffValues(const std::string &objectID, const ValueBase *oldValue, const ValueBase *newValue, std::vector<std::string> &path, const std::function<SEditorObject(SEditorObject)> &translateOldToNew, std::vector<ValueDelta> &outDeltas) {
+	if (newValue->query<VolatileProperty>() || oldValue->compare(*newValue, translateOldToNew)) {
+		return;
+	}
+
+	if (ValueBase::classesEqual(*oldValue, *newValue)) {
+		bool descend = newValue->type() == PrimitiveType::Struct ||
+					   (newValue->type() == PrimitiveType::Table && !newValue->query<ArraySemanticAnnotation>() && tableStructureEqual(oldValue->asTable(), newValue->asTable()));
+		if (descend) {
+			const auto &oldStructure = oldValue->getSubstructure();
+			const auto &newStructure = newValue->getSubstructure();
+			for (size_t index = 0; index < newStructure.size(); index++) {
+				path.emplace_back(newStructure.name(index));
+				diffValues(objectID, oldStructure.get(index), newStructure.get(index), path, translateOldToNew, outDeltas);
+				path.pop_back();
+			}
+			return;
+		}
+	}
+
+	outDeltas.emplace_back(ValueDelta{objectID, path, oldValue->clone(nullptr), newValue->clone(nullptr)});
+}
+
+bool changeRecorderEmpty(const DataChangeRecorder &changes) {
+	return changes.getCreatedObjects().empty() && changes.getDeletedObjects().empty() && changes.getChangedValues().empty() &&
+		   changes.getAddedLinks().empty() && changes.getRemovedLinks().empty() && changes.getValidityChangedLinks().empty() &&
+		   !changes.externalProjectMapChanged() && !changes.rootOrderChanged();
+}
+
+std::vector<std::string> instanceOrder(const std::vector<SEditorObject> &instances, const std::set<std::string> &excludeIDs) {
+	std::vector<std::string> order;
+	order.reserve(instances.size());
+	for (const auto &obj : instances) {
+		if (excludeIDs.find(obj->objectID()) == excludeIDs.end()) {
+			order.emplace_back(obj->objectID());
+		}
+	}
+	return order;
+}
+
+// Set of end object ids of all links which may have been changed
+std::set<std::string> changedLinkEndObjectIDs(const DataChangeRecorder &changes) {
+	std::set<std::string> ids;
+	for (const auto &linkMap : {&changes.getAddedLinks(), &changes.getRemovedLinks(), &changes.getValidityChangedLinks()}) {
+		for (const auto &[endObjectID, links] : *linkMap) {
+			ids.insert(endObjectID);
+		}
+	}
+	for (const auto &obj : changes.getCreatedObjects()) {
+		ids.insert(obj->objectID());
+	}
+	for (const auto &obj : changes.getDeletedObjects()) {
+		ids.insert(obj->objectID());
+	}
+	return ids;
+}
+
+size_t estimateMemoryFootprint(const ReflectionInterface &object);
+
+size_t estimateMemoryFootprint(const ValueBase &value) {
+	switch (value.type()) {
+		case PrimitiveType::String:
+			return sizeof(Value<std::string>) + value.asString().capacity();
+		case PrimitiveType::Ref:
+			return sizeof(Value<SEditorObject>);
+		case PrimitiveType::Table:
+		case PrimitiveType::Struct:
+		case PrimitiveType::Array:
+			return sizeof(Value<Table>) + estimateMemoryFootprint(value.getSubstructure());
+		default:
+			return sizeof(Value<double>);
+	}
+}
+
+size_t estimateMemoryFootprint(const ReflectionInterface &object) {
+	size_t size = 0;
+	for (size_t index = 0; index < object.size(); index++) {
+		size += sizeof(std::string) + object.name(index).size() + estimateMemoryFootprint(*object.get(index));
+	}
+	return size;
+}
+
+size_t estimateObjectFootprint(const EditorObject &object) {
+	size_t size = sizeof(EditorObject) + estimateMemoryFootprint(object);
+	for (const auto &anno : object.annotations()) {
+		size += estimateMemoryFootprint(*anno);
+	}
+	return size;
+}
+
+}  // namespace
+
 void UndoHelpers::updateSingleValue(const ValueBase *src, ValueBase *dest, ValueHandle destHandle, translateRefFunc translateRef, DataChangeRecorder *outChanges, bool invokeHandler) {
 	if (dest->query<VolatileProperty>()) {
 		return;
@@ -171,8 +329,8 @@ void UndoHelpers::updateTableByName(const Table *src, Table *dest, ValueHandle d
 	size_t index = 0;
 	bool changed = false;
 	while (index < dest->size()) {
-		std::string name = dest->name(index);
-		if (!src->hasProperty(name) || !ValueBase::classesEqual(*src->get(name), *dest->get(name))) {
+		int srcIndex = src->index(dest->name(index));
+		if (srcIndex == -1 || !ValueBase::classesEqual(*src->get(srcIndex), *dest->get(index))) {
 
 			if (invokeHandler && destHandle) {
 				UndoHelpers::callOnBeforeRemoveReferenceHandler(dest, index, destHandle);
@@ -187,16 +345,16 @@ void UndoHelpers::updateTableByName(const Table *src, Table *dest, ValueHandle d
 
 	// Add src properties not present in dest
 	for (size_t index{0}; index < src->size(); index++) {
-		std::string name = src->name(index);
-		if (dest->hasProperty(name)) {
-			auto destIndex = dest->index(name);
+		const std::string& name = src->name(index);
+		int destIndex = dest->index(name);
+		if (destIndex != -1) {
 			if (destIndex != index) {
 				dest->swapProperties(index, destIndex);
 				changed = true;
 			}
-			UndoHelpers::updateSingleValue(src->get(name), dest->get(name), destHandle ? destHandle[index] : ValueHandle(), translateRef, outChanges, invokeHandler);
+			UndoHelpers::updateSingleValue(src->get(index), dest->get(index), destHandle ? destHandle[index] : ValueHandle(), translateRef, outChanges, invokeHandler);
 		} else {
-			dest->addProperty(name, src->get(name)->clone(&translateRef), index);
+			dest->addProperty(name, src->get(index)->clone(&translateRef), index);
 			changed = true;
 		}
 	}
@@ -293,9 +451,24 @@ void UndoStack::saveProjectState(const Project *src, Project *dest, Project *ref
 	dest->externalProjectsMap_ = src->externalProjectsMap_;
 }
 
-void UndoStack::updateProjectState(const Project *src, Project *dest, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory) {
+void UndoStack::updateProjectState(const Project *src, Project *dest, const Project *ref, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory) {
 	SEditorObjectSet dirtyObjects = changes.getAllChangedObjects();
 
+	// Changed objects shared with the previous state are replaced by new objects owned by dest
+	// since updating them in place would modify the previous state as well.
+	if (ref) {
+		for (const auto &srcObj : dirtyObjects) {
+			auto destObj = dest->getInstanceByID(srcObj->objectID());
+			if (destObj && destObj == ref->getInstanceByID(srcObj->objectID())) {
+				auto index = std::find(dest->instances().begin(), dest->instances().end(), destObj) - dest->instances().begin();
+				dest->removeInstances({destObj}, false);
+				auto ownedObj = factory.createObject(srcObj->getTypeDescription().typeName, srcObj->objectName(), srcObj->objectID());
+				dest->addInstance(ownedObj);
+				dest->moveInstance(ownedObj, static_cast<int>(index));
+			}
+		}
+	}
+
 	auto translateRef = [dest](SEditorObject srcObj) -> SEditorObject {
 		if (srcObj) {
 			return dest->getInstanceByID(srcObj->objectID());
@@ -318,7 +491,11 @@ void UndoStack::updateProjectState(const Project *src, Project *dest, const Data
 void UndoStack::restoreProjectState(Project *src, Project *dest, BaseContext &context, UserObjectFactoryInterface &factory) {
 	DataChangeRecorder changes;
 	bool extrefDirty = false;
+	restoreProjectStateChanges(src, dest, context, factory, changes, extrefDirty);
+	finishRestore(dest, changes, extrefDirty);
+}
 
+void UndoStack::restoreProjectStateChanges(Project *src, Project *dest, BaseContext &context, UserObjectFactoryInterface &factory, DataChangeRecorder &changes, bool &extrefDirty) {
 	const auto destLinks{dest->links()};
 	const auto srcLinks{src->links()};
 
@@ -375,19 +552,6 @@ void UndoStack::restoreProjectState(Project *src, Project *dest, BaseContext &co
 			srcObj.get(), destObj, translateRef, [](const std::string &) { return false; }, factory, &changes, true);
 	}
 
-	auto findExtref = [](const std::map<std::string, std::set<ValueHandle>>& changes) {
-		for (const auto &[id, handles] : changes) {
-			for (const auto &handle : handles) {
-				if (handle.rootObject()->query<ExternalReferenceAnnotation>()) {
-					return true;
-				}
-			}
-		}
-		return false;
-	};
-	extrefDirty = extrefDirty || findExtref(changes.getChangedValues());
-
-
 	for (const auto &srcLink : srcLinks) {
 		auto foundDestLink = dest->findLinkByObjectID(srcLink);
 		if (!foundDestLink) {
@@ -419,6 +583,20 @@ void UndoStack::restoreProjectState(Project *src, Project *dest, BaseContext &co
 		dest->externalProjectsMap_ = src->externalProjectsMap_;
 		extrefDirty = true;
 	}
+}
+
+void UndoStack::finishRestore(Project *dest, DataChangeRecorder &changes, bool extrefDirty) {
+	auto findExtref = [](const std::map<std::string, std::set<ValueHandle>>& changes) {
+		for (const auto &[id, handles] : changes) {
+			for (const auto &handle : handles) {
+				if (handle.rootObject()->query<ExternalReferenceAnnotation>()) {
+					return true;
+				}
+			}
+		}
+		return false;
+	};
+	extrefDirty = extrefDirty || findExtref(changes.getChangedValues());
 
 	// Update volatile data for new or changed objects
 	for (const auto &destObj : changes.getAllChangedObjects()) {
@@ -457,9 +635,335 @@ void UndoStack::restoreProjectState(Project *src, Project *dest, BaseContext &co
 	}
 }
 
-UndoStack::UndoStack(BaseContext* context, const Callback& onChange) : context_(context), onChange_ { onChange } {
+void UndoStack::computeDelta(const Project *src, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory, Delta &outDelta) {
+	const Project *mirror = mirror_.get();
+	std::set<std::string> createdIDs;
+	std::set<std::string> deletedIDs;
+
+	for (const auto &obj : changes.getDeletedObjects()) {
+		if (auto mirrorObj = mirror->getInstanceByID(obj->objectID())) {
+			auto index = std::find(mirror->instances().begin(), mirror->instances().end(), mirrorObj) - mirror->instances().begin();
+			// The mirror object is removed from the mirror below and therefore not modified anymore
+			outDelta.deletedObjects.emplace_back(ObjectRecord{mirrorObj, static_cast<size_t>(index)});
+			deletedIDs.insert(obj->objectID());
+		}
+	}
+
+	for (const auto &obj : changes.getCreatedObjects()) {
+		if (src->isInstance(obj) && !mirror->getInstanceByID(obj->objectID())) {
+			auto index = std::find(src->instances().begin(), src->instances().end(), obj) - src->instances().begin();
+			outDelta.createdObjects.emplace_back(ObjectRecord{detachedCopy(obj, factory), static_cast<size_t>(index)});
+			createdIDs.insert(obj->objectID());
+		}
+	}
+	std::sort(outDelta.deletedObjects.begin(), outDelta.deletedObjects.end(), [](const auto &left, const auto &right) { return left.instanceIndex < right.instanceIndex; });
+	std::sort(outDelta.createdObjects.begin(), outDelta.createdObjects.end(), [](const auto &left, const auto &right) { return left.instanceIndex < right.instanceIndex; });
+
+	if (changes.rootOrderChanged()) {
+		auto oldOrder = instanceOrder(mirror->instances(), deletedIDs);
+		auto newOrder = instanceOrder(src->instances(), createdIDs);
+		if (oldOrder != newOrder) {
+			outDelta.oldInstanceOrder = instanceOrder(mirror->instances(), {});
+			outDelta.newInstanceOrder = instanceOrder(src->instances(), {});
+		}
+	}
+
+	auto translateToSrc = [src](SEditorObject obj) { return translateByID(src, obj); };
+	for (const auto &obj : changes.getAllChangedObjects()) {
+		if (createdIDs.find(obj->objectID()) != createdIDs.end() || !src->isInstance(obj)) {
+			continue;
+		}
+		auto mirrorObj = mirror->getInstanceByID(obj->objectID());
+		if (!mirrorObj) {
+			continue;
+		}
+		if (!annotationsEqual(*mirrorObj, *obj)) {
+			outDelta.replacedObjects.emplace_back(detachedCopy(mirrorObj, factory), detachedCopy(obj, factory));
+			continue;
+		}
+		std::vector<std::string> path;
+		for (size_t index = 0; index < obj->size(); index++) {
+			path.emplace_back(obj->name(index));
+			diffValues(obj->objectID(), mirrorObj->get(index), obj->get(index), path, translateToSrc, outDelta.changedValues);
+			path.pop_back();
+		}
+	}
+
+	for (const auto &endObjectID : changedLinkEndObjectIDs(changes)) {
+		if (auto it = mirror->linkEndPoints().find(endObjectID); it != mirror->linkEndPoints().end()) {
+			for (const auto &mirrorLink : it->second) {
+				auto srcLink = src->findLinkByObjectID(mirrorLink);
+				if (!srcLink) {
+					outDelta.removedLinks.emplace_back(mirrorLink);
+				} else if (*srcLink->isWeak_ != *mirrorLink->isWeak_ || srcLink->isValid() != mirrorLink->isValid()) {
+					outDelta.changedLinks.emplace_back(LinkChange{mirrorLink, std::make_shared<Link>(*srcLink)});
+				}
+			}
+		}
+		if (auto it = src->linkEndPoints().find(endObjectID); it != src->linkEndPoints().end()) {
+			for (const auto &srcLink : it->second) {
+				if (!mirror->findLinkByObjectID(srcLink)) {
+					outDelta.addedLinks.emplace_back(std::make_shared<Link>(*srcLink));
+				}
+			}
+		}
+	}
+
+	if (mirror->externalProjectsMap_ != src->externalProjectsMap_) {
+		outDelta.externalProjectsMapChanged = true;
+		outDelta.oldExternalProjectsMap = mirror->externalProjectsMap_;
+		outDelta.newExternalProjectsMap = src->externalProjectsMap_;
+	}
+}
+
+void UndoStack::mergeDelta(const Project *src, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory, Delta &delta) {
+	// Only value changes can be merged (see canMerge). The new changes are relative to the mirror which 
+	// already contains the changes of the delta to be merged into.
+	Delta newDelta;
+	computeDelta(src, changes, factory, newDelta);
+	assert(newDelta.createdObjects.empty() && newDelta.deletedObjects.empty());
+
+	auto patchWithOldValues = [&delta](ReflectionInterface *root, const std::string &objectID, const std::vector<std::string> &basePath) {
+		// Restore the values of the already existing nested value deltas
+		auto it = delta.changedValues.begin();
+		while (it != delta.changedValues.end()) {
+			if (it->objectID == objectID && isPathPrefix(basePath, it->propertyPath)) {
+				if (auto target = basePath.size() == it->propertyPath.size() ? nullptr : valueAtPath(root, it->propertyPath, basePath.size())) {
+					UndoHelpers::updateSingleValue(it->oldValue.get(), target, ValueHandle(), [](SEditorObject obj) { return obj; }, nullptr, false);
+				}
+				it = delta.changedValues.erase(it);
+			} else {
+				++it;
+			}
+		}
+	};
+
+	for (auto &[oldObject, newObject] : newDelta.replacedObjects) {
+		auto it = std::find_if(delta.replacedObjects.begin(), delta.replacedObjects.end(), [&newObject](const auto &item) {
+			return item.second->objectID() == newObject->objectID();
+		});
+		if (it != delta.replacedObjects.end()) {
+			it->second = newObject;
+		} else {
+			patchWithOldValues(oldObject.get(), oldObject->objectID(), {});
+			delta.replacedObjects.emplace_back(oldObject, newObject);
+		}
+	}
+
+	for (auto &valueDelta : newDelta.changedValues) {
+		auto replacedIt = std::find_if(delta.replacedObjects.begin(), delta.replacedObjects.end(), [&valueDelta](const auto &item) {
+			return item.second->objectID() == valueDelta.objectID;
+		});
+		if (replacedIt != delta.replacedObjects.end()) {
+			replacedIt->second = detachedCopy(src->getInstanceByID(valueDelta.objectID), factory);
+			continue;
+		}
+
+		auto ancestorIt = std::find_if(delta.changedValues.begin(), delta.changedValues.end(), [&valueDelta](const ValueDelta &item) {
+			return item.objectID == valueDelta.objectID && isPathPrefix(item.propertyPath, valueDelta.propertyPath);
+		});
+		if (ancestorIt != delta.changedValues.end()) {
+			// Existing delta contains the new one: only the new value needs to be updated.
+			ancestorIt->newValue = valueAtPath(src->getInstanceByID(valueDelta.objectID).get(), ancestorIt->propertyPath)->clone(nullptr);
+		} else {
+			// Existing deltas nested inside the new one are folded into the old value of the new one.
+			if (hasTypeSubstructure(valueDelta.oldValue->type())) {
+				patchWithOldValues(&valueDelta.oldValue->getSubstructure(), valueDelta.objectID, valueDelta.propertyPath);
+			}
+			delta.changedValues.emplace_back(std::move(valueDelta));
+		}
+	}
+}
+
+void UndoStack::applyDelta(const Delta &delta, bool forward, Project *dest, BaseContext &context, UserObjectFactoryInterface &factory, DataChangeRecorder &changes, bool &extrefDirty) {
+	const auto &objectsToRemove = forward ? delta.deletedObjects : delta.createdObjects;
+	const auto &objectsToAdd = forward ? delta.createdObjects : delta.deletedObjects;
+	const auto &linksToRemove = forward ? delta.removedLinks : delta.addedLinks;
+	const auto &linksToAdd = forward ? delta.addedLinks : delta.removedLinks;
+	const auto &instanceOrder = forward ? delta.newInstanceOrder : delta.oldInstanceOrder;
+
+	auto translateRef = [dest](SEditorObject srcObj) -> SEditorObject {
+		return translateByID(dest, srcObj);
+	};
+
+	for (const auto &link : linksToRemove) {
+		if (auto destLink = dest->findLinkByObjectID(link)) {
+			changes.recordRemoveLink(destLink->descriptor());
+			dest->removeLink(destLink);
+			extrefDirty = extrefDirty || (*destLink->endObject_)->query<ExternalReferenceAnnotation>();
+		}
+	}
+
+	SEditorObjectSet toRemove;
+	for (const auto &record : objectsToRemove) {
+		if (auto destObj = dest->getInstanceByID(record.snapshot->objectID())) {
+			toRemove.insert(destObj);
+			changes.recordDeleteObject(destObj);
+			extrefDirty = extrefDirty || destObj->query<ExternalReferenceAnnotation>();
+		}
+	}
+	if (!toRemove.empty()) {
+		context.deleteWithVolatileSideEffects(dest, toRemove, context.errors());
+	}
+
+	// Records are sorted by ascending instance index, so inserting them in this order restores the instance order.
+	std::vector<std::pair<const ObjectRecord *, SEditorObject>> addedObjects;
+	for (const auto &record : objectsToAdd) {
+		auto destObj = factory.createObject(record.snapshot->getTypeDescription().typeName, record.snapshot->objectName(), record.snapshot->objectID());
+		dest->addInstance(destObj);
+		if (record.instanceIndex < dest->instances().size()) {
+			dest->moveInstance(destObj, static_cast<int>(record.instanceIndex));
+		}
+		changes.recordCreateObject(destObj);
+		extrefDirty = extrefDirty || record.snapshot->query<ExternalReferenceAnnotation>();
+		addedObjects.emplace_back(&record, destObj);
+	}
+	for (const auto &[record, destObj] : addedObjects) {
+		UndoHelpers::updateEditorObject(
+			record->snapshot.get(), destObj, translateRef, [](const std::string &) { return false; }, factory, &changes, true);
+	}
+
+	if (!instanceOrder.empty()) {
+		std::vector<SEditorObject> orderedDestInstances;
+		orderedDestInstances.reserve(instanceOrder.size());
+		for (const auto &id : instanceOrder) {
+			orderedDestInstances.emplace_back(dest->getInstanceByID(id));
+		}
+		dest->instances_ = orderedDestInstances;
+	}
+	if (!objectsToRemove.empty() || !objectsToAdd.empty() || !instanceOrder.empty()) {
+		changes.recordRootOrderChanged();
+	}
+
+	for (const auto &[oldObject, newObject] : delta.replacedObjects) {
+		const auto &srcObj = forward ? newObject : oldObject;
+		if (auto destObj = dest->getInstanceByID(srcObj->objectID())) {
+			UndoHelpers::updateEditorObject(
+				srcObj.get(), destObj, translateRef, [](const std::string &) { return false; }, factory, &changes, true);
+		}
+	}
+
+	for (const auto &valueDelta : delta.changedValues) {
+		auto destObj = dest->getInstanceByID(valueDelta.objectID);
+		assert(destObj != nullptr);
+		auto destValue = valueAtPath(destObj.get(), valueDelta.propertyPath);
+		assert(destValue != nullptr);
+		if (destObj && destValue) {
+			UndoHelpers::updateSingleValue(forward ? valueDelta.newValue.get() : valueDelta.oldValue.get(), destValue, ValueHandle(destObj, valueDelta.propertyPath), translateRef, &changes, true);
+		}
+	}
+
+	for (const auto &link : linksToAdd) {
+		auto destLink = Link::cloneLinkWithTranslation(link, translateRef);
+		dest->addLink(destLink);
+		changes.recordAddLink(destLink->descriptor());
+		extrefDirty = extrefDirty || (*destLink->endObject_)->query<ExternalReferenceAnnotation>();
+	}
+
+	for (const auto &linkChange : delta.changedLinks) {
+		const auto &srcLink = forward ? linkChange.newLink : linkChange.oldLink;
+		auto destLink = dest->findLinkByObjectID(srcLink);
+		assert(destLink != nullptr);
+		if (!destLink) {
+			continue;
+		}
+		if (*srcLink->isWeak_ != *destLink->isWeak_) {
+			// strong <-> weak link transitions are handled as removal and creation operation, see restoreProjectState
+			dest->removeLink(destLink);
+			changes.recordRemoveLink(destLink->descriptor());
+			destLink->isWeak_ = *srcLink->isWeak_;
+			destLink->isValid_ = srcLink->isValid();
+			dest->addLink(destLink);
+			changes.recordAddLink(destLink->descriptor());
+		} else if (srcLink->isValid() != destLink->isValid()) {
+			destLink->isValid_ = srcLink->isValid();
+			changes.recordChangeValidityOfLink(destLink->descriptor());
+		}
+		extrefDirty = extrefDirty || (*destLink->endObject_)->query<ExternalReferenceAnnotation>();
+	}
+
+	if (delta.externalProjectsMapChanged) {
+		dest->externalProjectsMap_ = forward ? delta.newExternalProjectsMap : delta.oldExternalProjectsMap;
+		extrefDirty = true;
+	}
+}
+
+void UndoStack::syncMirror(const Project *src, const DataChangeRecorder &changes, UserObjectFactoryInterface &factory) {
+	Project *mirror = mirror_.get();
+
+	SEditorObjectSet toRemove;
+	for (const auto &obj : changes.getDeletedObjects()) {
+		if (auto mirrorObj = mirror->getInstanceByID(obj->objectID())) {
+			toRemove.insert(mirrorObj);
+		}
+	}
+	auto linkEndObjectIDs = changedLinkEndObjectIDs(changes);
+	for (const auto &endObjectID : linkEndObjectIDs) {
+		if (auto it = mirror->linkEndPoints().find(endObjectID); it != mirror->linkEndPoints().end()) {
+			auto endLinks = it->second;
+			for (const auto &link : endLinks) {
+				mirror->removeLink(link);
+			}
+		}
+	}
+	mirror->removeInstances(toRemove, false);
+
+	for (const auto &obj : changes.getCreatedObjects()) {
+		if (src->isInstance(obj) && !mirror->getInstanceByID(obj->objectID())) {
+			mirror->addInstance(factory.createObject(obj->getTypeDescription().typeName, obj->objectName(), obj->objectID()));
+		}
+	}
+
+	auto translateRef = [mirror](SEditorObject srcObj) -> SEditorObject {
+		return translateByID(mirror, srcObj);
+	};
+	for (const auto &obj : changes.getAllChangedObjects()) {
+		if (src->isInstance(obj)) {
+			UndoHelpers::updateEditorObject(
+				obj.get(), mirror->getInstanceByID(obj->objectID()), translateRef, [](const std::string &) { return false; }, factory, nullptr, false);
+		}
+	}
+
+	if (changes.rootOrderChanged() || !changes.getCreatedObjects().empty() || !changes.getDeletedObjects().empty()) {
+		std::vector<SEditorObject> orderedInstances;
+		orderedInstances.reserve(src->instances().size());
+		for (const auto &obj : src->instances()) {
+			orderedInstances.emplace_back(mirror->getInstanceByID(obj->objectID()));
+		}
+		mirror->instances_ = orderedInstances;
+	}
+
+	for (const auto &endObjectID : linkEndObjectIDs) {
+		if (auto it = src->linkEndPoints().find(endObjectID); it != src->linkEndPoints().end()) {
+			for (const auto &link : it->second) {
+				mirror->addLink(Link::cloneLinkWithTranslation(link, translateRef));
+			}
+		}
+	}
+
+	mirror->externalProjectsMap_ = src->externalProjectsMap_;
+}
+
+void UndoStack::resetMirror() {
+	if (mode_ == StorageMode::Delta) {
+		mirror_ = std::make_unique<Project>();
+		saveProjectState(context_->project(), mirror_.get(), nullptr, context_->modelChanges(), *context_->objectFactory());
+	} else {
+		mirror_.reset();
+	}
+}
+
+UndoStack::UndoStack(BaseContext* context, const Callback& onChange, StorageMode mode) : context_(context), onChange_{onChange}, mode_(mode) {
 	auto initialState = &stack_.emplace_back(new Entry("Initial"))->state;
-	saveProjectState(context_->project(), initialState, nullptr, context_->modelChanges(), *context_->objectFactory());
+	if (mode_ == StorageMode::Snapshot) {
+		saveProjectState(context_->project(), initialState, nullptr, context_->modelChanges(), *context_->objectFactory());
+	}
+	resetMirror();
+	updateMemoryFootprint(false);
+}
+
+UndoStack::StorageMode UndoStack::storageMode() const {
+	return mode_;
 }
 
 void UndoStack::reset() {
@@ -468,7 +972,11 @@ void UndoStack::reset() {
 	depth_ = 0;
 	auto initialState = &stack_.emplace_back(new Entry("Initial"))->state;
 	context_->modelChanges().reset();
-	saveProjectState(context_->project(), initialState, nullptr, context_->modelChanges(), *context_->objectFactory());
+	if (mode_ == StorageMode::Snapshot) {
+		saveProjectState(context_->project(), initialState, nullptr, context_->modelChanges(), *context_->objectFactory());
+	}
+	resetMirror();
+	updateMemoryFootprint(false);
 	onChange_();
 }
 
@@ -479,9 +987,20 @@ bool UndoStack::canMerge(const DataChangeRecorder &changes) {
 void UndoStack::push(const std::string &description, std::string mergeId) {
 	if (depth_ == 0) {
 		stack_.resize(index_ + 1);
-		if (!mergeId.empty() && mergeId == stack_.back()->mergeId && canMerge(context_->modelChanges())) {
+		bool mergeable = !mergeId.empty() && mergeId == stack_.back()->mergeId && canMerge(context_->modelChanges());
+		if (mode_ == StorageMode::Delta) {
+			if (mergeable) {
+				mergeDelta(context_->project(), context_->modelChanges(), *context_->objectFactory(), stack_.back()->delta);
+				stack_.back()->description = description;
+			} else {
+				auto nextDelta = &stack_.emplace_back(new Entry(description, mergeId))->delta;
+				++index_;
+				computeDelta(context_->project(), context_->modelChanges(), *context_->objectFactory(), *nextDelta);
+			}
+			syncMirror(context_->project(), context_->modelChanges(), *context_->objectFactory());
+		} else if (mergeable) {
 			// mergable -> In-place update of the last stack state
-			updateProjectState(context_->project(), &stack_.back()->state, context_->modelChanges(), *context_->objectFactory());
+			updateProjectState(context_->project(), &stack_.back()->state, index_ > 0 ? &stack_[index_ - 1]->state : nullptr, context_->modelChanges(), *context_->objectFactory());
 			stack_.back()->description = description;
 		} else {
 			// not mergable -> create and fill new state
@@ -489,12 +1008,115 @@ void UndoStack::push(const std::string &description, std::string mergeId) {
 			++index_;
 			saveProjectState(context_->project(), nextState, &stack_[index_ - 1]->state, context_->modelChanges(), *context_->objectFactory());
 		}
+		updateMemoryFootprint(mergeable);
+		evictEntries();
 
 		onChange_();
 		context_->modelChanges().reset();
 	}
 }
 
+void UndoStack::updateMemoryFootprint(bool merged) {
+	auto &entry = *stack_.back();
+	if (mode_ == StorageMode::Delta) {
+		const auto &delta = entry.delta;
+		size_t size = 0;
+		for (const auto &records : {&delta.createdObjects, &delta.deletedObjects}) {
+			for (const auto &record : *records) {
+				size += estimateObjectFootprint(*record.snapshot);
+			}
+		}
+		for (const auto &[oldObject, newObject] : delta.replacedObjects) {
+			size += estimateObjectFootprint(*oldObject) + estimateObjectFootprint(*newObject);
+		}
+		for (const auto &valueDelta : delta.changedValues) {
+			size += sizeof(ValueDelta) + estimateMemoryFootprint(*valueDelta.oldValue) + estimateMemoryFootprint(*valueDelta.newValue);
+		}
+		size += (delta.addedLinks.size() + delta.removedLinks.size() + 2 * delta.changedLinks.size()) * sizeof(Link);
+		size += (delta.oldInstanceOrder.size() + delta.newInstanceOrder.size()) * sizeof(std::string);
+		entry.memoryFootprint = size;
+		return;
+	}
+
+	if (merged) {
+		// All changed objects are owned by the entry after the merge, including the ones which were
+		// shared with the previous entry before (see updateProjectState).
+		for (const auto &obj : context_->modelChanges().getAllChangedObjects()) {
+			if (auto stateObj = entry.state.getInstanceByID(obj->objectID())) {
+				auto &size = entry.ownedObjectSizes[obj->objectID()];
+				entry.memoryFootprint -= size;
+				size = estimateObjectFootprint(*stateObj);
+				entry.memoryFootprint += size;
+			}
+		}
+	} else {
+		const Project *previous = stack_.size() > 1 ? &stack_[stack_.size() - 2]->state : nullptr;
+		entry.ownedObjectSizes.clear();
+		entry.memoryFootprint = 0;
+		for (const auto &obj : entry.state.instances()) {
+			if (!previous || previous->getInstanceByID(obj->objectID()) != obj) {
+				auto size = estimateObjectFootprint(*obj);
+				entry.ownedObjectSizes[obj->objectID()] = size;
+				entry.memoryFootprint += size;
+			}
+		}
+	}
+}
+
+void UndoStack::evictEntries() {
+	auto footprint = memoryFootprint();
+	while (index_ > 0 && ((maxEntries_ > 0 && stack_.size() > maxEntries_) || (maxMemoryBytes_ > 0 && footprint > maxMemoryBytes_))) {
+		auto &front = *stack_[0];
+		auto &next = *stack_[1];
+		footprint -= front.memoryFootprint;
+		if (mode_ == StorageMode::Delta) {
+			// The delta of the new first entry would lead to the dropped state and is never applied.
+			footprint -= next.memoryFootprint;
+			next.delta = Delta();
+			next.memoryFootprint = 0;
+		} else {
+			// Objects shared with the dropped entry are now owned by its successor.
+			for (const auto &[objectID, size] : front.ownedObjectSizes) {
+				if (next.state.getInstanceByID(objectID) == front.state.getInstanceByID(objectID)) {
+					next.ownedObjectSizes[objectID] = size;
+					next.memoryFootprint += size;
+					footprint += size;
+				}
+			}
+		}
+		stack_.erase(stack_.begin());
+		--index_;
+	}
+}
+
+void UndoStack::setMemoryBudget(size_t maxEntries, size_t maxMemoryBytes) {
+	maxEntries_ = maxEntries;
+	maxMemoryBytes_ = maxMemoryBytes;
+	if (depth_ == 0) {
+		auto oldSize = stack_.size();
+		evictEntries();
+		if (stack_.size() != oldSize) {
+			onChange_();
+		}
+	}
+}
+
+size_t UndoStack::maxEntries() const {
+	return maxEntries_;
+}
+
+size_t UndoStack::maxMemoryBytes() const {
+	return maxMemoryBytes_;
+}
+
+size_t UndoStack::memoryFootprint() const {
+	size_t size = 0;
+	for (const auto &entry : stack_) {
+		size += entry->memoryFootprint;
+	}
+	return size;
+}
+
 void UndoStack::beginCompositeCommand() {
 	depth_++;
 }
@@ -527,13 +1149,41 @@ size_t UndoStack::getIndex() const {
 size_t UndoStack::setIndex(size_t newIndex, bool force) {
 	assert(depth_ == 0);
 	if (newIndex < size() && (newIndex != index_ || force)) {
-		index_ = newIndex;
-		restoreProjectState(&stack_[index_]->state, context_->project(), *context_, *context_->objectFactory());
+		if (mode_ == StorageMode::Delta) {
+			setIndexDelta(newIndex, force);
+		} else {
+			index_ = newIndex;
+			restoreProjectState(&stack_[index_]->state, context_->project(), *context_, *context_->objectFactory());
+		}
 		onChange_();
 	}
 	return index_;
 }
 
+void UndoStack::setIndexDelta(size_t newIndex, bool force) {
+	auto project = context_->project();
+	auto &factory = *context_->objectFactory();
+	DataChangeRecorder changes;
+	bool extrefDirty = false;
+
+	if (force || !changeRecorderEmpty(context_->modelChanges())) {
+		// Roll back changes not yet pushed onto the stack: the mirror contains the state at the current index.
+		restoreProjectStateChanges(mirror_.get(), project, *context_, factory, changes, extrefDirty);
+	}
+
+	while (index_ > newIndex) {
+		applyDelta(stack_[index_]->delta, false, project, *context_, factory, changes, extrefDirty);
+		--index_;
+	}
+	while (index_ < newIndex) {
+		++index_;
+		applyDelta(stack_[index_]->delta, true, project, *context_, factory, changes, extrefDirty);
+	}
+
+	syncMirror(project, changes, factory);
+	finishRestore(project, changes, extrefDirty);
+}
+
 void UndoStack::undo() {
 	assert(depth_ == 0);
 	if (index_ > 0) {
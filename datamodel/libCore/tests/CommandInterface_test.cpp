@@ -14,10 +14,13 @@
 #include "user_types/AnimationChannelRaco.h"
 #include "user_types/LuaScript.h"
 #include "user_types/Node.h"
+#include "user_types/Prefab.h"
 #include "user_types/Timer.h"
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+
 using namespace raco::core;
 using namespace raco::user_types;
 
@@ -997,4 +1000,116 @@ TEST_F(CommandInterfaceTest, anim_channel_raco_set_data_fail_comp_size_mismatch_
 					 std::vector<std::vector<int>>({{0, 0}, {0, 0}, {0, 0}}),
 					 std::vector<std::vector<int>>({{1, 1}, {1, 1, 1}, {1, 1}})),
 		std::runtime_error);
-}
\ No newline at end of file
+}
+
+TEST_F(CommandInterfaceTest, transaction_defers_prefab_update) {
+	auto prefab = create<Prefab>("prefab");
+	auto inst = create<PrefabInstance>("inst");
+	commandInterface.set({inst, &PrefabInstance::template_}, prefab);
+	auto node = create<Node>("node", prefab);
+	auto inst_node = select<Node>(inst->children_->asVector<SEditorObject>());
+	ASSERT_NE(inst_node, nullptr);
+	auto undoIndex = undoStack.getIndex();
+
+	commandInterface.beginTransaction();
+	commandInterface.set({node, {"translation", "x"}}, 1.0);
+	commandInterface.set({node, {"translation", "y"}}, 2.0);
+	EXPECT_EQ(commandInterface.transactionDepth(), 1);
+	EXPECT_EQ(*inst_node->translation_->x, 0.0);
+	EXPECT_EQ(undoStack.getIndex(), undoIndex);
+	commandInterface.endTransaction("bulk edit");
+
+	EXPECT_EQ(commandInterface.transactionDepth(), 0);
+	EXPECT_EQ(*inst_node->translation_->x, 1.0);
+	EXPECT_EQ(*inst_node->translation_->y, 2.0);
+	EXPECT_EQ(undoStack.getIndex(), undoIndex + 1);
+	EXPECT_EQ(undoStack.description(undoStack.getIndex()), "bulk edit");
+
+	undoStack.undo();
+	EXPECT_EQ(*inst_node->translation_->x, 0.0);
+	EXPECT_EQ(*inst_node->translation_->y, 0.0);
+}
+
+TEST_F(CommandInterfaceTest, transaction_nested_updates_prefabs_at_outermost_end) {
+	auto prefab = create<Prefab>("prefab");
+	auto inst = create<PrefabInstance>("inst");
+	commandInterface.set({inst, &PrefabInstance::template_}, prefab);
+	auto node = create<Node>("node", prefab);
+	auto inst_node = select<Node>(inst->children_->asVector<SEditorObject>());
+	auto undoIndex = undoStack.getIndex();
+
+	commandInterface.executeTransaction([&]() {
+		commandInterface.executeTransaction([&]() {
+			commandInterface.set({node, {"translation", "x"}}, 1.0);
+		},
+			"inner");
+		EXPECT_EQ(*inst_node->translation_->x, 0.0);
+		commandInterface.executeCompositeCommand([&]() {
+			commandInterface.set({node, {"translation", "y"}}, 2.0);
+		},
+			"composite");
+		EXPECT_EQ(*inst_node->translation_->y, 0.0);
+	},
+		"outer");
+
+	EXPECT_EQ(*inst_node->translation_->x, 1.0);
+	EXPECT_EQ(*inst_node->translation_->y, 2.0);
+	EXPECT_EQ(undoStack.getIndex(), undoIndex + 1);
+	EXPECT_EQ(undoStack.description(undoStack.getIndex()), "outer");
+}
+
+TEST_F(CommandInterfaceTest, transaction_exception_rolls_back) {
+	auto prefab = create<Prefab>("prefab");
+	auto inst = create<PrefabInstance>("inst");
+	commandInterface.set({inst, &PrefabInstance::template_}, prefab);
+	auto node = create<Node>("node", prefab);
+	auto inst_node = select<Node>(inst->children_->asVector<SEditorObject>());
+	auto undoIndex = undoStack.getIndex();
+
+	EXPECT_THROW(commandInterface.executeTransaction([&]() {
+		commandInterface.set({node, {"translation", "x"}}, 1.0);
+		commandInterface.set({node, {"no_such_property"}}, 1.0);
+	},
+					 "failing"),
+		std::runtime_error);
+
+	EXPECT_EQ(commandInterface.transactionDepth(), 0);
+	EXPECT_EQ(undoStack.getIndex(), undoIndex);
+	EXPECT_EQ(*node->translation_->x, 0.0);
+	EXPECT_EQ(*inst_node->translation_->x, 0.0);
+}
+
+#ifdef NDEBUG
+TEST_F(CommandInterfaceTest, benchmark_bulk_edit_with_and_without_transaction) {
+	constexpr int numNodes = 100;
+	constexpr int numInstances = 20;
+	constexpr int numEdits = 2000;
+
+	auto prefab = create<Prefab>("prefab");
+	std::vector<SEditorObject> nodes;
+	for (int index = 0; index < numNodes; index++) {
+		nodes.emplace_back(create<Node>("node" + std::to_string(index), prefab));
+	}
+	for (int index = 0; index < numInstances; index++) {
+		auto inst = create<PrefabInstance>("inst" + std::to_string(index));
+		commandInterface.set({inst, &PrefabInstance::template_}, prefab);
+	}
+
+	auto bulkEdit = [&](double value) {
+		for (int edit = 0; edit < numEdits; edit++) {
+			commandInterface.set({nodes[edit % numNodes], {"translation", "x"}}, value + edit);
+		}
+	};
+
+	auto start = std::chrono::steady_clock::now();
+	commandInterface.executeCompositeCommand([&]() { bulkEdit(1.0); }, "composite command");
+	auto compositeElapsed = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	commandInterface.executeTransaction([&]() { bulkEdit(2.0); }, "transaction");
+	auto transactionElapsed = std::chrono::steady_clock::now() - start;
+
+	// The transaction updates the prefab instances once at the end instead of after every edit.
+	EXPECT_LT(transactionElapsed, compositeElapsed);
+}
+#endif
@@ -556,6 +556,72 @@ TEST_F(ContextTest, ValueHandleErrorDeletionOnObjectDeletion) {
 	ASSERT_FALSE(context.errors().hasError(handle));
 }
 
+TEST_F(ContextTest, ErrorRemovalByCategory) {
+	auto object = context.createObject(Node::typeDescription.typeName);
+	ValueHandle translation{object, {"translation"}};
+	ValueHandle rotation{object, {"rotation"}};
+	context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::ERROR, translation, "General Error");
+	context.errors().addError(ErrorCategory::RAMSES_LOGIC_RUNTIME, ErrorLevel::ERROR, rotation, "Runtime Error");
+	EXPECT_EQ(context.errors().getErrorHandles(ErrorCategory::RAMSES_LOGIC_RUNTIME), std::set<ValueHandle>({rotation}));
+
+	// Changing the category of an error moves it to the new category.
+	context.errors().addError(ErrorCategory::RAMSES_LOGIC_RUNTIME, ErrorLevel::ERROR, translation, "Runtime Error");
+	EXPECT_EQ(context.errors().getErrorHandles(ErrorCategory::RAMSES_LOGIC_RUNTIME), std::set<ValueHandle>({translation, rotation}));
+	EXPECT_TRUE(context.errors().getErrorHandles(ErrorCategory::GENERAL).empty());
+
+	EXPECT_TRUE(context.errors().removeIf(ErrorCategory::RAMSES_LOGIC_RUNTIME, [&translation](const ErrorItem& error) {
+		return error.valueHandle() == translation;
+	}));
+	EXPECT_FALSE(context.errors().hasError(translation));
+	EXPECT_TRUE(context.errors().hasError(rotation));
+
+	EXPECT_TRUE(context.errors().removeAll(ErrorCategory::RAMSES_LOGIC_RUNTIME));
+	EXPECT_FALSE(context.errors().removeAll(ErrorCategory::RAMSES_LOGIC_RUNTIME));
+	EXPECT_TRUE(context.errors().getAllErrors().empty());
+}
+
+TEST_F(ContextTest, ErrorRemovalOfContainedProperties) {
+	auto object = context.createObject(Node::typeDescription.typeName);
+	ValueHandle translation{object, {"translation"}};
+	ValueHandle rotationY{object, {"rotation", "y"}};
+	context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::ERROR, object, "Object Error");
+	context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::ERROR, translation, "Translation Error");
+	context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::ERROR, translation.get("x"), "Translation.x Error");
+	context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::ERROR, rotationY, "Rotation.y Error");
+
+	EXPECT_TRUE(context.errors().removeContained(translation));
+	EXPECT_TRUE(context.errors().hasError(translation));
+	EXPECT_FALSE(context.errors().hasError(translation.get("x")));
+	EXPECT_TRUE(context.errors().hasError(rotationY));
+	EXPECT_EQ(context.errors().getPropertyErrorHandles("rotation"), std::set<ValueHandle>({rotationY}));
+
+	EXPECT_TRUE(context.errors().removeContained(object));
+	EXPECT_TRUE(context.errors().hasError(object));
+	EXPECT_EQ(context.errors().getAllErrors().at(object).size(), 1);
+	EXPECT_TRUE(context.errors().getPropertyErrorHandles("translation").empty());
+}
+
+TEST_F(ContextTest, ErrorReplaceOnlyRecordsChanges) {
+	auto node1 = context.createObject(Node::typeDescription.typeName);
+	auto node2 = context.createObject(Node::typeDescription.typeName);
+	auto node3 = context.createObject(Node::typeDescription.typeName);
+	ValueHandle handle1{node1, {"visibility"}};
+	ValueHandle handle2{node2, {"visibility"}};
+	ValueHandle handle3{node3, {"visibility"}};
+	context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::WARNING, handle1, "Warning");
+	context.errors().addError(ErrorCategory::GENERAL, ErrorLevel::WARNING, handle2, "Warning");
+	recorder.reset();
+
+	context.errors().replaceErrors(context.errors().getPropertyErrorHandles("visibility"),
+		{ErrorItem(ErrorCategory::GENERAL, ErrorLevel::WARNING, handle2, "Warning"),
+			ErrorItem(ErrorCategory::GENERAL, ErrorLevel::WARNING, handle3, "Warning")});
+
+	EXPECT_FALSE(context.errors().hasError(handle1));
+	EXPECT_TRUE(context.errors().hasError(handle2));
+	EXPECT_TRUE(context.errors().hasError(handle3));
+	EXPECT_EQ(recorder.getChangedErrors(), std::set<ValueHandle>({handle1, handle3}));
+}
+
 TEST_F(ContextTest, copyAndPasteObjectSimple) {
 	auto node = context.createObject(Node::typeDescription.typeName);
 	context.pasteObjects(context.copyObjects({ node }));
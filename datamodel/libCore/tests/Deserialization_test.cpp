@@ -7,6 +7,9 @@
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
  * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
+#include "core/BinarySerialization.h"
+#include "core/JsonScanner.h"
+#include "core/ProjectObjectIndex.h"
 #include "core/Serialization.h"
 #include "core/SerializationKeys.h"
 
@@ -20,6 +23,14 @@
 #include "user_types/Texture.h"
 
 #include "utils/FileUtils.h"
+#include "utils/ParallelUtils.h"
+
+#include <chrono>
+#include <sstream>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
 
 #include <gtest/gtest.h>
 
@@ -36,6 +47,29 @@ struct DeserializationTest : public TestEnvironmentCore {
 	std::optional<serialization::ObjectsDeserialization> deserializeObjects(const std::string& fileName) {
 		return serialization::deserializeObjects(utils::file::read(test_path() / "expectations" / fileName), false, *context.objectFactory());
 	}
+
+	std::string serializeCurrentProject() {
+		std::vector<SReflectionInterface> instances{project.instances().begin(), project.instances().end()};
+		std::vector<SReflectionInterface> links;
+		for (const auto& link : project.links()) {
+			links.push_back(link);
+		}
+		std::unordered_map<std::string, std::vector<int>> fileVersions{
+			{serialization::keys::FILE_VERSION, {serialization::RAMSES_PROJECT_FILE_VERSION}},
+			{serialization::keys::RAMSES_VERSION, {1, 0, 0}},
+			{serialization::keys::RAMSES_COMPOSER_VERSION, {1, 0, 0}}};
+		return serialization::serializeProject(fileVersions, project.featureLevel(), instances, links, project.externalProjectsMap()).toJson().toStdString();
+	}
+
+	// Project with 2000 nodes with 4 MeshNode children each for the benchmarks.
+	void create10000Nodes() {
+		for (int index = 0; index < 2000; index++) {
+			auto node = create<user_types::Node>(fmt::format("node_{}", index));
+			for (int child = 0; child < 4; child++) {
+				create<user_types::MeshNode>(fmt::format("meshnode_{}_{}", index, child), node);
+			}
+		}
+	}
 };
 
 TEST_F(DeserializationTest, deserializeNode) {
@@ -266,3 +300,342 @@ TEST_F(DeserializationTest, deserializeArrays) {
 	EXPECT_EQ(array_ref.get(0)->asRef(), node_1);
 	EXPECT_EQ(array_ref.get(1)->asRef(), node_2);
 }
+
+TEST_F(DeserializationTest, jsonScanner_skipAndReadRaw) {
+	std::istringstream stream{R"({"a": [1, {"b": "]}\"[{"}, true], "c" : {"d": null}, "e": -1.5e3})"};
+	serialization::JsonScanner scanner{stream};
+
+	std::string key;
+	std::string raw;
+	scanner.beginObject();
+	ASSERT_TRUE(scanner.nextKey(key));
+	EXPECT_EQ(key, "a");
+	auto arrayOffset = scanner.offset();
+	scanner.skipValue();
+
+	ASSERT_TRUE(scanner.nextKey(key));
+	EXPECT_EQ(key, "c");
+	scanner.readRawValue(raw);
+	EXPECT_EQ(raw, R"({"d": null})");
+
+	ASSERT_TRUE(scanner.nextKey(key));
+	EXPECT_EQ(key, "e");
+	scanner.readRawValue(raw);
+	EXPECT_EQ(raw, "-1.5e3");
+	EXPECT_FALSE(scanner.nextKey(key));
+
+	scanner.seek(arrayOffset);
+	scanner.beginArray();
+	std::vector<std::string> elements;
+	while (scanner.nextElement()) {
+		scanner.readRawValue(raw);
+		elements.push_back(raw);
+	}
+	EXPECT_EQ(elements, (std::vector<std::string>{"1", R"({"b": "]}\"[{"})", "true"}));
+}
+
+TEST_F(DeserializationTest, jsonScanner_truncated_throws) {
+	std::istringstream stream{R"({"a": [1, {"b": 2})"};
+	serialization::JsonScanner scanner{stream};
+	std::string key;
+	scanner.beginObject();
+	ASSERT_TRUE(scanner.nextKey(key));
+	EXPECT_THROW(scanner.skipValue(), std::runtime_error);
+}
+
+TEST_F(DeserializationTest, deserializeProject_stream_matches_document) {
+	auto mesh = create<user_types::Mesh>("mesh");
+	auto node = create<user_types::Node>("node");
+	auto meshNode = create<user_types::MeshNode>("meshnode", node);
+	commandInterface.set({meshNode, &user_types::MeshNode::mesh_}, mesh);
+	commandInterface.set({node, {"translation", "x"}}, 2.0);
+
+	auto json = serializeCurrentProject();
+	auto fromDocument = serialization::deserializeProject(QJsonDocument::fromJson(QByteArray::fromStdString(json)), "project.rca");
+
+	std::istringstream stream{json};
+	auto header = serialization::deserializeProjectHeader(stream);
+	EXPECT_GE(header.instancesOffset, 0);
+	EXPECT_FALSE(header.document.object().contains(serialization::keys::INSTANCES));
+	auto fromStream = serialization::deserializeProject(stream, header, "project.rca");
+
+	EXPECT_EQ(fromStream.fileVersion, fromDocument.fileVersion);
+	EXPECT_EQ(fromStream.currentPath, "project.rca");
+	ASSERT_EQ(fromStream.objects.size(), fromDocument.objects.size());
+	ASSERT_EQ(fromStream.links.size(), fromDocument.links.size());
+	for (size_t index = 0; index < fromStream.objects.size(); index++) {
+		const auto& streamed = fromStream.objects[index];
+		const auto& expected = fromDocument.objects[index];
+		EXPECT_EQ(streamed->objectID(), expected->objectID());
+		EXPECT_EQ(streamed->serializationTypeName(), expected->serializationTypeName());
+		EXPECT_EQ(serialization::test_helpers::serializeObject(streamed), serialization::test_helpers::serializeObject(expected));
+	}
+
+	auto streamedMeshNode = select<user_types::MeshNode>(fromStream.objects);
+	auto streamedNode = select<user_types::Node>(fromStream.objects, "node");
+	ASSERT_TRUE(streamedMeshNode != nullptr);
+	EXPECT_EQ(*streamedMeshNode->mesh_, select<user_types::Mesh>(fromStream.objects));
+	EXPECT_EQ(streamedMeshNode->getParent(), streamedNode);
+}
+
+TEST_F(DeserializationTest, deserializeProject_parallel_matches_serial) {
+	auto mesh = create<user_types::Mesh>("mesh");
+	for (int index = 0; index < 1000; index++) {
+		auto node = create<user_types::Node>(fmt::format("node_{}", index));
+		auto meshNode = create<user_types::MeshNode>(fmt::format("meshnode_{}", index), node);
+		commandInterface.set({meshNode, &user_types::MeshNode::mesh_}, mesh);
+	}
+	auto json = serializeCurrentProject();
+
+	auto deserialize = [&json](size_t workerCount) {
+		utils::parallel::setWorkerCount(workerCount);
+		std::istringstream stream{json};
+		auto header = serialization::deserializeProjectHeader(stream);
+		auto result = serialization::deserializeProject(stream, header, "project.rca");
+		utils::parallel::setWorkerCount(0);
+		return result;
+	};
+	auto serial = deserialize(1);
+	auto parallel = deserialize(4);
+
+	ASSERT_EQ(parallel.objects.size(), serial.objects.size());
+	for (size_t index = 0; index < serial.objects.size(); index++) {
+		EXPECT_EQ(serialization::test_helpers::serializeObject(parallel.objects[index]), serialization::test_helpers::serializeObject(serial.objects[index]));
+	}
+
+	auto parallelMesh = select<user_types::Mesh>(parallel.objects);
+	for (const auto& object : parallel.objects) {
+		if (auto meshNode = std::dynamic_pointer_cast<user_types::MeshNode>(object)) {
+			EXPECT_EQ(*meshNode->mesh_, parallelMesh);
+			EXPECT_EQ(meshNode->getParent()->objectName(), "node_" + meshNode->objectName().substr(std::string("meshnode_").size()));
+		}
+	}
+}
+
+TEST_F(DeserializationTest, binaryProject_roundtrip) {
+	auto mesh = create<user_types::Mesh>("mesh");
+	auto node = create<user_types::Node>("node");
+	auto meshNode = create<user_types::MeshNode>("meshnode", node);
+	commandInterface.set({meshNode, &user_types::MeshNode::mesh_}, mesh);
+	commandInterface.set({node, {"translation", "x"}}, 2.5);
+	commandInterface.set({node, {"translation", "y"}}, -3.0);
+	commandInterface.setTags({node, &user_types::Node::tags_}, std::vector<std::string>{u8"\u00e4", "tag"});
+
+	auto document = QJsonDocument::fromJson(QByteArray::fromStdString(serializeCurrentProject()));
+	auto binary = serialization::convertJsonToBinary(document);
+	ASSERT_TRUE(serialization::isBinaryProject(binary));
+	EXPECT_FALSE(serialization::isBinaryProject(document.toJson().toStdString()));
+	EXPECT_EQ(serialization::convertBinaryToJson(binary), document);
+
+	auto content = serialization::decodeBinaryProject(binary);
+	EXPECT_FALSE(content.header.object().contains(serialization::keys::INSTANCES));
+	EXPECT_EQ(content.instances.size(), document[serialization::keys::INSTANCES].toArray().size());
+	EXPECT_EQ(serialization::decodeBinaryProjectHeader(binary), content.header);
+
+	auto fromDocument = serialization::deserializeProject(document, "project.rca");
+	auto fromBinary = serialization::deserializeProject(content.header, content.instances, content.links, "project.rca");
+	ASSERT_EQ(fromBinary.objects.size(), fromDocument.objects.size());
+	for (size_t index = 0; index < fromBinary.objects.size(); index++) {
+		EXPECT_EQ(serialization::test_helpers::serializeObject(fromBinary.objects[index]), serialization::test_helpers::serializeObject(fromDocument.objects[index]));
+	}
+	auto binaryMeshNode = select<user_types::MeshNode>(fromBinary.objects);
+	EXPECT_EQ(*binaryMeshNode->mesh_, select<user_types::Mesh>(fromBinary.objects));
+}
+
+TEST_F(DeserializationTest, binaryProject_invalid_throws) {
+	auto binary = serialization::convertJsonToBinary(QJsonDocument::fromJson(QByteArray::fromStdString(serializeCurrentProject())));
+
+	EXPECT_THROW(serialization::convertBinaryToJson("RCAB"), std::runtime_error);
+	EXPECT_THROW(serialization::convertBinaryToJson(binary.substr(0, binary.size() / 2)), std::runtime_error);
+	EXPECT_THROW(serialization::decodeBinaryProject(binary.substr(0, binary.size() - 1)), std::runtime_error);
+
+	auto wrongVersion = binary;
+	wrongVersion[4] = 99;
+	EXPECT_THROW(serialization::decodeBinaryProject(wrongVersion), std::runtime_error);
+}
+
+TEST_F(DeserializationTest, projectObjectIndex_select_followsParentsReferencesAndLinks) {
+	serialization::ProjectObjectIndex index;
+	index.objects = {
+		{"settings", core::ProjectSettings::typeDescription.typeName, "", {}},
+		{"root", "Node", "", {"child"}},
+		{"child", "MeshNode", "root", {"mesh"}},
+		{"mesh", "Mesh", "", {"material"}},
+		{"material", "Material", "", {}},
+		{"camera", "PerspectiveCamera", "camera_parent", {}},
+		{"camera_parent", "Node", "", {"camera"}},
+		{"renderpass", "RenderPass", "", {"camera"}},
+		{"script", "LuaScript", "", {}},
+		{"unused", "Node", "", {}}};
+	index.links = {
+		{"script", "child"},
+		{"unused", "renderpass"}};
+
+	auto selection = index.select({"root", "does_not_exist"});
+	EXPECT_EQ(selection.instances, (std::vector<bool>{true, true, true, true, true, false, false, false, true, false}));
+	EXPECT_EQ(selection.links, (std::vector<bool>{true, false}));
+
+	selection = index.select({"renderpass"});
+	EXPECT_EQ(selection.instances, (std::vector<bool>{true, false, false, false, false, true, true, true, false, true}));
+	EXPECT_EQ(selection.links, (std::vector<bool>{false, true}));
+}
+
+TEST_F(DeserializationTest, projectObjectIndex_serialize_roundtrip) {
+	auto node = create<user_types::Node>("node");
+	auto meshNode = create<user_types::MeshNode>("meshnode", node);
+	auto mesh = create<user_types::Mesh>("mesh");
+	commandInterface.set({meshNode, &user_types::MeshNode::mesh_}, mesh);
+
+	auto index = serialization::ProjectObjectIndex::create(project.instances(), {});
+	index.fileHash = serialization::ProjectObjectIndex::hashFileContent("content");
+	std::istringstream contentStream{"content"};
+	EXPECT_EQ(serialization::ProjectObjectIndex::hashFileContent(contentStream), index.fileHash);
+	EXPECT_NE(serialization::ProjectObjectIndex::hashFileContent("Content"), index.fileHash);
+
+	auto meshNodeEntry = std::find_if(index.objects.begin(), index.objects.end(), [&meshNode](const auto& entry) { return entry.id == meshNode->objectID(); });
+	ASSERT_NE(meshNodeEntry, index.objects.end());
+	EXPECT_EQ(meshNodeEntry->parentID, node->objectID());
+	EXPECT_NE(std::find(meshNodeEntry->references.begin(), meshNodeEntry->references.end(), mesh->objectID()), meshNodeEntry->references.end());
+
+	auto deserialized = serialization::ProjectObjectIndex::deserialize(index.serialize());
+	ASSERT_TRUE(deserialized.has_value());
+	EXPECT_EQ(deserialized->fileHash, index.fileHash);
+	ASSERT_EQ(deserialized->objects.size(), index.objects.size());
+	for (size_t i = 0; i < index.objects.size(); i++) {
+		EXPECT_EQ(deserialized->objects[i].id, index.objects[i].id);
+		EXPECT_EQ(deserialized->objects[i].typeName, index.objects[i].typeName);
+		EXPECT_EQ(deserialized->objects[i].parentID, index.objects[i].parentID);
+		EXPECT_EQ(deserialized->objects[i].references, index.objects[i].references);
+	}
+
+	EXPECT_FALSE(serialization::ProjectObjectIndex::deserialize("{}").has_value());
+	EXPECT_FALSE(serialization::ProjectObjectIndex::deserialize("not json").has_value());
+}
+
+TEST_F(DeserializationTest, deserializeProject_selection_loads_only_selected_objects) {
+	auto mesh = create<user_types::Mesh>("mesh");
+	create<user_types::Mesh>("unused_mesh");
+	auto node = create<user_types::Node>("node");
+	auto meshNode = create<user_types::MeshNode>("meshnode", node);
+	commandInterface.set({meshNode, &user_types::MeshNode::mesh_}, mesh);
+	create<user_types::Node>("unused_node");
+
+	auto json = serializeCurrentProject();
+	std::vector<core::SLink> links{project.links().begin(), project.links().end()};
+	auto selection = serialization::ProjectObjectIndex::create(project.instances(), links).select({node->objectID()});
+
+	auto checkResult = [](const std::vector<core::SEditorObject>& objects) {
+		std::set<std::string> names;
+		for (const auto& object : objects) {
+			names.insert(object->objectName());
+		}
+		EXPECT_EQ(names, (std::set<std::string>{"ProjectSettings", "mesh", "node", "meshnode"}));
+	};
+
+	std::istringstream stream{json};
+	auto header = serialization::deserializeProjectHeader(stream);
+	auto fromStream = serialization::deserializeProject(stream, header, "project.rca", &selection);
+	checkResult(fromStream.objects);
+	auto streamedMeshNode = select<user_types::MeshNode>(fromStream.objects);
+	EXPECT_EQ(*streamedMeshNode->mesh_, select<user_types::Mesh>(fromStream.objects));
+	EXPECT_EQ(streamedMeshNode->getParent(), select<user_types::Node>(fromStream.objects, "node"));
+
+	auto binary = serialization::convertJsonToBinary(QJsonDocument::fromJson(QByteArray::fromStdString(json)));
+	auto content = serialization::decodeBinaryProject(binary, &selection);
+	checkResult(serialization::deserializeProject(content.header, content.instances, content.links, "project.rca").objects);
+
+	auto wrongSelection = selection;
+	wrongSelection.instances.pop_back();
+	std::istringstream wrongStream{json};
+	auto wrongHeader = serialization::deserializeProjectHeader(wrongStream);
+	EXPECT_THROW(serialization::deserializeProject(wrongStream, wrongHeader, "project.rca", &wrongSelection), std::runtime_error);
+	EXPECT_THROW(serialization::decodeBinaryProject(binary, &wrongSelection), std::runtime_error);
+}
+
+#ifdef NDEBUG
+TEST_F(DeserializationTest, benchmark_binaryProject_vs_json_10000_nodes) {
+	create10000Nodes();
+	auto json = serializeCurrentProject();
+	auto binary = serialization::convertJsonToBinary(QJsonDocument::fromJson(QByteArray::fromStdString(json)));
+
+	auto start = std::chrono::steady_clock::now();
+	{
+		std::istringstream stream{json};
+		auto header = serialization::deserializeProjectHeader(stream);
+		serialization::deserializeProject(stream, header, "project.rca");
+	}
+	auto jsonMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+	start = std::chrono::steady_clock::now();
+	{
+		auto content = serialization::decodeBinaryProject(binary);
+		serialization::deserializeProject(content.header, content.instances, content.links, "project.rca");
+	}
+	auto binaryMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+	EXPECT_LT(binary.size(), json.size());
+	EXPECT_LE(binaryMs, jsonMs);
+}
+
+TEST_F(DeserializationTest, benchmark_deserializeProject_parallel_10000_nodes) {
+	create10000Nodes();
+	auto json = serializeCurrentProject();
+
+	auto timeDeserialization = [&json](size_t workerCount) {
+		utils::parallel::setWorkerCount(workerCount);
+		auto start = std::chrono::steady_clock::now();
+		std::istringstream stream{json};
+		auto header = serialization::deserializeProjectHeader(stream);
+		serialization::deserializeProject(stream, header, "project.rca");
+		utils::parallel::setWorkerCount(0);
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	};
+
+	auto serialMs = timeDeserialization(1);
+	auto parallelMs = timeDeserialization(0);
+	if (utils::parallel::workerCount() >= 4) {
+		EXPECT_LT(parallelMs, serialMs);
+	}
+}
+
+TEST_F(DeserializationTest, benchmark_deserializeProject_stream_vs_document_10000_nodes) {
+	create10000Nodes();
+	auto json = serializeCurrentProject();
+
+	auto maxResidentKB = []() -> long {
+#ifdef __linux__
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		return usage.ru_maxrss;
+#else
+		return 0;
+#endif
+	};
+
+	// The streaming variant runs first: the peak resident size only grows, so the increase caused by
+	// the document based variant afterwards shows its additional memory overhead.
+	auto rssBefore = maxResidentKB();
+	auto start = std::chrono::steady_clock::now();
+	{
+		std::istringstream stream{json};
+		auto header = serialization::deserializeProjectHeader(stream);
+		auto result = serialization::deserializeProject(stream, header, "project.rca");
+		EXPECT_EQ(result.objects.size(), project.instances().size());
+	}
+	auto streamMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	auto rssStream = maxResidentKB();
+
+	start = std::chrono::steady_clock::now();
+	{
+		auto result = serialization::deserializeProject(QJsonDocument::fromJson(QByteArray::fromStdString(json)), "project.rca");
+		EXPECT_EQ(result.objects.size(), project.instances().size());
+	}
+	auto documentMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	auto rssDocument = maxResidentKB();
+
+	// The streaming variant doesn't build the document: it must neither be slower nor need more memory.
+	// The constant allows for timer resolution and noise.
+	EXPECT_LE(streamMs, documentMs + 50);
+	EXPECT_LE(rssStream - rssBefore, rssDocument - rssStream);
+}
+#endif
@@ -9,17 +9,20 @@
  */
 #include "application/RaCoApplication.h"
 #include "application/RaCoProject.h"
+#include "components/RaCoPreferences.h"
 #include "core/Context.h"
 #include "core/ExternalReferenceAnnotation.h"
 #include "core/Handles.h"
 #include "core/MeshCacheInterface.h"
 #include "core/Project.h"
+#include "core/ProjectObjectIndex.h"
 #include "core/Queries.h"
 #include "ramses_adaptor/SceneBackend.h"
 #include "ramses_base/HeadlessEngineBackend.h"
 #include "testing/RacoBaseTest.h"
 #include "testing/TestUtil.h"
 #include "user_types/UserObjectFactory.h"
+#include "utils/u8path.h"
 
 #include "user_types/Animation.h"
 #include "user_types/AnimationChannel.h"
@@ -39,6 +42,8 @@
 #include <filesystem>
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
 
 using namespace raco::core;
 using namespace raco::user_types;
@@ -2833,3 +2838,295 @@ end
 		checkLinks({{{global_interface, {"inputs", "u"}}, {inst_intf, {"inputs", "u"}}}});
 	});
 }
+
+TEST_F(ExtrefTest, partial_loading_loads_only_used_objects) {
+	raco::components::RaCoPreferences::instance().writeProjectObjectIndex = true;
+	auto basePathName{(test_path() / "base.rca").string()};
+	auto compositePathName{(test_path() / "composite.rca").string()};
+
+	setupBase(basePathName, [this]() {
+		auto prefab = create<Prefab>("Prefab");
+		create<Node>("prefab_child", prefab);
+		create<Node>("unused_node");
+		create<Prefab>("unused_prefab");
+	});
+	EXPECT_TRUE(utils::u8path(serialization::ProjectObjectIndex::indexFilePath(basePathName)).existsFile());
+
+	setupComposite(basePathName, compositePathName, {"Prefab"}, [this]() {
+		create_prefabInstance("inst", findExt<Prefab>("Prefab"));
+	});
+
+	RaCoApplicationLaunchSettings settings;
+	settings.initialProject = compositePathName.c_str();
+	settings.partialExternalProjectLoading = true;
+	RaCoApplication partialApp{backend, settings};
+	project = partialApp.activeRaCoProject().project();
+
+	auto prefab = findExt<Prefab>("Prefab");
+	findExt<Node>("prefab_child");
+	auto inst = find("inst")->as<PrefabInstance>();
+	EXPECT_EQ(*inst->template_, prefab);
+	EXPECT_EQ(inst->children_->size(), 1);
+
+	auto store = dynamic_cast<raco::application::ExternalProjectsStore *>(partialApp.externalProjects());
+	EXPECT_TRUE(store->isPartiallyLoaded(basePathName));
+	auto baseProject = partialApp.externalProjects()->getExternalProject(basePathName);
+	EXPECT_TRUE(Queries::findByName(baseProject->instances(), "prefab_child") != nullptr);
+	EXPECT_TRUE(Queries::findByName(baseProject->instances(), "unused_node") == nullptr);
+	EXPECT_TRUE(Queries::findByName(baseProject->instances(), "unused_prefab") == nullptr);
+
+	// Requests outside of an external reference update need the complete project
+	LoadContext loadContext;
+	auto fullProject = partialApp.externalProjects()->addExternalProject(basePathName, loadContext);
+	ASSERT_TRUE(fullProject != nullptr);
+	EXPECT_FALSE(store->isPartiallyLoaded(basePathName));
+	EXPECT_TRUE(Queries::findByName(fullProject->instances(), "unused_node") != nullptr);
+}
+
+TEST_F(ExtrefTest, partial_loading_nested) {
+	raco::components::RaCoPreferences::instance().writeProjectObjectIndex = true;
+	auto basePathName{(test_path() / "base.rca").string()};
+	auto midPathName{(test_path() / "mid.rca").string()};
+	auto compositePathName{(test_path() / "composite.rca").string()};
+
+	setupBase(basePathName, [this]() {
+		auto prefab = create<Prefab>("Prefab");
+		create<Node>("prefab_child", prefab);
+		create<Node>("unused_node");
+	});
+
+	setupComposite(basePathName, midPathName, {"Prefab"}, [this]() {
+		auto midPrefab = create<Prefab>("mid_prefab");
+		create_prefabInstance("mid_inst", findExt<Prefab>("Prefab"), midPrefab);
+		create<Node>("mid_unused");
+	}, "mid");
+
+	setupComposite(midPathName, compositePathName, {"mid_prefab"}, [this]() {
+		create_prefabInstance("inst", findExt<Prefab>("mid_prefab"));
+	});
+
+	RaCoApplicationLaunchSettings settings;
+	settings.initialProject = compositePathName.c_str();
+	settings.partialExternalProjectLoading = true;
+	RaCoApplication partialApp{backend, settings};
+	project = partialApp.activeRaCoProject().project();
+
+	findExt<Prefab>("mid_prefab");
+	findExt<PrefabInstance>("mid_inst");
+	findExt<Prefab>("Prefab");
+	findExt<Node>("prefab_child");
+	dontFind("mid_unused");
+	dontFind("unused_node");
+
+	auto store = dynamic_cast<raco::application::ExternalProjectsStore *>(partialApp.externalProjects());
+	EXPECT_TRUE(store->isPartiallyLoaded(basePathName));
+	EXPECT_TRUE(store->isPartiallyLoaded(midPathName));
+	EXPECT_TRUE(Queries::findByName(partialApp.externalProjects()->getExternalProject(midPathName)->instances(), "mid_unused") == nullptr);
+}
+
+TEST_F(ExtrefTest, partial_loading_outdated_index_loads_complete_project) {
+	raco::components::RaCoPreferences::instance().writeProjectObjectIndex = true;
+	auto basePathName{(test_path() / "base.rca").string()};
+	auto compositePathName{(test_path() / "composite.rca").string()};
+
+	setupBase(basePathName, [this]() {
+		auto prefab = create<Prefab>("Prefab");
+		create<Node>("prefab_child", prefab);
+		create<Node>("unused_node");
+	});
+
+	setupComposite(basePathName, compositePathName, {"Prefab"}, [this]() {
+		create_prefabInstance("inst", findExt<Prefab>("Prefab"));
+	});
+
+	// Modify the project file without updating the index
+	{
+		std::ofstream baseFile(utils::u8path(basePathName).internalPath(), std::ios::out | std::ios::app);
+		baseFile << "\n";
+	}
+
+	RaCoApplicationLaunchSettings settings;
+	settings.initialProject = compositePathName.c_str();
+	settings.partialExternalProjectLoading = true;
+	RaCoApplication partialApp{backend, settings};
+	project = partialApp.activeRaCoProject().project();
+
+	findExt<Prefab>("Prefab");
+	auto store = dynamic_cast<raco::application::ExternalProjectsStore *>(partialApp.externalProjects());
+	EXPECT_FALSE(store->isPartiallyLoaded(basePathName));
+	EXPECT_TRUE(Queries::findByName(partialApp.externalProjects()->getExternalProject(basePathName)->instances(), "unused_node") != nullptr);
+}
+
+TEST_F(ExtrefTest, project_cache_reuses_external_projects_across_loads) {
+	auto basePathName{(test_path() / "base.rca").string()};
+	auto composite1PathName{(test_path() / "composite1.rca").string()};
+	auto composite2PathName{(test_path() / "composite2.rca").string()};
+
+	setupBase(basePathName, [this]() {
+		auto prefab = create<Prefab>("Prefab");
+		create<Node>("prefab_child", prefab);
+	});
+
+	setupComposite(basePathName, composite1PathName, {"Prefab"}, [this]() {
+		create_prefabInstance("inst1", findExt<Prefab>("Prefab"));
+	}, "composite1");
+
+	setupComposite(basePathName, composite2PathName, {"Prefab"}, [this]() {
+		create_prefabInstance("inst2", findExt<Prefab>("Prefab"));
+	}, "composite2");
+
+	RaCoApplicationLaunchSettings settings;
+	settings.initialProject = composite1PathName.c_str();
+	settings.cacheExternalProjects = true;
+	RaCoApplication cachingApp{backend, settings};
+
+	auto store = dynamic_cast<raco::application::ExternalProjectsStore *>(cachingApp.externalProjects());
+	auto baseProject = store->getExternalProject(basePathName);
+	ASSERT_TRUE(baseProject != nullptr);
+	EXPECT_FALSE(store->isCached(basePathName));
+
+	cachingApp.switchActiveRaCoProject(composite2PathName.c_str(), {});
+	project = cachingApp.activeRaCoProject().project();
+	findExt<Prefab>("Prefab");
+	EXPECT_EQ(find("inst2")->as<PrefabInstance>()->children_->size(), 1);
+	EXPECT_EQ(store->getExternalProject(basePathName), baseProject);
+	EXPECT_FALSE(store->isCached(basePathName));
+
+	// Projects not used by the active project stay in the cache
+	cachingApp.switchActiveRaCoProject(QString(), {});
+	EXPECT_FALSE(store->isExternalProject(basePathName));
+	EXPECT_TRUE(store->isCached(basePathName));
+
+	store->clearProjectCache();
+	EXPECT_FALSE(store->isCached(basePathName));
+}
+
+TEST_F(ExtrefTest, project_cache_reloads_changed_external_project) {
+	auto basePathName{(test_path() / "base.rca").string()};
+	auto compositePathName{(test_path() / "composite.rca").string()};
+
+	setupBase(basePathName, [this]() {
+		auto prefab = create<Prefab>("Prefab");
+		create<Node>("prefab_child", prefab);
+	});
+
+	setupComposite(basePathName, compositePathName, {"Prefab"}, [this]() {
+		create_prefabInstance("inst", findExt<Prefab>("Prefab"));
+	});
+
+	RaCoApplicationLaunchSettings settings;
+	settings.initialProject = compositePathName.c_str();
+	settings.cacheExternalProjects = true;
+	RaCoApplication cachingApp{backend, settings};
+	auto store = dynamic_cast<raco::application::ExternalProjectsStore *>(cachingApp.externalProjects());
+
+	cachingApp.switchActiveRaCoProject(QString(), {});
+	EXPECT_TRUE(store->isCached(basePathName));
+
+	updateBase(basePathName, [this]() {
+		create<Node>("new_child", find("Prefab"));
+	});
+
+	cachingApp.switchActiveRaCoProject(compositePathName.c_str(), {});
+	project = cachingApp.activeRaCoProject().project();
+	EXPECT_FALSE(store->isCached(basePathName));
+	findExt<Node>("new_child");
+	EXPECT_EQ(find("inst")->as<PrefabInstance>()->children_->size(), 2);
+	EXPECT_TRUE(Queries::findByName(store->getExternalProject(basePathName)->instances(), "new_child") != nullptr);
+}
+
+TEST_F(ExtrefTest, project_cache_reloads_project_using_changed_external_project) {
+	auto basePathName{(test_path() / "base.rca").string()};
+	auto midPathName{(test_path() / "mid.rca").string()};
+	auto compositePathName{(test_path() / "composite.rca").string()};
+
+	setupBase(basePathName, [this]() {
+		auto prefab = create<Prefab>("Prefab");
+		create<Node>("prefab_child", prefab);
+	});
+
+	setupComposite(basePathName, midPathName, {"Prefab"}, [this]() {
+		auto midPrefab = create<Prefab>("mid_prefab");
+		create_prefabInstance("mid_inst", findExt<Prefab>("Prefab"), midPrefab);
+	}, "mid");
+
+	setupComposite(midPathName, compositePathName, {"mid_prefab"}, [this]() {
+		create_prefabInstance("inst", findExt<Prefab>("mid_prefab"));
+	});
+
+	RaCoApplicationLaunchSettings settings;
+	settings.initialProject = compositePathName.c_str();
+	settings.cacheExternalProjects = true;
+	RaCoApplication cachingApp{backend, settings};
+	auto store = dynamic_cast<raco::application::ExternalProjectsStore *>(cachingApp.externalProjects());
+
+	cachingApp.switchActiveRaCoProject(QString(), {});
+	EXPECT_TRUE(store->isCached(basePathName));
+	EXPECT_TRUE(store->isCached(midPathName));
+
+	// The mid project file is unchanged but its cached content is outdated
+	updateBase(basePathName, [this]() {
+		create<Node>("new_child", find("Prefab"));
+	});
+
+	cachingApp.switchActiveRaCoProject(compositePathName.c_str(), {});
+	project = cachingApp.activeRaCoProject().project();
+	findExt<Node>("new_child");
+	EXPECT_TRUE(Queries::findByName(store->getExternalProject(midPathName)->instances(), "new_child") != nullptr);
+}
+
+#ifdef NDEBUG
+TEST_F(ExtrefTest, benchmark_partial_loading_12_libraries) {
+	raco::components::RaCoPreferences::instance().writeProjectObjectIndex = true;
+	constexpr int numLibraries = 12;
+	auto compositePathName{(test_path() / "composite.rca").string()};
+
+	std::vector<std::string> libraryPaths;
+	for (int index = 0; index < numLibraries; index++) {
+		libraryPaths.emplace_back((test_path() / fmt::format("lib_{}.rca", index)).string());
+		setupBase(libraryPaths.back(), [this]() {
+			auto prefab = create<Prefab>("Prefab");
+			create<Node>("prefab_child", prefab);
+			auto node = create<Node>("node");
+			create<Node>("child", node);
+			// Double the number of nodes with every paste: 2 * 2^10 = 2048 unused nodes per library
+			for (int step = 0; step < 10; step++) {
+				std::vector<SEditorObject> topLevelNodes;
+				std::copy_if(project->instances().begin(), project->instances().end(), std::back_inserter(topLevelNodes), [](auto object) {
+					return object->template isType<Node>() && !object->getParent();
+				});
+				cmd->pasteObjects(cmd->copyObjects(topLevelNodes));
+			}
+		}, fmt::format("lib_{}", index));
+	}
+
+	setupGeneric([this, &libraryPaths, compositePathName]() {
+		for (int index = 0; index < numLibraries; index++) {
+			std::vector<SEditorObject> pasted;
+			ASSERT_TRUE(pasteFromExt(libraryPaths[index], {"Prefab"}, true, &pasted));
+			create_prefabInstance(fmt::format("inst_{}", index), pasted.front()->as<Prefab>());
+		}
+		std::string msg;
+		ASSERT_TRUE(app->activeRaCoProject().saveAs(compositePathName.c_str(), msg));
+	});
+
+	auto loadMs = [this, compositePathName](bool partial) {
+		RaCoApplicationLaunchSettings settings;
+		settings.initialProject = compositePathName.c_str();
+		settings.partialExternalProjectLoading = partial;
+		auto start = std::chrono::steady_clock::now();
+		RaCoApplication loadedApp{backend, settings};
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+		project = loadedApp.activeRaCoProject().project();
+		EXPECT_EQ(countInstances<PrefabInstance>(), numLibraries);
+		EXPECT_EQ(countInstances<Prefab>(), numLibraries);
+		return elapsed;
+	};
+
+	// Warm up the file system cache first
+	loadMs(false);
+	auto partialMs = loadMs(true);
+	auto fullMs = loadMs(false);
+	EXPECT_LT(partialMs, fullMs);
+}
+#endif
@@ -35,6 +35,8 @@
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+
 using namespace raco::core;
 using namespace raco::user_types;
 
@@ -1136,3 +1138,79 @@ TEST_F(PrefabTest, set_volatile_not_propagated) {
 	EXPECT_EQ(*node->editorVisibility_, false);
 	EXPECT_EQ(*inst_node->editorVisibility_, true);
 }
+
+TEST_F(PrefabTest, update_nested_chain_in_single_update) {
+	auto prefab_1 = create<Prefab>("prefab 1");
+	auto node = create<Node>("node", prefab_1);
+	auto prefab_2 = create<Prefab>("prefab 2");
+	auto inst_1 = create_prefabInstance("inst 1", prefab_1, prefab_2);
+	auto prefab_3 = create<Prefab>("prefab 3");
+	auto inst_2 = create_prefabInstance("inst 2", prefab_2, prefab_3);
+	auto inst_3 = create_prefabInstance("inst 3", prefab_3);
+	auto unrelated = create<Node>("unrelated");
+
+	auto findNode = [](SEditorObject root) {
+		return select<Node>(std::vector<SEditorObject>(TreeIteratorAdaptor(root).begin(), TreeIteratorAdaptor(root).end()), "node");
+	};
+	auto inst_3_node = findNode(inst_3);
+	ASSERT_NE(inst_3_node, nullptr);
+
+	commandInterface.set({unrelated, {"translation", "x"}}, 2.0);
+	EXPECT_EQ(*inst_3_node->translation_->x, 0.0);
+
+	commandInterface.set({node, {"translation", "x"}}, 1.0);
+	EXPECT_EQ(*inst_3_node->translation_->x, 1.0);
+	EXPECT_EQ(*findNode(inst_1)->translation_->x, 1.0);
+	EXPECT_EQ(*findNode(inst_2)->translation_->x, 1.0);
+}
+
+TEST_F(PrefabTest, update_nested_delete_propagates_to_outer_instance) {
+	auto prefab_inner = create<Prefab>("prefab inner");
+	auto node = create<Node>("node", prefab_inner);
+	auto prefab_outer = create<Prefab>("prefab outer");
+	auto inst_inner = create_prefabInstance("inst inner", prefab_inner, prefab_outer);
+	auto inst_outer = create_prefabInstance("inst outer", prefab_outer);
+
+	auto findNode = [](SEditorObject root) {
+		return select<Node>(std::vector<SEditorObject>(TreeIteratorAdaptor(root).begin(), TreeIteratorAdaptor(root).end()), "node");
+	};
+	ASSERT_NE(findNode(inst_inner), nullptr);
+	ASSERT_NE(findNode(inst_outer), nullptr);
+
+	commandInterface.deleteObjects({node});
+	EXPECT_EQ(findNode(inst_inner), nullptr);
+	EXPECT_EQ(findNode(inst_outer), nullptr);
+}
+
+#ifdef NDEBUG
+TEST_F(PrefabTest, benchmark_global_prefab_update_with_many_prefabs) {
+	constexpr int numPrefabs = 200;
+	constexpr int numInstancesPerPrefab = 8;
+	constexpr int repetitions = 100;
+
+	std::vector<SEditorObject> prefabNodes;
+	for (int index = 0; index < numPrefabs; index++) {
+		auto prefab = create<Prefab>("prefab" + std::to_string(index));
+		prefabNodes.emplace_back(create<Node>("node", prefab));
+		for (int instIndex = 0; instIndex < numInstancesPerPrefab; instIndex++) {
+			create_prefabInstance("inst", prefab);
+		}
+	}
+	auto unrelated = create<Node>("unrelated");
+
+	auto measure = [this](SEditorObject object) {
+		auto start = std::chrono::steady_clock::now();
+		for (int repetition = 0; repetition < repetitions; repetition++) {
+			commandInterface.set({object, {"translation", "x"}}, static_cast<double>(repetition + 1));
+		}
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / repetitions;
+	};
+
+	auto unrelatedTime = measure(unrelated);
+	auto prefabTime = measure(prefabNodes.front());
+
+	// Only the changed prefab and its instances are updated instead of all prefabs in the project.
+	// The constant allows for timer resolution and noise.
+	EXPECT_LE(prefabTime, 10 * unrelatedTime + 500);
+}
+#endif
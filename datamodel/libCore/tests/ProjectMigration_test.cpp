@@ -9,6 +9,7 @@
  */
 #include "core/Queries.h"
 
+#include "core/BinarySerialization.h"
 #include "core/DynamicEditorObject.h"
 #include "core/ExternalReferenceAnnotation.h"
 #include "core/ProjectMigration.h"
@@ -44,6 +45,8 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 constexpr bool GENERATE_DIFF{false};
 
 using namespace raco::core;
@@ -75,6 +78,24 @@ struct MigrationTest : public TestEnvironmentCore {
 		}
 	}
 
+	// The streaming deserialization must create the same IR as the deserialization from the complete document.
+	void checkStreamingDeserialization(const QString& filename, const serialization::ProjectDeserializationInfoIR& expected) {
+		std::ifstream stream(filename.toStdString(), std::ios::binary);
+		ASSERT_TRUE(stream.good());
+		auto header{serialization::deserializeProjectHeader(stream)};
+		auto streamedIR{serialization::deserializeProjectToIR(stream, header, filename.toStdString())};
+
+		EXPECT_EQ(streamedIR.fileVersion, expected.fileVersion);
+		EXPECT_EQ(streamedIR.externalProjectsMap.size(), expected.externalProjectsMap.size());
+		EXPECT_EQ(streamedIR.links.size(), expected.links.size());
+		ASSERT_EQ(streamedIR.objects.size(), expected.objects.size());
+		for (size_t index = 0; index < expected.objects.size(); index++) {
+			EXPECT_EQ(streamedIR.objects[index]->objectID(), expected.objects[index]->objectID());
+			EXPECT_EQ(streamedIR.objects[index]->serializationTypeName(), expected.objects[index]->serializationTypeName());
+			EXPECT_EQ(streamedIR.objects[index]->size(), expected.objects[index]->size());
+		}
+	}
+
 	std::unique_ptr<application::RaCoProject> loadAndCheckJson(QString filename, int* outFileVersion = nullptr) {
 		QFile file{filename};
 		EXPECT_TRUE(file.open(QIODevice::ReadOnly | QIODevice::Text));
@@ -88,6 +109,8 @@ struct MigrationTest : public TestEnvironmentCore {
 
 		// Perform deserialization to IR and migration by hand to check output of migration code:
 		auto deserializedIR{serialization::deserializeProjectToIR(document, filename.toStdString())};
+		checkStreamingDeserialization(filename, deserializedIR);
+		EXPECT_EQ(serialization::convertBinaryToJson(serialization::convertJsonToBinary(document)), document);
 		auto& factory{serialization::proxy::ProxyObjectFactory::getInstance()};
 		serialization::migrateProject(deserializedIR, factory);
 		checkPropertyTypes(deserializedIR);
@@ -35,6 +35,8 @@
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <functional>
 
 using namespace raco::core;
@@ -2140,4 +2142,293 @@ TEST_F(UndoTest, volatile_no_undo) {
 
 	EXPECT_EQ(*node->visibility_, false);
 	EXPECT_EQ(*node->editorVisibility_, false);
-}
\ No newline at end of file
+}
+
+TEST_F(UndoTest, budget_max_entries_drops_oldest) {
+	auto node = create<Node>("node");
+	ValueHandle translation_x{node, {"translation", "x"}};
+	ValueHandle translation_y{node, {"translation", "y"}};
+
+	undoStack.setMemoryBudget(3, 0);
+
+	commandInterface.set(translation_x, 1.0);
+	commandInterface.set(translation_y, 2.0);
+	commandInterface.set(translation_x, 3.0);
+	EXPECT_EQ(undoStack.size(), 3);
+	EXPECT_EQ(undoStack.getIndex(), 2);
+
+	undoStack.setIndex(0);
+	EXPECT_EQ(translation_x.asDouble(), 1.0);
+	EXPECT_EQ(translation_y.asDouble(), 0.0);
+
+	undoStack.setIndex(2);
+	EXPECT_EQ(translation_x.asDouble(), 3.0);
+	EXPECT_EQ(translation_y.asDouble(), 2.0);
+}
+
+TEST_F(UndoTest, budget_memory_footprint) {
+	auto footprint = undoStack.memoryFootprint();
+	EXPECT_GT(footprint, 0);
+
+	std::vector<SEditorObject> nodes;
+	for (int index = 0; index < 10; index++) {
+		nodes.emplace_back(create<Node>(fmt::format("node_{}", index)));
+	}
+	auto grownFootprint = undoStack.memoryFootprint();
+	EXPECT_GT(grownFootprint, footprint);
+
+	// Objects of dropped entries still present in later states are taken over by those.
+	undoStack.setMemoryBudget(1, 0);
+	EXPECT_EQ(undoStack.size(), 1);
+	EXPECT_GT(undoStack.memoryFootprint(), 0);
+	EXPECT_LE(undoStack.memoryFootprint(), grownFootprint);
+
+	undoStack.setMemoryBudget(0, 1);
+	commandInterface.set({nodes[0], {"translation", "x"}}, 1.0);
+	EXPECT_EQ(undoStack.size(), 1);
+	EXPECT_EQ(undoStack.getIndex(), 0);
+}
+
+TEST_F(UndoTest, budget_merged_entry_owns_changed_objects) {
+	auto node = create<Node>("node");
+	auto other = create<Node>("other");
+	ValueHandle node_x{node, {"translation", "x"}};
+	ValueHandle other_x{other, {"translation", "x"}};
+
+	context.set(node_x, 1.0);
+	undoStack.push("Set x", "merge");
+	auto footprint = undoStack.memoryFootprint();
+
+	// The merged change of the other node can't modify the object shared with the previous entry.
+	context.set(other_x, 2.0);
+	undoStack.push("Set x", "merge");
+	EXPECT_GT(undoStack.memoryFootprint(), footprint);
+
+	undoStack.undo();
+	EXPECT_EQ(node_x.asDouble(), 0.0);
+	EXPECT_EQ(other_x.asDouble(), 0.0);
+
+	undoStack.redo();
+	EXPECT_EQ(node_x.asDouble(), 1.0);
+	EXPECT_EQ(other_x.asDouble(), 2.0);
+}
+
+class TestDeltaUndoStack : public UndoStack {
+public:
+	using UndoStack::UndoStack;
+	using Entry = UndoStack::Entry;
+
+	std::vector<std::unique_ptr<Entry>>& stack() {
+		return stack_;
+	}
+};
+
+class UndoDeltaTest : public UndoTestT<> {
+public:
+	UndoDeltaTest() : deltaStack(&context, []() {}, UndoStack::StorageMode::Delta), deltaCommandInterface(&context, &deltaStack) {
+	}
+
+	void checkJumpDelta(std::function<void()> operation, std::function<void()> preCheck, std::function<void()> postCheck) {
+		size_t preIndex = deltaStack.getIndex();
+		preCheck();
+		operation();
+		size_t postIndex = deltaStack.getIndex();
+		postCheck();
+		deltaStack.setIndex(preIndex);
+		preCheck();
+		deltaStack.setIndex(postIndex);
+		postCheck();
+	}
+
+	TestDeltaUndoStack deltaStack;
+	CommandInterface deltaCommandInterface;
+};
+
+TEST_F(UndoDeltaTest, set_value_stores_property_delta) {
+	auto node = create<Node>(deltaCommandInterface, "node");
+	ValueHandle translation_x{node, {"translation", "x"}};
+
+	checkJumpDelta([this, translation_x]() {
+		deltaCommandInterface.set(translation_x, 2.0);
+		deltaCommandInterface.set(translation_x, 3.0);
+	},
+		[translation_x]() {
+			EXPECT_EQ(translation_x.asDouble(), 0.0);
+		},
+		[translation_x]() {
+			EXPECT_EQ(translation_x.asDouble(), 3.0);
+		});
+
+	const auto& delta = deltaStack.stack().back()->delta;
+	EXPECT_TRUE(delta.createdObjects.empty());
+	EXPECT_TRUE(delta.deletedObjects.empty());
+	ASSERT_EQ(delta.changedValues.size(), 1);
+	EXPECT_EQ(delta.changedValues[0].objectID, node->objectID());
+	EXPECT_EQ(delta.changedValues[0].propertyPath, std::vector<std::string>({"translation", "x"}));
+	EXPECT_EQ(delta.changedValues[0].oldValue->asDouble(), 0.0);
+	EXPECT_EQ(delta.changedValues[0].newValue->asDouble(), 3.0);
+}
+
+TEST_F(UndoDeltaTest, delete_restores_objects_references_and_order) {
+	auto parent = create<Node>(deltaCommandInterface, "parent");
+	auto child = create<Node>(deltaCommandInterface, "child", parent);
+	auto other = create<Node>(deltaCommandInterface, "other");
+
+	checkJumpDelta([this, parent]() { deltaCommandInterface.deleteObjects({parent}); },
+		[this]() {
+			checkInstances({"ProjectSettings", "parent", "child", "other"}, {});
+			auto parent = getInstance<Node>(project, "parent");
+			auto child = getInstance<Node>(project, "child");
+			EXPECT_EQ(parent->children_->asVector<SEditorObject>(), std::vector<SEditorObject>({child}));
+			EXPECT_EQ(child->getParent(), parent);
+			EXPECT_EQ(project.instances()[1], parent);
+			EXPECT_EQ(project.instances()[2], child);
+		},
+		[this]() {
+			checkInstances({"ProjectSettings", "other"}, {"parent", "child"});
+		});
+}
+
+TEST_F(UndoDeltaTest, top_level_move_multi_step) {
+	auto settings = project.settings();
+	auto node1 = create<Node>(deltaCommandInterface, "node1");
+	auto node2 = create<Node>(deltaCommandInterface, "node2");
+	auto node3 = create<Node>(deltaCommandInterface, "node3");
+
+	auto index = deltaStack.getIndex();
+	deltaCommandInterface.moveScenegraphChildren({node2}, {}, 0);
+	deltaCommandInterface.moveScenegraphChildren({node3, node1}, {}, 1);
+	ASSERT_EQ(project.instances(), std::vector<SEditorObject>({node2, node3, node1, settings}));
+
+	deltaStack.setIndex(index);
+	ASSERT_EQ(project.instances(), std::vector<SEditorObject>({settings, node1, node2, node3}));
+
+	deltaStack.redo();
+	ASSERT_EQ(project.instances(), std::vector<SEditorObject>({node2, settings, node1, node3}));
+
+	deltaStack.redo();
+	ASSERT_EQ(project.instances(), std::vector<SEditorObject>({node2, node3, node1, settings}));
+}
+
+TEST_F(UndoDeltaTest, link_add_remove_strong_to_weak) {
+	auto start = create_lua(deltaCommandInterface, "start", "scripts/types-scalar.lua");
+	auto end = create_lua(deltaCommandInterface, "end", "scripts/types-scalar.lua");
+
+	checkJumpDelta([this, start, end]() {
+		deltaCommandInterface.addLink(ValueHandle{start, {"outputs", "ofloat"}}, ValueHandle{end, {"inputs", "float"}});
+		deltaCommandInterface.removeLink({end, {"inputs", "float"}});
+		deltaCommandInterface.addLink(ValueHandle{start, {"outputs", "ofloat"}}, ValueHandle{end, {"inputs", "float"}}, true);
+	},
+		[this]() {
+			checkLinks({});
+		},
+		[this, start, end]() {
+			std::vector<Link> refLinks{{{{start, {"outputs", "ofloat"}}, {end, {"inputs", "float"}}, true, true}}};
+			checkLinks(refLinks);
+		});
+
+	deltaStack.undo();
+	std::vector<Link> refLinks{{{{start, {"outputs", "ofloat"}}, {end, {"inputs", "float"}}, true, false}}};
+	checkLinks(refLinks);
+}
+
+TEST_F(UndoDeltaTest, composite_abort) {
+	auto node = create<Node>(deltaCommandInterface, "node");
+	ValueHandle translation_x{node, {"translation", "x"}};
+
+	auto index = deltaStack.getIndex();
+	auto size = deltaStack.size();
+
+	EXPECT_THROW(
+		deltaCommandInterface.executeCompositeCommand(
+			[this, translation_x]() {
+				deltaCommandInterface.set(translation_x, 3.0);
+				deltaCommandInterface.set(translation_x, true);
+			},
+			"Composite command"),
+		std::runtime_error);
+
+	EXPECT_EQ(index, deltaStack.getIndex());
+	EXPECT_EQ(size, deltaStack.size());
+	EXPECT_EQ(translation_x.asDouble(), 0.0);
+
+	deltaStack.undo();
+	checkInstances({"ProjectSettings"}, {"node"});
+}
+
+TEST_F(UndoDeltaTest, budget_max_entries_drops_oldest) {
+	auto node = create<Node>(deltaCommandInterface, "node");
+	ValueHandle translation_x{node, {"translation", "x"}};
+	ValueHandle translation_y{node, {"translation", "y"}};
+
+	deltaStack.setMemoryBudget(3, 0);
+
+	deltaCommandInterface.set(translation_x, 1.0);
+	deltaCommandInterface.set(translation_y, 2.0);
+	deltaCommandInterface.set(translation_x, 3.0);
+	EXPECT_EQ(deltaStack.size(), 3);
+	EXPECT_EQ(deltaStack.getIndex(), 2);
+	EXPECT_TRUE(deltaStack.stack().front()->delta.changedValues.empty());
+
+	deltaStack.setIndex(0);
+	EXPECT_EQ(translation_x.asDouble(), 1.0);
+	EXPECT_EQ(translation_y.asDouble(), 0.0);
+
+	deltaStack.setIndex(2);
+	EXPECT_EQ(translation_x.asDouble(), 3.0);
+	EXPECT_EQ(translation_y.asDouble(), 2.0);
+	EXPECT_GT(deltaStack.memoryFootprint(), 0);
+}
+
+#ifdef NDEBUG
+TEST_F(UndoDeltaTest, benchmark_snapshot_vs_delta_500_steps) {
+	const int numNodes = 2000;
+	const int numSteps = 500;
+
+	std::vector<SNode> nodes;
+	for (int index = 0; index < numNodes; index++) {
+		nodes.emplace_back(std::dynamic_pointer_cast<Node>(context.createObject(Node::typeDescription.typeName, fmt::format("node_{}", index))));
+	}
+
+	auto runSteps = [&nodes, numSteps](UndoStack& stack, CommandInterface& cmd) {
+		stack.reset();
+		auto startTime = std::chrono::steady_clock::now();
+		for (int step = 0; step < numSteps; step++) {
+			cmd.set({nodes[step % nodes.size()], {"translation", "x"}}, static_cast<double>(step + 1));
+		}
+		auto pushTime = std::chrono::steady_clock::now();
+		stack.setIndex(0);
+		auto undoTime = std::chrono::steady_clock::now();
+		stack.setIndex(numSteps);
+		auto redoTime = std::chrono::steady_clock::now();
+		return std::array<long long, 3>{
+			std::chrono::duration_cast<std::chrono::milliseconds>(pushTime - startTime).count(),
+			std::chrono::duration_cast<std::chrono::milliseconds>(undoTime - pushTime).count(),
+			std::chrono::duration_cast<std::chrono::milliseconds>(redoTime - undoTime).count()};
+	};
+
+	auto snapshotTimes = runSteps(undoStack, commandInterface);
+	EXPECT_EQ(undoStack.size(), numSteps + 1);
+	size_t snapshotObjects = 0;
+	for (const auto& entry : undoStack.stack()) {
+		snapshotObjects += entry->state.instances().size();
+	}
+
+	auto deltaTimes = runSteps(deltaStack, deltaCommandInterface);
+	EXPECT_EQ(deltaStack.size(), numSteps + 1);
+	size_t deltaValues = 0;
+	for (const auto& entry : deltaStack.stack()) {
+		deltaValues += entry->delta.changedValues.size();
+	}
+	EXPECT_EQ(deltaValues, numSteps);
+	for (int index = 0; index < numSteps; index++) {
+		EXPECT_EQ(*nodes[index]->translation_->x, static_cast<double>(index + 1));
+	}
+
+	// Delta entries store the changed values only instead of references to all objects.
+	EXPECT_LT(deltaValues, snapshotObjects);
+	EXPECT_LE(deltaTimes[0], std::max<long long>(snapshotTimes[0], 100));
+	EXPECT_LE(deltaTimes[1], std::max<long long>(snapshotTimes[1], 100));
+	EXPECT_LE(deltaTimes[2], std::max<long long>(snapshotTimes[2], 100));
+}
+#endif
@@ -19,6 +19,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <map>
 #include <set>
 
@@ -122,3 +123,38 @@ TEST(ValueHandle, ValueHandle_PropertyPtr) {
 	const ValueHandle valueHandle6{editorObject, &PerspectiveCamera::frustum_};
 	EXPECT_FALSE(valueHandle6);
 }
+
+#ifdef NDEBUG
+TEST(ValueHandle, benchmark_handle_resolution_on_wide_tables) {
+	constexpr int repetitions = 10;
+
+	auto nanosecondsPerHandle = [](int width) {
+		const std::shared_ptr<MockTableObject> tableObject{std::make_shared<MockTableObject>("SomeName")};
+		std::vector<std::string> names;
+		for (int index = 0; index < width; index++) {
+			names.emplace_back("property_" + std::to_string(index));
+			tableObject->table_.asTable().addProperty(names.back(), PrimitiveType::Double);
+		}
+
+		size_t valid = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int repetition = 0; repetition < repetitions; repetition++) {
+			for (const auto& name : names) {
+				if (ValueHandle(tableObject, {"table", name})) {
+					valid++;
+				}
+			}
+		}
+		auto elapsed = std::chrono::steady_clock::now() - start;
+		EXPECT_EQ(valid, repetitions * names.size());
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / (repetitions * width);
+	};
+
+	auto narrowTableNs = nanosecondsPerHandle(100);
+	auto wideTableNs = nanosecondsPerHandle(10000);
+
+	// Properties are looked up through the name index: the time per handle must not grow with the table width.
+	// The constant allows for timer resolution and cache effects.
+	EXPECT_LE(wideTableNs, 4 * narrowTableNs + 100);
+}
+#endif
@@ -53,18 +53,9 @@ public:
 	virtual void removeProperty(size_t index) = 0;
 
 protected:
-	void growPropertyNames(size_t requestedSize) const {
-		if (requestedSize > propNames_.size()) {
-			auto oldSize = propNames_.size();
-			size_t newSize = std::max(2 * oldSize, requestedSize);
-			propNames_.resize(newSize);
-			for (size_t index = oldSize; index < propNames_.size(); index++) {
-				propNames_[index] = std::to_string(index + 1);
-			}
-		}
-	}
-
-	static std::vector<std::string> propNames_;
+	// Shared name strings "1", "2", ... for the array elements.
+	// The returned references stay valid; the function may be called concurrently from multiple threads.
+	static const std::string& propertyName(size_t index);
 };
 
 // Concrete Array type with statically known element type
@@ -147,8 +138,7 @@ public:
 		if (index >= elements_.size()) {
 			throw std::out_of_range("Array<T>::name: index out of range");
 		}
-		growPropertyNames(index + 1);
-		return propNames_[index];
+		return propertyName(index);
 	}
 
 	///
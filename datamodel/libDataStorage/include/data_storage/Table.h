@@ -16,12 +16,19 @@
 #include <set>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 namespace raco::data_storage {
 
 // Dictionary with annotations
+//
+// Lookup by name uses a hash index for tables with at least NAME_INDEX_MIN_SIZE properties and
+// a linear search otherwise. The index maps the hash of each non-empty property name to the property index
+// and is updated by all functions changing the property list.
 class Table : public ReflectionInterface {
 public:
+	static constexpr size_t NAME_INDEX_MIN_SIZE = 16;
+
 	static inline const TypeDescriptor typeDescription = { "Table", false };
 	TypeDescriptor const& getTypeDescription() const override {
 		return typeDescription;
@@ -101,7 +108,23 @@ public:
 	bool compare(std::vector<T> const& array) const;
 
 private:
+	static size_t hashName(std::string_view name);
+
+	int findIndex(std::string_view propertyName) const;
+
+	// Update the name index after inserting the property at the given index.
+	void indexInsertedProperty(size_t index);
+	// Update the name index before removing the property at the given index.
+	void indexRemovedProperty(size_t index);
+	void indexRenamedProperty(size_t index, std::string_view oldName);
+	void rebuildNameIndex();
+	void clearNameIndex();
+
 	std::vector<std::pair<std::string, std::unique_ptr<ValueBase>>> properties_;
+
+	// Only used if nameIndexed_ is set. Multiple properties with the same name or hash are allowed.
+	std::unordered_multimap<size_t, size_t> nameIndex_;
+	bool nameIndexed_ = false;
 };
 
 }
\ No newline at end of file
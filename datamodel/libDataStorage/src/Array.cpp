@@ -9,8 +9,32 @@
  */
 #include "data_storage/Array.h"
 
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
 namespace raco::data_storage {
 
-std::vector<std::string> ArrayBase::propNames_;
+namespace {
+
+// std::deque doesn't invalidate references to its elements when growing at the end.
+std::deque<std::string> propNames;
+std::shared_mutex propNamesMutex;
 
+}  // namespace
+
+const std::string& ArrayBase::propertyName(size_t index) {
+	{
+		std::shared_lock lock(propNamesMutex);
+		if (index < propNames.size()) {
+			return propNames[index];
+		}
+	}
+	std::unique_lock lock(propNamesMutex);
+	while (propNames.size() <= index) {
+		propNames.emplace_back(std::to_string(propNames.size() + 1));
+	}
+	return propNames[index];
 }
+
+}  // namespace raco::data_storage
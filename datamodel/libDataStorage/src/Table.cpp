@@ -11,6 +11,7 @@
 #include "data_storage/Value.h"
 
 #include <algorithm>
+#include <functional>
 #include <tuple>
 
 namespace raco::data_storage {
@@ -22,12 +23,9 @@ Table::Table(const Table& other, std::function<SEditorObject(SEditorObject)>* tr
 }
 
 ValueBase* Table::get(std::string_view propertyName) {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&propertyName](auto const& item) {
-			return item.first == propertyName;
-		});
-	if (it != properties_.end()) {
-		return it->second.get();
+	int ind = findIndex(propertyName);
+	if (ind != -1) {
+		return properties_[ind].second.get();
 	}
 	throw std::out_of_range("Table::get: property doesn't exist.");
 }
@@ -40,12 +38,9 @@ ValueBase* Table::get(size_t index) {
 }
 
 const ValueBase* Table::get(std::string_view propertyName) const {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&propertyName](auto const& item) {
-			return item.first == propertyName;
-		});
-	if (it != properties_.end()) {
-		return it->second.get();
+	int ind = findIndex(propertyName);
+	if (ind != -1) {
+		return properties_[ind].second.get();
 	}
 	throw std::out_of_range("Table::get: property doesn't exist.");
 }
@@ -70,6 +65,38 @@ const std::string& Table::name(size_t index) const {
 }
 
 int Table::index(std::string_view propertyName) const {
+	return findIndex(propertyName);
+}
+
+size_t Table::hashName(std::string_view name) {
+	return std::hash<std::string_view>{}(name);
+}
+
+namespace {
+
+std::unordered_multimap<size_t, size_t>::iterator findIndexEntry(std::unordered_multimap<size_t, size_t>& nameIndex, size_t hash, size_t index) {
+	auto [begin, end] = nameIndex.equal_range(hash);
+	auto it = std::find_if(begin, end, [index](const auto& entry) {
+		return entry.second == index;
+	});
+	return it != end ? it : nameIndex.end();
+}
+
+}  // namespace
+
+int Table::findIndex(std::string_view propertyName) const {
+	if (nameIndexed_ && !propertyName.empty()) {
+		// Return the first property with the name to match the linear search.
+		int result = -1;
+		auto [begin, end] = nameIndex_.equal_range(hashName(propertyName));
+		for (auto it = begin; it != end; ++it) {
+			if (properties_[it->second].first == propertyName && (result == -1 || it->second < static_cast<size_t>(result))) {
+				result = static_cast<int>(it->second);
+			}
+		}
+		return result;
+	}
+
 	auto it = std::find_if(properties_.begin(), properties_.end(),
 		[&propertyName](auto const& item) {
 			return item.first == propertyName;
@@ -80,24 +107,84 @@ int Table::index(std::string_view propertyName) const {
 	return -1;
 }
 
+void Table::indexInsertedProperty(size_t index) {
+	if (!nameIndexed_) {
+		if (properties_.size() >= NAME_INDEX_MIN_SIZE) {
+			rebuildNameIndex();
+		}
+		return;
+	}
+	if (index + 1 < properties_.size()) {
+		for (auto& entry : nameIndex_) {
+			if (entry.second >= index) {
+				++entry.second;
+			}
+		}
+	}
+	if (!properties_[index].first.empty()) {
+		nameIndex_.emplace(hashName(properties_[index].first), index);
+	}
+}
+
+void Table::indexRemovedProperty(size_t index) {
+	if (!nameIndexed_) {
+		return;
+	}
+	if (!properties_[index].first.empty()) {
+		auto it = findIndexEntry(nameIndex_, hashName(properties_[index].first), index);
+		if (it != nameIndex_.end()) {
+			nameIndex_.erase(it);
+		}
+	}
+	if (index + 1 < properties_.size()) {
+		for (auto& entry : nameIndex_) {
+			if (entry.second > index) {
+				--entry.second;
+			}
+		}
+	}
+}
+
+void Table::indexRenamedProperty(size_t index, std::string_view oldName) {
+	if (!nameIndexed_) {
+		return;
+	}
+	if (!oldName.empty()) {
+		auto it = findIndexEntry(nameIndex_, hashName(oldName), index);
+		if (it != nameIndex_.end()) {
+			nameIndex_.erase(it);
+		}
+	}
+	if (!properties_[index].first.empty()) {
+		nameIndex_.emplace(hashName(properties_[index].first), index);
+	}
+}
+
+void Table::rebuildNameIndex() {
+	nameIndex_.clear();
+	nameIndex_.reserve(properties_.size());
+	for (size_t index = 0; index < properties_.size(); index++) {
+		if (!properties_[index].first.empty()) {
+			nameIndex_.emplace(hashName(properties_[index].first), index);
+		}
+	}
+	nameIndexed_ = true;
+}
+
+void Table::clearNameIndex() {
+	nameIndex_.clear();
+	nameIndexed_ = false;
+}
 
 ValueBase *Table::addProperty(std::string_view name, PrimitiveType type)
 {
 	properties_.emplace_back(std::make_pair(name, ValueBase::create(type)));
+	indexInsertedProperty(properties_.size() - 1);
 	return properties_.back().second.get();
 }
 
 ValueBase* Table::addProperty(std::string_view name, ValueBase* property, int index_before) {
-	if (index_before < -1 || index_before > static_cast<int>(properties_.size())) {
-		throw std::out_of_range("Table::addProperty: index out of range");
-	}
-
-	if (index_before == -1) {
-		properties_.emplace_back(std::make_pair(name, std::unique_ptr<ValueBase>(property)));
-		return properties_.back().second.get();
-	}
-
-	return properties_.insert(properties_.begin() + index_before, std::make_pair(std::string(name), std::unique_ptr<ValueBase>(property)))->second.get();
+	return addProperty(name, std::unique_ptr<ValueBase>(property), index_before);
 }
 
 ValueBase* Table::addProperty(std::string_view name, std::unique_ptr<ValueBase>&& property, int index_before) {
@@ -105,26 +192,15 @@ ValueBase* Table::addProperty(std::string_view name, std::unique_ptr<ValueBase>&
 		throw std::out_of_range("Table::addProperty: index out of range");
 	}
 
-	if (index_before == -1) {
-		properties_.emplace_back(std::make_pair(name, std::move(property)));
-		return properties_.back().second.get();
-	}
-
-	return properties_.insert(properties_.begin() + index_before, std::make_pair(std::string(name), std::move(property)))->second.get();
+	size_t index = index_before == -1 ? properties_.size() : static_cast<size_t>(index_before);
+	properties_.insert(properties_.begin() + index, std::make_pair(std::string(name), std::move(property)));
+	indexInsertedProperty(index);
+	return properties_[index].second.get();
 }
 
 
 ValueBase* Table::addProperty(PrimitiveType type, int index_before) {
-	if (index_before < -1 || index_before > static_cast<int>(properties_.size())) {
-		throw std::out_of_range("Table::addProperty: index out of range");
-	}
-
-	if (index_before == -1) {
-		properties_.emplace_back(std::make_pair(std::string(), ValueBase::create(type)));
-		return properties_.back().second.get();
-	}
-
-	return properties_.insert(properties_.begin() + index_before, std::make_pair(std::string(), ValueBase::create(type)))->second.get();
+	return addProperty(ValueBase::create(type), index_before);
 }
 
 ValueBase* Table::addProperty(ValueBase* property, int index_before) {
@@ -132,22 +208,14 @@ ValueBase* Table::addProperty(ValueBase* property, int index_before) {
 }
 
 ValueBase* Table::addProperty(std::unique_ptr<ValueBase>&& property, int index_before) {
-	if (index_before < -1 || index_before > static_cast<int>(properties_.size())) {
-		throw std::out_of_range("Table::addProperty: index out of range");
-	}
-
-	if (index_before == -1) {
-		properties_.emplace_back(std::make_pair(std::string(), std::move(property)));
-		return properties_.back().second.get();
-	}
-
-	return properties_.insert(properties_.begin() + index_before, std::make_pair(std::string(), std::move(property)))->second.get();
+	return addProperty(std::string_view(), std::move(property), index_before);
 }
 
 void Table::removeProperty(size_t index) {
 	if (index >= properties_.size()) {
 		throw std::out_of_range("Table::name: index out of range");
 	}
+	indexRemovedProperty(index);
 	properties_.erase(properties_.begin() + index);
 }
 
@@ -159,12 +227,11 @@ void Table::removeProperty(std::string_view propertyName) {
 }
 
 void Table::renameProperty(std::string_view oldName, std::string_view newName) {
-	auto it = std::find_if(properties_.begin(), properties_.end(),
-		[&oldName](auto const& item) {
-			return item.first == oldName;
-		});
-	if (it != properties_.end()) {
-		it->first = newName;
+	int ind = index(oldName);
+	if (ind != -1) {
+		std::string previousName = std::move(properties_[ind].first);
+		properties_[ind].first = newName;
+		indexRenamedProperty(ind, previousName);
 	}
 }
 
@@ -183,12 +250,23 @@ void Table::replaceProperty(std::string_view name, ValueBase* property) {
 
 void Table::swapProperties(size_t index_1, size_t index_2) {
 	if (index_1 < properties_.size() && index_2 < properties_.size() && index_1 != index_2) {
+		if (nameIndexed_) {
+			auto it_1 = properties_[index_1].first.empty() ? nameIndex_.end() : findIndexEntry(nameIndex_, hashName(properties_[index_1].first), index_1);
+			auto it_2 = properties_[index_2].first.empty() ? nameIndex_.end() : findIndexEntry(nameIndex_, hashName(properties_[index_2].first), index_2);
+			if (it_1 != nameIndex_.end()) {
+				it_1->second = index_2;
+			}
+			if (it_2 != nameIndex_.end()) {
+				it_2->second = index_1;
+			}
+		}
 		std::swap(properties_[index_1], properties_[index_2]);
 	}
 }
 
 void Table::clear() {
 	properties_.clear();
+	clearNameIndex();
 }
 
 template<typename T>
@@ -198,7 +276,7 @@ template<> struct TypeMap<std::string> { static const PrimitiveType primType = P
 
 template<typename T>
 void Table::set(std::vector<T> const& array) {
-	properties_.clear();
+	clear();
 
 	for (auto item : array) {
 		ValueBase* prop = addProperty(TypeMap<T>::primType);
@@ -249,7 +327,7 @@ template bool Table::compare<std::string>(std::vector<std::string> const& array)
 
 
 Table& Table::operator=(const Table& value) {
-	properties_.clear();
+	clear();
 	for (auto const &item : value.properties_) {
 		addProperty(item.first, item.second->clone(nullptr));
 	}
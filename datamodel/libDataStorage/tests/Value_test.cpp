@@ -15,6 +15,8 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+
 using namespace raco::data_storage;
 
 TEST(ValueTest, Scalar) {
@@ -76,6 +78,61 @@ TEST(ValueTest, Tables) {
 	EXPECT_EQ(tv->get("fval")->asDouble(), 2.0);
 }
 
+TEST(ValueTest, Table_wide_name_lookup) {
+	Value<Table> tv;
+	auto checkLookup = [&tv]() {
+		auto names = tv->propertyNames();
+		for (size_t index = 0; index < names.size(); index++) {
+			auto first = std::find(names.begin(), names.end(), names[index]) - names.begin();
+			EXPECT_EQ(tv->index(names[index]), first);
+		}
+		EXPECT_EQ(tv->index("missing"), -1);
+	};
+
+	for (int index = 0; index < static_cast<int>(2 * Table::NAME_INDEX_MIN_SIZE); index++) {
+		tv->addProperty("prop_" + std::to_string(index), PrimitiveType::Int)->asInt() = index;
+	}
+	checkLookup();
+	EXPECT_EQ(tv->get("prop_20")->asInt(), 20);
+
+	tv->addProperty("inserted", ValueBase::create(PrimitiveType::Int), 3);
+	tv->addProperty(PrimitiveType::Int, 5);
+	checkLookup();
+	EXPECT_EQ(tv->index("inserted"), 3);
+	EXPECT_EQ(tv->index("prop_3"), 4);
+
+	tv->removeProperty("prop_1");
+	tv->removeProperty(static_cast<size_t>(0));
+	checkLookup();
+	EXPECT_EQ(tv->index("inserted"), 1);
+
+	tv->swapProperties(1, 10);
+	checkLookup();
+	EXPECT_EQ(tv->index("inserted"), 10);
+
+	tv->renameProperty("inserted", "renamed");
+	checkLookup();
+	EXPECT_EQ(tv->index("inserted"), -1);
+	EXPECT_EQ(tv->index("renamed"), 10);
+
+	// Duplicate names resolve to the first property.
+	tv->addProperty("prop_20", ValueBase::create(PrimitiveType::Int), 0);
+	checkLookup();
+	EXPECT_EQ(tv->index("prop_20"), 0);
+	tv->removeProperty(static_cast<size_t>(0));
+	checkLookup();
+
+	Value<Table> copy;
+	copy = tv;
+	EXPECT_EQ(copy->index("renamed"), 10);
+	EXPECT_EQ(copy->get("prop_20")->asInt(), 20);
+
+	tv->clear();
+	EXPECT_EQ(tv->index("renamed"), -1);
+	tv->addProperty("prop_0", PrimitiveType::Int);
+	checkLookup();
+}
+
 TEST(ValueTest, Table_nested_struct) {
 	Value<Table> tv;
 
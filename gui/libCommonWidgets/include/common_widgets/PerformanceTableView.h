@@ -10,6 +10,7 @@
 #pragma once
 #include "application/RaCoApplication.h"
 
+#include <QLabel>
 #include <QWidget>
 
 namespace raco::common_widgets {
@@ -25,8 +26,11 @@ Q_SIGNALS:
 private:
 	static inline const auto ROW_HEIGHT = 22;
 
+	void updateCacheStatistics();
+
 	application::RaCoApplication* application_;
 	components::SDataChangeDispatcher dispatcher_;
+	QLabel* cacheLabel_ = nullptr;
 };
 
 }  // namespace raco::common_widgets
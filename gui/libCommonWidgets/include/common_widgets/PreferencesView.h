@@ -41,9 +41,14 @@ private:
 	QCheckBox* uriValidationCaseSensitiveCheckbox_;
 	QCheckBox* preventAccidentalUpgradeEdit_;
 	QCheckBox* preventAccidentalUpgradeCheckbox_;
+	QCheckBox* writeProjectObjectIndexCheckbox_;
 	QLineEdit* screenshotDirectoryEdit_;
 	QLineEdit* globalPythonScriptEdit_;
 	QCheckBox* projectPythonScriptCheckbox_;
+	QSpinBox* undoStackMaxEntriesEdit_;
+	QSpinBox* undoStackMemoryLimitEdit_;
+	QCheckBox* undoStackDeltaStorageCheckbox_;
+	QSpinBox* idleFrameIntervalEdit_;
 
 	QString convertPathToAbsolute(const QString& path) const;
 };
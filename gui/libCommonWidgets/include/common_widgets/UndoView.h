@@ -12,6 +12,7 @@
 #include "components/DataChangeDispatcher.h"
 #include "core/Undo.h"
 #include <QGridLayout>
+#include <QLabel>
 #include <QListView>
 #include <QStandardItemModel>
 #include <QWidget>
@@ -30,6 +31,7 @@ private:
 	core::UndoStack* undoStack_;
 	QListView* list_;
 	QStandardItemModel* model_;
+	QLabel* memoryFootprintLabel_;
 };
 
 }  // namespace raco::common_widgets
@@ -17,6 +17,7 @@
 
 #include <QHBoxLayout>
 #include <QHeaderView>
+#include <QLabel>
 #include <QPushButton>
 #include <QSortFilterProxyModel>
 #include <QTableView>
@@ -81,8 +82,26 @@ PerformanceTableView::PerformanceTableView(application::RaCoApplication* applica
 
 	toolbarLayout->addStretch();
 
+	cacheLabel_ = new QLabel(this);
+	toolbarLayout->addWidget(cacheLabel_);
+	updateCacheStatistics();
+	connect(application_, &application::RaCoApplication::performanceStatisticsUpdated, this, &PerformanceTableView::updateCacheStatistics);
+
 	mainLayout->addWidget(toolbarWidget);
 	mainLayout->addWidget(tableView);
 }
 
+void PerformanceTableView::updateCacheStatistics() {
+	const auto& shaderStats = application_->getShaderCacheStats();
+	const auto& luaStats = application_->getLuaScriptCacheStats();
+	cacheLabel_->setText(QString("Shader cache: %1 hits / %2 misses (%3%)   Lua cache: %4 hits / %5 misses (%6%)")
+							 .arg(shaderStats.hits)
+							 .arg(shaderStats.misses)
+							 .arg(100.0 * shaderStats.hitRate(), 0, 'f', 1)
+							 .arg(luaStats.hits)
+							 .arg(luaStats.misses)
+							 .arg(100.0 * luaStats.hitRate(), 0, 'f', 1));
+	cacheLabel_->setToolTip(QString("Hit rates of the shader reflection and Lua script interface caches since the last reset, %1 shader programs and %2 scripts cached").arg(shaderStats.entryCount).arg(luaStats.entryCount));
+}
+
 }  // namespace raco::common_widgets
\ No newline at end of file
@@ -87,6 +87,15 @@ PreferencesView::PreferencesView(application::RaCoApplication* racoApp, QWidget*
 		Q_EMIT dirtyChanged(dirty());
 	});
 
+	writeProjectObjectIndexCheckbox_ = new QCheckBox(this);
+	writeProjectObjectIndexCheckbox_->setCheckState(RaCoPreferences::instance().writeProjectObjectIndex ? Qt::CheckState::Checked : Qt::CheckState::Unchecked);
+	writeProjectObjectIndexCheckbox_->setToolTip("Write an object index file (.rca.idx) next to the project on save to speed up loading the project as an external reference");
+	formLayout->addRow("Write project object index", writeProjectObjectIndexCheckbox_);
+
+	QObject::connect(writeProjectObjectIndexCheckbox_, &QCheckBox::stateChanged, this, [this]() {
+		Q_EMIT dirtyChanged(dirty());
+	});
+
 	// Screenshot
 	{
 		auto* selectScreenshotDirectoryButton = new PropertyBrowserButton("  ...  ", this);
@@ -152,6 +161,53 @@ PreferencesView::PreferencesView(application::RaCoApplication* racoApp, QWidget*
 		Q_EMIT dirtyChanged(dirty());
 	});
 
+	// Undo stack limits
+	undoStackMaxEntriesEdit_ = new QSpinBox(this);
+	undoStackMaxEntriesEdit_->setRange(0, 100000);
+	undoStackMaxEntriesEdit_->setSpecialValueText("Unlimited");
+	undoStackMaxEntriesEdit_->setValue(RaCoPreferences::instance().undoStackMaxEntries);
+	undoStackMaxEntriesEdit_->setToolTip("Maximum number of undo steps. The oldest steps are discarded when the limit is exceeded.");
+	formLayout->addRow("Undo Stack Entry Limit", undoStackMaxEntriesEdit_);
+
+	QObject::connect(undoStackMaxEntriesEdit_, QOverload<int>::of(&QSpinBox::valueChanged), this, [this]() {
+		Q_EMIT dirtyChanged(dirty());
+	});
+
+	undoStackMemoryLimitEdit_ = new QSpinBox(this);
+	undoStackMemoryLimitEdit_->setRange(0, 1024 * 1024);
+	undoStackMemoryLimitEdit_->setSpecialValueText("Unlimited");
+	undoStackMemoryLimitEdit_->setSuffix(" MB");
+	undoStackMemoryLimitEdit_->setValue(RaCoPreferences::instance().undoStackMemoryLimitMB);
+	undoStackMemoryLimitEdit_->setToolTip("Maximum estimated memory used by the undo stack. The oldest steps are discarded when the limit is exceeded.");
+	formLayout->addRow("Undo Stack Memory Limit", undoStackMemoryLimitEdit_);
+
+	QObject::connect(undoStackMemoryLimitEdit_, QOverload<int>::of(&QSpinBox::valueChanged), this, [this]() {
+		Q_EMIT dirtyChanged(dirty());
+	});
+
+	undoStackDeltaStorageCheckbox_ = new QCheckBox(this);
+	undoStackDeltaStorageCheckbox_->setCheckState(RaCoPreferences::instance().undoStackDeltaStorage ? Qt::CheckState::Checked : Qt::CheckState::Unchecked);
+	undoStackDeltaStorageCheckbox_->setToolTip("Store only the property changes of each undo step instead of project snapshots. This keeps one additional copy of the project in memory. Applies to projects opened afterwards.");
+	formLayout->addRow("Undo Stack Delta Storage", undoStackDeltaStorageCheckbox_);
+
+	QObject::connect(undoStackDeltaStorageCheckbox_, &QCheckBox::stateChanged, this, [this]() {
+		Q_EMIT dirtyChanged(dirty());
+	});
+
+	// Preview frame rate while idle
+	idleFrameIntervalEdit_ = new QSpinBox(this);
+	idleFrameIntervalEdit_->setRange(0, 60000);
+	idleFrameIntervalEdit_->setSingleStep(100);
+	idleFrameIntervalEdit_->setSpecialValueText("Continuous");
+	idleFrameIntervalEdit_->setSuffix(" ms");
+	idleFrameIntervalEdit_->setValue(RaCoPreferences::instance().idleFrameIntervalMs);
+	idleFrameIntervalEdit_->setToolTip("Interval in which the preview is rendered while the project doesn't change, no timer or trace is running and there is no user interaction.");
+	formLayout->addRow("Idle Preview Update Interval", idleFrameIntervalEdit_);
+
+	QObject::connect(idleFrameIntervalEdit_, QOverload<int>::of(&QSpinBox::valueChanged), this, [this]() {
+		Q_EMIT dirtyChanged(dirty());
+	});
+
 	auto buttonBox = new QDialogButtonBox{this};
 	auto cancelButton{new QPushButton{"Close", buttonBox}};
 	QObject::connect(cancelButton, &QPushButton::clicked, this, &PreferencesView::close);
@@ -190,10 +246,15 @@ void PreferencesView::save() {
 	prefs.featureLevel = featureLevelEdit_->value();
 	prefs.isUriValidationCaseSensitive = uriValidationCaseSensitiveCheckbox_->checkState() == Qt::CheckState::Checked;
 	prefs.preventAccidentalUpgrade = preventAccidentalUpgradeCheckbox_->checkState() == Qt::CheckState::Checked;
+	prefs.writeProjectObjectIndex = writeProjectObjectIndexCheckbox_->checkState() == Qt::CheckState::Checked;
 	prefs.screenshotDirectory = screenshotDirectoryEdit_->text();
 	prefs.screenshotDirectory = screenshotDirectoryEdit_->text();
 	prefs.globalPythonOnSaveScript = convertPathToAbsolute(globalPythonScriptEdit_->text());
 	prefs.enableProjectPythonScript = projectPythonScriptCheckbox_->checkState() == Qt::CheckState::Checked;
+	prefs.undoStackMaxEntries = undoStackMaxEntriesEdit_->value();
+	prefs.undoStackMemoryLimitMB = undoStackMemoryLimitEdit_->value();
+	prefs.undoStackDeltaStorage = undoStackDeltaStorageCheckbox_->checkState() == Qt::CheckState::Checked;
+	prefs.idleFrameIntervalMs = idleFrameIntervalEdit_->value();
 
 	if (!prefs.save()) {
 		LOG_ERROR(log_system::COMMON, "Saving settings failed: {}", core::PathManager::preferenceFilePath().string());
@@ -209,9 +270,14 @@ bool PreferencesView::dirty() {
 		prefs.featureLevel != featureLevelEdit_->value() ||
 		prefs.isUriValidationCaseSensitive != (uriValidationCaseSensitiveCheckbox_->checkState() == Qt::CheckState::Checked) ||
 		prefs.preventAccidentalUpgrade != (preventAccidentalUpgradeCheckbox_->checkState() == Qt::CheckState::Checked) ||
+		prefs.writeProjectObjectIndex != (writeProjectObjectIndexCheckbox_->checkState() == Qt::CheckState::Checked) ||
 		prefs.screenshotDirectory != screenshotDirectoryEdit_->text() ||
 		prefs.globalPythonOnSaveScript != globalPythonScriptEdit_->text() ||
-		prefs.enableProjectPythonScript != (projectPythonScriptCheckbox_->checkState() == Qt::CheckState::Checked);
+		prefs.enableProjectPythonScript != (projectPythonScriptCheckbox_->checkState() == Qt::CheckState::Checked) ||
+		prefs.undoStackMaxEntries != undoStackMaxEntriesEdit_->value() ||
+		prefs.undoStackMemoryLimitMB != undoStackMemoryLimitEdit_->value() ||
+		prefs.undoStackDeltaStorage != (undoStackDeltaStorageCheckbox_->checkState() == Qt::CheckState::Checked) ||
+		prefs.idleFrameIntervalMs != idleFrameIntervalEdit_->value();
 }
 
 QString PreferencesView::convertPathToAbsolute(const QString& path) const {
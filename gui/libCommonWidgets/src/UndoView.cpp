@@ -23,7 +23,10 @@ UndoView::UndoView(core::UndoStack* undoStack, components::SDataChangeDispatcher
 	list_->setModel(model_);
 	list_->setSelectionMode(QAbstractItemView::SelectionMode::SingleSelection);
 	list_->setSelectionBehavior(QAbstractItemView::SelectionBehavior::SelectRows);
-	layout->addWidget(list_);
+	layout->addWidget(list_, 0, 0);
+	memoryFootprintLabel_ = new QLabel{this};
+	memoryFootprintLabel_->setToolTip("Estimated memory used by the undo stack");
+	layout->addWidget(memoryFootprintLabel_, 1, 0);
 	QObject::connect(list_, &QListView::clicked, this, [this](const QModelIndex& index) {
 		if (index.row() != undoStack_->getIndex())
 			undoStack_->setIndex(static_cast<size_t>(index.row()));
@@ -39,6 +42,7 @@ void UndoView::rebuild() {
 		model_->appendRow(item);
 	}
 	list_->setCurrentIndex(model_->index(static_cast<int>(undoStack_->getIndex()), 0));
+	memoryFootprintLabel_->setText(QString("Undo memory: %1 KB").arg(undoStack_->memoryFootprint() / 1024));
 }
 
 }  // namespace raco::common_widgets
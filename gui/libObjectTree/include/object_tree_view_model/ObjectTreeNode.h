@@ -44,6 +44,11 @@ public:
 	size_t childCount() const;
 	void addChild(ObjectTreeNode *child);
 	void addChildFront(ObjectTreeNode *child);
+	void insertChild(size_t row, ObjectTreeNode *child);
+	// Detach the child at the given row. The caller takes ownership of the returned node.
+	ObjectTreeNode *takeChild(size_t row);
+	// Detach all children. The caller takes ownership of the returned nodes; their parent pointer is left unchanged.
+	std::vector<ObjectTreeNode *> takeChildren();
 	ptrdiff_t row() const;
 
 	std::vector<ObjectTreeNode*> getChildren();
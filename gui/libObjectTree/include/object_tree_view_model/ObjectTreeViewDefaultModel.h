@@ -37,6 +37,8 @@ Traversal through the entire tree is guaranteed by the iterateThroughTree() meth
 #include <QAbstractItemModel>
 #include <QFileInfo>
 
+#include <set>
+
 namespace raco::object_tree::model {
 
 class ObjectTreeViewDefaultModel : public QAbstractItemModel {
@@ -79,7 +81,12 @@ public:
 	Qt::DropActions supportedDropActions() const override;
 	bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
 
+	// Above this number of objects created or deleted since the last tree update the tree is rebuilt using
+	// a model reset instead of being updated using row insertions and removals.
+	static constexpr size_t DEFAULT_INCREMENTAL_UPDATE_LIMIT = 1000;
+
 	virtual void buildObjectTree();
+	void setIncrementalUpdateLimit(size_t limit);
 
 	void iterateThroughTree(std::function<void(QModelIndex&)> nodeFunc, QModelIndex& currentIndex);
 	ObjectTreeNode* indexToTreeNode(const QModelIndex& index) const;
@@ -175,6 +182,11 @@ protected:
 
 	// The dirty flag is set if the tree needs to be rebuilt. See afterDispatchSubscription_ member variable usage.
 	bool dirty_ = false;
+	// Number of objects created or deleted since the last tree update.
+	size_t pendingLifecycleChanges_ = 0;
+	size_t incrementalUpdateLimit_ = DEFAULT_INCREMENTAL_UPDATE_LIMIT;
+	// Objects in the tree whose displayed properties changed. These only need a dataChanged notification.
+	std::set<std::string> changedObjectIDs_;
 
 	virtual std::vector<core::SEditorObject> filterForTopLevelObjects(const std::vector<core::SEditorObject>& objects) const;
 	virtual void setNodeExternalProjectInfo(ObjectTreeNode* node) const;
@@ -183,6 +195,11 @@ protected:
 	void resetInvisibleRootNode();
 	void updateTreeIndexes();
 
+	bool hasReparentedNodes(ObjectTreeNode* newNode) const;
+	// Move the children of newNode into oldNode, keeping the existing nodes, and emit the corresponding row signals.
+	void mergeTreeNode(ObjectTreeNode* oldNode, const QModelIndex& oldIndex, ObjectTreeNode* newNode);
+	void notifyChangedObjects();
+
 	QVariant getNodeIcon(ObjectTreeNode* treeNode) const;
 	QVariant getPreviewVisibilityIcon(ObjectTreeNode* treeNode) const;
 	QVariant getAbstractViewVisibilityIcon(ObjectTreeNode* treeNode) const;
@@ -81,9 +81,29 @@ void ObjectTreeNode::addChildFront(ObjectTreeNode* child) {
 	children_.insert(children_.begin(), child);
 }
 
+void ObjectTreeNode::insertChild(size_t row, ObjectTreeNode* child) {
+	assert(row <= children_.size());
+	child->setParent(this);
+	children_.insert(children_.begin() + row, child);
+}
+
+ObjectTreeNode* ObjectTreeNode::takeChild(size_t row) {
+	assert(row < children_.size());
+	auto child = children_[row];
+	children_.erase(children_.begin() + row);
+	child->setParent(nullptr);
+	return child;
+}
+
+std::vector<ObjectTreeNode*> ObjectTreeNode::takeChildren() {
+	std::vector<ObjectTreeNode*> children;
+	children.swap(children_);
+	return children;
+}
+
 ptrdiff_t ObjectTreeNode::row() const {
 	if (parent_) {
-		auto nodeNeighbors = parent_->getChildren();
+		const auto& nodeNeighbors = parent_->children_;
 		auto myPosition = std::find_if(nodeNeighbors.begin(), nodeNeighbors.end(), [&](const auto* neighborNode) {
 			return neighborNode == this;
 		});
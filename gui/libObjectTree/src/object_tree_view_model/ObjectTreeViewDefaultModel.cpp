@@ -36,6 +36,8 @@
 #include <QMimeData>
 #include <QProgressDialog>
 
+#include <unordered_set>
+
 namespace raco::object_tree::model {
 
 using namespace raco::core;
@@ -58,26 +60,35 @@ ObjectTreeViewDefaultModel::ObjectTreeViewDefaultModel(core::CommandInterface* c
 	std::sort(allowedUserCreatableUserTypes_.begin(), allowedUserCreatableUserTypes_.end());
 
 	lifeCycleSubscription_ = dispatcher_->registerOnObjectsLifeCycle(
-		[this](auto sEditorObject) { dirty_ = true; },
-		[this](auto sEditorObject) { dirty_ = true; });
+		[this](auto sEditorObject) {
+			dirty_ = true;
+			++pendingLifecycleChanges_;
+		},
+		[this](auto sEditorObject) {
+			dirty_ = true;
+			++pendingLifecycleChanges_;
+		});
 
 	afterDispatchSubscription_ = dispatcher_->registerOnAfterDispatch([this]() {
 		if (dirty_) {
 			buildObjectTree();
 		}
+		pendingLifecycleChanges_ = 0;
+		notifyChangedObjects();
 	});
 
-	auto setDirtyAction = [this](ValueHandle handle) {
-		// Small optimization: Only set model dirty if the object with the changed name is actually in the model.
-		if (indexes_.count(handle.rootObject()->objectID()) > 0) {
-			dirty_ = true;
+	auto objectChangedAction = [this](ValueHandle handle) {
+		// Only the displayed data changes: no need to rebuild the tree. Ignore objects which are not in the model.
+		auto objectID = handle.rootObject()->objectID();
+		if (indexes_.count(objectID) > 0) {
+			changedObjectIDs_.insert(objectID);
 		}
 	};
 
-	objectNameSubscription_ = dispatcher_->registerOnPropertyChange("objectName", setDirtyAction);
-	visibilitySubscription_ = dispatcher_->registerOnPropertyChange("visibility", setDirtyAction);
-	enabledSubscription_ = dispatcher_->registerOnPropertyChange("enabled", setDirtyAction);
-	editorVisibilitySubscription_ = dispatcher_->registerOnPropertyChange("editorVisibility", setDirtyAction);
+	objectNameSubscription_ = dispatcher_->registerOnPropertyChange("objectName", objectChangedAction);
+	visibilitySubscription_ = dispatcher_->registerOnPropertyChange("visibility", objectChangedAction);
+	enabledSubscription_ = dispatcher_->registerOnPropertyChange("enabled", objectChangedAction);
+	editorVisibilitySubscription_ = dispatcher_->registerOnPropertyChange("editorVisibility", objectChangedAction);
 
 	childrenSubscription_ = dispatcher_->registerOnPropertyChange("children", [this](ValueHandle handle) {
 		dirty_ = true;
@@ -490,13 +501,134 @@ void ObjectTreeViewDefaultModel::buildObjectTree() {
 
 	auto filteredEditorObjects = filterForTopLevelObjects(project()->instances());
 
-	beginResetModel();
+	auto newRootNode = std::make_unique<ObjectTreeNode>(ObjectTreeNodeType::Root, nullptr);
+	constructTreeUnderNode(newRootNode.get(), filteredEditorObjects, groupExternalReferences_, groupByType_);
 
-	resetInvisibleRootNode();
-	constructTreeUnderNode(invisibleRootNode_.get(), filteredEditorObjects, groupExternalReferences_, groupByType_);
-	updateTreeIndexes();
+	if (invisibleRootNode_->childCount() == 0 || pendingLifecycleChanges_ > incrementalUpdateLimit_ || hasReparentedNodes(newRootNode.get())) {
+		// Initial build or large changes like pasting or importing many objects:
+		// resetting is cheaper than notifying the views about every single row.
+		// Objects moved to another parent would lose their view state when removed and inserted again,
+		// but the views restore it after a reset.
+		beginResetModel();
+
+		invisibleRootNode_ = std::move(newRootNode);
+		updateTreeIndexes();
+		changedObjectIDs_.clear();
+
+		endResetModel();
+	} else {
+		// Keep the existing nodes to preserve the view state like selection and expanded items.
+		mergeTreeNode(invisibleRootNode_.get(), invisibleRootIndex_, newRootNode.get());
+		updateTreeIndexes();
+	}
+}
 
-	endResetModel();
+bool ObjectTreeViewDefaultModel::hasReparentedNodes(ObjectTreeNode* newNode) const {
+	for (auto child : newNode->getChildren()) {
+		if (child->getType() == ObjectTreeNodeType::EditorObject) {
+			auto it = indexes_.find(child->getID());
+			if (it != indexes_.end() && indexToTreeNode(it->second)->getParent()->getID() != newNode->getID()) {
+				return true;
+			}
+		}
+		if (hasReparentedNodes(child)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ObjectTreeViewDefaultModel::setIncrementalUpdateLimit(size_t limit) {
+	incrementalUpdateLimit_ = limit;
+}
+
+void ObjectTreeViewDefaultModel::mergeTreeNode(ObjectTreeNode* oldNode, const QModelIndex& oldIndex, ObjectTreeNode* newNode) {
+	if (oldNode->getType() == ObjectTreeNodeType::EditorObject &&
+		(oldNode->getExternalProjectPath() != newNode->getExternalProjectPath() || oldNode->getExternalProjectName() != newNode->getExternalProjectName())) {
+		oldNode->setExternalProjectInfo(newNode->getExternalProjectPath(), newNode->getExternalProjectName());
+		changedObjectIDs_.insert(oldNode->getID());
+	}
+
+	auto newChildren = newNode->takeChildren();
+	std::unordered_set<std::string> newIDs;
+	for (auto child : newChildren) {
+		newIDs.insert(child->getID());
+	}
+
+	// Remove the obsolete children. Consecutive rows are removed together.
+	int row = static_cast<int>(oldNode->childCount()) - 1;
+	while (row >= 0) {
+		if (newIDs.count(oldNode->getChild(row)->getID()) > 0) {
+			--row;
+			continue;
+		}
+		int last = row;
+		while (row > 0 && newIDs.count(oldNode->getChild(row - 1)->getID()) == 0) {
+			--row;
+		}
+		beginRemoveRows(oldIndex, row, last);
+		for (int i = last; i >= row; --i) {
+			delete oldNode->takeChild(i);
+		}
+		endRemoveRows();
+		--row;
+	}
+
+	std::unordered_set<std::string> oldIDs;
+	for (auto child : oldNode->getChildren()) {
+		oldIDs.insert(child->getID());
+	}
+
+	// All remaining old children are contained in the new children: insert the new children and
+	// move the old children to their new position. Afterwards both children lists are in the same order.
+	std::vector<bool> inserted(newChildren.size(), false);
+	size_t pos = 0;
+	while (pos < newChildren.size()) {
+		auto id = newChildren[pos]->getID();
+		if (oldIDs.count(id) == 0) {
+			size_t last = pos;
+			while (last + 1 < newChildren.size() && oldIDs.count(newChildren[last + 1]->getID()) == 0) {
+				++last;
+			}
+			beginInsertRows(oldIndex, static_cast<int>(pos), static_cast<int>(last));
+			for (size_t i = pos; i <= last; ++i) {
+				oldNode->insertChild(i, newChildren[i]);
+				inserted[i] = true;
+			}
+			endInsertRows();
+			pos = last + 1;
+			continue;
+		}
+		if (oldNode->getChild(static_cast<int>(pos))->getID() != id) {
+			auto oldRow = pos + 1;
+			while (oldNode->getChild(static_cast<int>(oldRow))->getID() != id) {
+				++oldRow;
+			}
+			beginMoveRows(oldIndex, static_cast<int>(oldRow), static_cast<int>(oldRow), oldIndex, static_cast<int>(pos));
+			oldNode->insertChild(pos, oldNode->takeChild(oldRow));
+			endMoveRows();
+		}
+		++pos;
+	}
+
+	for (pos = 0; pos < newChildren.size(); ++pos) {
+		if (!inserted[pos]) {
+			mergeTreeNode(oldNode->getChild(static_cast<int>(pos)), index(static_cast<int>(pos), COLUMNINDEX_NAME, oldIndex), newChildren[pos]);
+			delete newChildren[pos];
+		}
+	}
+}
+
+void ObjectTreeViewDefaultModel::notifyChangedObjects() {
+	for (const auto& objectID : changedObjectIDs_) {
+		auto it = indexes_.find(objectID);
+		if (it != indexes_.end()) {
+			const auto& modelIndex = it->second;
+			// Explicitly use the QAbstractItemModel signal since the views are connected to it.
+			Q_EMIT QAbstractItemModel::dataChanged(modelIndex, modelIndex.sibling(modelIndex.row(), COLUMNINDEX_COLUMN_COUNT - 1));
+		}
+	}
+	changedObjectIDs_.clear();
 }
 
 void ObjectTreeViewDefaultModel::setNodeExternalProjectInfo(ObjectTreeNode* node) const {
@@ -80,6 +80,8 @@ void ObjectTreeViewRenderViewModel::updateSubscriptions() {
 	subscriptions_.emplace_back(dispatcher_->registerOnPropertyChange("material", setDirtyAction));
 	// Node
 	subscriptions_.emplace_back(dispatcher_->registerOnPropertyChange("tags", setDirtyAction));
+	// Objects may appear multiple times in the tree but only one index per object is kept: rebuild on name changes.
+	subscriptions_.emplace_back(dispatcher_->registerOnPropertyChange("objectName", setDirtyAction));
 
 	for (const auto& obj : project()->instances()) {
 		if (auto meshnode = obj->as<user_types::MeshNode>()) {
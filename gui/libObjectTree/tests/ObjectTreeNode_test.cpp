@@ -27,6 +27,33 @@ TEST(ObjectTreeNodeTest, StructureChildGetsAdded) {
 	delete parent;
 }
 
+TEST(ObjectTreeNodeTest, StructureChildGetsInsertedAndTaken) {
+	auto parent = new ObjectTreeNode(ObjectTreeNodeType::Root, nullptr);
+	auto first = new ObjectTreeNode(SEditorObject(), parent);
+	auto last = new ObjectTreeNode(SEditorObject(), parent);
+	auto middle = new ObjectTreeNode(SEditorObject(), nullptr);
+
+	parent->insertChild(1, middle);
+	ASSERT_EQ(parent->childCount(), 3);
+	ASSERT_EQ(parent->getChild(1), middle);
+	ASSERT_EQ(middle->getParent(), parent);
+	ASSERT_EQ(last->row(), 2);
+
+	ASSERT_EQ(parent->takeChild(0), first);
+	ASSERT_EQ(first->getParent(), nullptr);
+	ASSERT_EQ(parent->childCount(), 2);
+	ASSERT_EQ(middle->row(), 0);
+	delete first;
+
+	auto children = parent->takeChildren();
+	ASSERT_EQ(children, (std::vector<ObjectTreeNode*>{middle, last}));
+	ASSERT_EQ(parent->childCount(), 0);
+	for (auto child : children) {
+		delete child;
+	}
+
+	delete parent;
+}
 
 TEST(ObjectTreeNodeTest, StructureParentGetsDeleted) {
 	constexpr auto NODE_AMOUNT = 3;
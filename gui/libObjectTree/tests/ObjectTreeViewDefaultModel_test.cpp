@@ -28,6 +28,9 @@
 #include <QApplication>
 #include <core/PrefabOperations.h>
 
+#include <chrono>
+#include <limits>
+
 using namespace raco::core;
 using namespace object_tree::model;
 using namespace raco::user_types;
@@ -1137,4 +1140,143 @@ TEST_F(ObjectTreeViewDefaultModelTest, CanCopyAndPasteObjectThatIsAlreadyInModel
 
 	auto [parsedObjs, sourceProjectTopLevelObjectIds] = viewModel_->getObjectsAndRootIdsFromClipboardString(copiedObjs);
 	ASSERT_TRUE(viewModel_->canPasteIntoIndex({}, parsedObjs, sourceProjectTopLevelObjectIds));
-}
\ No newline at end of file
+}
+
+TEST_F(ObjectTreeViewDefaultModelTest, incremental_update_keeps_existing_nodes) {
+	auto node = create<Node>("node");
+	auto child = create<Node>("child", node);
+	dispatch();
+
+	int resetCount = 0;
+	QObject::connect(viewModel_.get(), &QAbstractItemModel::modelReset, [&resetCount]() { ++resetCount; });
+	QPersistentModelIndex nodeIndex = viewModel_->indexFromTreeNodeID(node->objectID());
+	QPersistentModelIndex childIndex = viewModel_->indexFromTreeNodeID(child->objectID());
+
+	auto sibling = create<Node>("sibling", node);
+	auto other = create<Node>("other");
+	dispatch();
+
+	EXPECT_EQ(resetCount, 0);
+	ASSERT_TRUE(nodeIndex.isValid());
+	ASSERT_TRUE(childIndex.isValid());
+	EXPECT_EQ(viewModel_->indexToSEditorObject(nodeIndex), node);
+	EXPECT_EQ(viewModel_->indexToSEditorObject(childIndex), child);
+	EXPECT_EQ(viewModel_->rowCount(nodeIndex), 2);
+	EXPECT_EQ(viewModel_->indexToSEditorObject(viewModel_->index(1, 0, nodeIndex)), sibling);
+	EXPECT_EQ(viewModel_->indexToSEditorObject(viewModel_->indexFromTreeNodeID(other->objectID())), other);
+
+	commandInterface().deleteObjects({child});
+	dispatch();
+
+	EXPECT_EQ(resetCount, 0);
+	ASSERT_TRUE(nodeIndex.isValid());
+	EXPECT_FALSE(childIndex.isValid());
+	EXPECT_EQ(viewModel_->rowCount(nodeIndex), 1);
+	EXPECT_EQ(viewModel_->indexToSEditorObject(viewModel_->index(0, 0, nodeIndex)), sibling);
+	EXPECT_FALSE(viewModel_->indexFromTreeNodeID(child->objectID()).isValid());
+}
+
+TEST_F(ObjectTreeViewDefaultModelTest, incremental_update_moves_children) {
+	auto node = create<Node>("node");
+	auto first = create<Node>("first", node);
+	auto second = create<Node>("second", node);
+	auto third = create<Node>("third", node);
+	dispatch();
+
+	int resetCount = 0;
+	QObject::connect(viewModel_.get(), &QAbstractItemModel::modelReset, [&resetCount]() { ++resetCount; });
+	QPersistentModelIndex thirdIndex = viewModel_->indexFromTreeNodeID(third->objectID());
+
+	moveScenegraphChildren({third}, node, 0);
+
+	EXPECT_EQ(resetCount, 0);
+	ASSERT_TRUE(thirdIndex.isValid());
+	EXPECT_EQ(thirdIndex.row(), 0);
+	auto nodeIndex = viewModel_->indexFromTreeNodeID(node->objectID());
+	EXPECT_EQ(viewModel_->indexToSEditorObject(viewModel_->index(1, 0, nodeIndex)), first);
+	EXPECT_EQ(viewModel_->indexToSEditorObject(viewModel_->index(2, 0, nodeIndex)), second);
+
+	// Moving to another parent resets the model: the views restore their state after a reset.
+	moveScenegraphChildren({second}, {});
+
+	EXPECT_EQ(resetCount, 1);
+	EXPECT_EQ(viewModel_->rowCount(viewModel_->indexFromTreeNodeID(node->objectID())), 2);
+	EXPECT_FALSE(viewModel_->parent(viewModel_->indexFromTreeNodeID(second->objectID())).isValid());
+}
+
+TEST_F(ObjectTreeViewDefaultModelTest, incremental_update_resets_past_limit) {
+	create<Node>("node");
+	dispatch();
+
+	int resetCount = 0;
+	QObject::connect(viewModel_.get(), &QAbstractItemModel::modelReset, [&resetCount]() { ++resetCount; });
+	viewModel_->setIncrementalUpdateLimit(1);
+
+	create<Node>("first");
+	dispatch();
+	EXPECT_EQ(resetCount, 0);
+
+	create<Node>("second");
+	create<Node>("third");
+	dispatch();
+	EXPECT_EQ(resetCount, 1);
+	EXPECT_EQ(viewModel_->rowCount(), 4);
+}
+
+TEST_F(ObjectTreeViewDefaultModelTest, property_change_only_notifies_data_changed) {
+	auto node = create<Node>("node");
+	create<Node>("other");
+	dispatch();
+
+	int structureChangeCount = 0;
+	std::vector<QModelIndex> changedIndices;
+	QObject::connect(viewModel_.get(), &QAbstractItemModel::modelReset, [&structureChangeCount]() { ++structureChangeCount; });
+	QObject::connect(viewModel_.get(), &QAbstractItemModel::rowsInserted, [&structureChangeCount]() { ++structureChangeCount; });
+	QObject::connect(viewModel_.get(), &QAbstractItemModel::rowsRemoved, [&structureChangeCount]() { ++structureChangeCount; });
+	QObject::connect(viewModel_.get(), &QAbstractItemModel::dataChanged, [&changedIndices](const QModelIndex& topLeft, const QModelIndex& bottomRight) {
+		changedIndices.emplace_back(topLeft);
+	});
+
+	commandInterface().set({node, &Node::objectName_}, std::string("renamed"));
+	commandInterface().set({node, &Node::visibility_}, false);
+	dispatch();
+
+	EXPECT_EQ(structureChangeCount, 0);
+	ASSERT_EQ(changedIndices.size(), 1);
+	EXPECT_EQ(viewModel_->indexToSEditorObject(changedIndices.front()), node);
+	EXPECT_EQ(modelIndexToString(*viewModel_, changedIndices.front()), "renamed");
+}
+
+#ifdef NDEBUG
+TEST_F(ObjectTreeViewDefaultModelTest, benchmark_tree_update_after_paste) {
+	constexpr int numObjects = 2000;
+
+	std::vector<SEditorObject> nodes;
+	for (int index = 0; index < numObjects; index++) {
+		nodes.emplace_back(create<Node>("node" + std::to_string(index)));
+	}
+	dispatch();
+	auto serializedObjects = commandInterface().copyObjects(nodes);
+
+	auto timeTreeUpdate = [this, &serializedObjects, numObjects](size_t limit) {
+		viewModel_->setIncrementalUpdateLimit(limit);
+		auto pasted = commandInterface().pasteObjects(serializedObjects);
+
+		auto start = std::chrono::steady_clock::now();
+		dispatch();
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+		EXPECT_EQ(viewModel_->rowCount(), 2 * numObjects);
+		commandInterface().deleteObjects(pasted);
+		dispatch();
+		return elapsed;
+	};
+
+	auto incrementalMs = timeTreeUpdate(std::numeric_limits<size_t>::max());
+	auto defaultLimitMs = timeTreeUpdate(ObjectTreeViewDefaultModel::DEFAULT_INCREMENTAL_UPDATE_LIMIT);
+
+	// Large pastes exceed the default limit: the model is rebuilt, which must not be slower than updating it incrementally.
+	// The constant allows for timer resolution and noise.
+	EXPECT_LE(defaultLimitMs, incrementalMs + 50);
+}
+#endif
@@ -0,0 +1,34 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace raco::utils::parallel {
+
+/**
+ * @brief Maximum number of threads used by parallelFor.
+ * 
+ * Defaults to the number of hardware threads. Setting the count to 1 disables multithreading; 0 restores the default.
+*/
+size_t workerCount();
+void setWorkerCount(size_t count);
+
+/**
+ * @brief Split the index range [0, count) into consecutive ranges and call func(begin, end) for each of them.
+ * 
+ * Ranges are processed concurrently on up to workerCount() threads including the calling thread. No range is
+ * smaller than minRangeSize unless count itself is smaller. The function only returns after all ranges have been
+ * processed. If func throws the first exception is rethrown in the calling thread.
+*/
+void parallelFor(size_t count, size_t minRangeSize, const std::function<void(size_t begin, size_t end)>& func);
+
+}  // namespace raco::utils::parallel
@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "utils/ParallelUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace raco::utils::parallel {
+
+namespace {
+
+std::atomic<size_t> workerCountOverride{0};
+
+}  // namespace
+
+size_t workerCount() {
+	if (auto count = workerCountOverride.load()) {
+		return count;
+	}
+	return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+void setWorkerCount(size_t count) {
+	workerCountOverride = count;
+}
+
+void parallelFor(size_t count, size_t minRangeSize, const std::function<void(size_t begin, size_t end)>& func) {
+	if (count == 0) {
+		return;
+	}
+
+	size_t numRanges = std::min(workerCount(), std::max<size_t>(1, count / std::max<size_t>(1, minRangeSize)));
+	if (numRanges <= 1) {
+		func(0, count);
+		return;
+	}
+
+	auto rangeBegin = [count, numRanges](size_t index) {
+		return index * count / numRanges;
+	};
+
+	std::vector<std::future<void>> futures;
+	futures.reserve(numRanges - 1);
+	for (size_t index = 1; index < numRanges; index++) {
+		futures.emplace_back(std::async(std::launch::async, func, rangeBegin(index), rangeBegin(index + 1)));
+	}
+
+	// The first range is processed on the calling thread. All futures must be waited for before rethrowing
+	// since the worker threads may still access data owned by the caller.
+	std::exception_ptr exception;
+	try {
+		func(0, rangeBegin(1));
+	} catch (...) {
+		exception = std::current_exception();
+	}
+	for (auto& future : futures) {
+		try {
+			future.get();
+		} catch (...) {
+			if (!exception) {
+				exception = std::current_exception();
+			}
+		}
+	}
+	if (exception) {
+		std::rethrow_exception(exception);
+	}
+}
+
+}  // namespace raco::utils::parallel
@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This file is part of Ramses Composer
+ * (see https://github.com/bmwcarit/ramses-composer).
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "gtest/gtest.h"
+#include "utils/ParallelUtils.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace raco::utils;
+
+TEST(ParallelUtilsTest, parallelFor_covers_range_exactly_once) {
+	std::vector<int> visited(10007, 0);
+	std::atomic<size_t> numCalls{0};
+	parallel::parallelFor(visited.size(), 100, [&visited, &numCalls](size_t begin, size_t end) {
+		EXPECT_LT(begin, end);
+		for (auto index = begin; index < end; index++) {
+			visited[index]++;
+		}
+		numCalls++;
+	});
+	EXPECT_EQ(visited, std::vector<int>(visited.size(), 1));
+	EXPECT_LE(numCalls, parallel::workerCount());
+}
+
+TEST(ParallelUtilsTest, parallelFor_small_count_single_range) {
+	size_t numCalls = 0;
+	parallel::parallelFor(50, 100, [&numCalls](size_t begin, size_t end) {
+		EXPECT_EQ(begin, 0);
+		EXPECT_EQ(end, 50);
+		numCalls++;
+	});
+	EXPECT_EQ(numCalls, 1);
+
+	parallel::parallelFor(0, 100, [](size_t, size_t) {
+		FAIL();
+	});
+}
+
+TEST(ParallelUtilsTest, parallelFor_rethrows_exception) {
+	parallel::setWorkerCount(4);
+	std::atomic<size_t> numCalls{0};
+	EXPECT_THROW(parallel::parallelFor(1000, 1, [&numCalls](size_t begin, size_t end) {
+		numCalls++;
+		if (end == 1000) {
+			throw std::runtime_error("error");
+		}
+	}),
+		std::runtime_error);
+	EXPECT_EQ(numCalls, 4);
+	parallel::setWorkerCount(0);
+}